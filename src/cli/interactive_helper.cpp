@@ -1,11 +1,14 @@
 #include "interactive_helper.h"
 #include "../runtime/runtime.h"
+#include "../runtime/fileio.h"
+#include "../parser/sqf/sqf_parser.hpp"
 #include <thread>
 #include <string>
 #include <string_view>
 #include <iostream>
 #include <cstring>
 #include <iomanip>
+#include <filesystem>
 
 using namespace std::string_literals;
 using namespace std::string_view_literals;
@@ -316,6 +319,57 @@ void interactive_helper::init()
                 std::cout << "Failed to evaluate." << std::endl;
             }
         });
+    register_command(std::array{ "ld"s, "load"s, "load-sqf"s },
+        "Preprocesses and parses the provided SQF file and creates a new script running it.\n"
+        "Loading a file again only parses the statements changed since it got loaded the last time.\n"
+        "Example: `ld C:\\file\\path\\dot.sqf`",
+        [](interactive_helper& interactive, std::string_view arg) -> void {
+            auto& runtime = interactive.runtime();
+            switch (runtime.runtime_state())
+            {
+            case sqf::runtime::runtime::state::running:
+            case sqf::runtime::runtime::state::evaluating:
+                std::cerr << "Runtime not halted." << std::endl;
+                return;
+            default:
+                break;
+            }
+            auto path = std::filesystem::absolute(std::filesystem::path(arg).lexically_normal()).string();
+            auto file = sqf::runtime::fileio::open_file_from_disk(path);
+            if (!file)
+            {
+                std::cerr << "Failed to load file '" << path << "'" << std::endl;
+                return;
+            }
+            auto ppedStr = runtime.parser_preprocessor().preprocess(runtime, file->contents(), { path, {} });
+            if (!ppedStr.has_value())
+            {
+                std::cerr << "Failed to preprocess file '" << path << "'" << std::endl;
+                return;
+            }
+            std::optional<sqf::runtime::instruction_set> set;
+            if (auto parser = dynamic_cast<sqf::parser::sqf::parser*>(&runtime.parser_sqf()))
+            {
+                auto& state = interactive.file_state(path, *parser);
+                set = state.update({ runtime.sqfop_names_table(), nullptr }, *ppedStr);
+                std::cout << "Parsed " << state.last().statements_parsed << " statements, reused " << state.last().statements_reused << "." << std::endl;
+            }
+            else
+            {
+                set = runtime.parser_sqf().parse(runtime, *ppedStr, { path, {} });
+            }
+            if (!set.has_value())
+            {
+                std::cerr << "Failed to parse file '" << path << "'" << std::endl;
+                return;
+            }
+            auto context = runtime.context_create().lock();
+            sqf::runtime::frame f(runtime.default_value_scope(), *set);
+            context->push_frame(f);
+            context->name(path);
+            interactive.context_selected(context);
+            std::cout << "Created Context '" << path << "'" << std::endl;
+        });
     register_command(std::array{ "q"s, "exit"s, "quit"s },
         "Exits the execution and terminates the program.",
         [](interactive_helper& interactive, std::string_view arg) -> void {
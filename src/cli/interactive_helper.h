@@ -1,9 +1,11 @@
 #pragma once
 #include "../runtime/runtime.h"
+#include "../parser/sqf/incremental.hpp"
 
 #include <string>
 #include <vector>
 #include <array>
+#include <unordered_map>
 
 namespace sqf::runtime
 {
@@ -26,6 +28,8 @@ class interactive_helper
     bool m_thread_die;
     bool m_exit;
     std::weak_ptr<sqf::runtime::context> m_context_selected;
+    // Parsed state of the files loaded, allowing to reload them incrementally.
+    std::unordered_map<std::string, sqf::parser::sqf::incremental> m_files;
 
     static const size_t buffer_size = 16384;
     char* m_buffer;
@@ -44,6 +48,7 @@ public:
         m_thread_die(false),
         m_exit(false),
         m_context_selected(),
+        m_files(),
         m_buffer(new char[buffer_size])
     {
     }
@@ -62,6 +67,24 @@ public:
     void context_selected(std::shared_ptr<sqf::runtime::context> sptr) { m_context_selected = sptr; }
     std::shared_ptr<sqf::runtime::context> context_selected() const { return m_context_selected.lock(); }
     void print_welcome();
+    /// <summary>
+    /// The incremental parse state of the provided file, created on first use.
+    /// </summary>
+    sqf::parser::sqf::incremental& file_state(const std::string& path, sqf::parser::sqf::parser& parser)
+    {
+        auto res = m_files.find(path);
+        if (res != m_files.end() && &res->second.owner() != &parser)
+        {
+            // The parser got replaced since, thus the state cannot be used anymore.
+            m_files.erase(res);
+            res = m_files.end();
+        }
+        if (res == m_files.end())
+        {
+            res = m_files.emplace(path, sqf::parser::sqf::incremental(parser, { path, {} })).first;
+        }
+        return res->second;
+    }
 
     bool execute_next(sqf::runtime::runtime::action action)
     {
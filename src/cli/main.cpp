@@ -6,7 +6,10 @@
 #include "../operators/ops.h"
 
 #include "../parser/config/default.h"
+#include "../parser/config/config_cache.h"
 #include "../parser/sqf/sqf_parser.hpp"
+#include "../parser/sqf/bytecode_cache.hpp"
+#include "../opcodes/bytecode.h"
 #include "../parser/preprocessor/default.h"
 
 #include "../fileio/default.h"
@@ -25,6 +28,9 @@
 #include <tclap/CmdLine.h>
 #include <algorithm>
 #include <string_view>
+#include <thread>
+#include <atomic>
+#include <exception>
 
 #include <csignal>
 #ifdef _WIN32
@@ -132,6 +138,224 @@ std::string extension(std::string input)
     }
     return input.substr(last_index + 1);
 }
+
+/// <summary>
+/// Invokes func for every index in [0, count), using up to jobs threads.
+/// Runs on the calling thread if jobs is 1 or less.
+/// </summary>
+template<typename TFunc>
+void parallel_for(size_t count, size_t jobs, TFunc func)
+{
+    jobs = std::min(jobs, count);
+    if (jobs <= 1)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            func(i);
+        }
+        return;
+    }
+    std::atomic<size_t> next(0);
+    std::vector<std::thread> threads;
+    threads.reserve(jobs);
+    for (size_t j = 0; j < jobs; j++)
+    {
+        threads.emplace_back([&]() {
+            for (size_t i = next++; i < count; i = next++)
+            {
+                func(i);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+}
+
+/// <summary>
+/// A SQF file provided via the command line, moving through loading, preprocessing and parsing.
+/// </summary>
+struct sqf_input
+{
+    std::string path;
+    std::shared_ptr<const sqf::runtime::fileio::file_handle> contents;
+    std::optional<std::string> preprocessed;
+    std::optional<sqf::runtime::instruction_set> set;
+    bool parsed;
+    // Whether the remaining steps have to be performed on the main thread by finish_sqf_input.
+    bool deferred;
+    std::exception_ptr exception;
+    BufferedLogger preprocess_log;
+    BufferedLogger parse_log;
+
+    sqf_input(std::string path, const Logger& logger) :
+        path(std::move(path)),
+        parsed(false),
+        deferred(true),
+        preprocess_log(logger),
+        parse_log(logger)
+    {
+    }
+};
+
+/// <summary>
+/// Loads, preprocesses and parses the input without touching shared state, so that multiple inputs
+/// may be prepared concurrently. All messages, including those of the fileio resolving includes,
+/// are buffered in the input. Inputs that cannot be preprocessed in isolation are left deferred.
+/// </summary>
+void prepare_sqf_input(sqf::runtime::runtime& runtime, const std::shared_ptr<const sqf::runtime::sqfop_names>& operators, sqf_input& input, bool check_only)
+{
+    try
+    {
+        input.contents = sqf::runtime::fileio::open_file_from_disk(input.path);
+        if (!input.contents)
+        {
+            input.deferred = false;
+            return;
+        }
+        bool deferred = false;
+        BufferedLogger preprocess_log(input.preprocess_log);
+        auto ppedStr = runtime.parser_preprocessor().preprocess_isolated(runtime, preprocess_log, input.contents->contents(), { input.path, {} }, deferred);
+        if (deferred)
+        {
+            return;
+        }
+        input.deferred = false;
+        input.preprocess_log = std::move(preprocess_log);
+        input.preprocessed = std::move(ppedStr);
+        if (!input.preprocessed.has_value())
+        {
+            return;
+        }
+        sqf::runtime::parser::sqf::context context{ operators, &input.parse_log };
+        if (check_only)
+        {
+            input.parsed = runtime.parser_sqf().check_syntax(context, *input.preprocessed, { input.path, {} });
+        }
+        else
+        {
+            input.set = runtime.parser_sqf().parse(context, *input.preprocessed, { input.path, {} });
+            input.parsed = input.set.has_value();
+        }
+    }
+    catch (...)
+    {
+        input.deferred = false;
+        input.exception = std::current_exception();
+    }
+}
+
+/// <summary>
+/// Reports an input in the same order messages would occur if it got processed sequentially,
+/// performing the remaining steps first if it got deferred.
+/// </summary>
+/// <returns>true if the input got parsed successfully.</returns>
+bool finish_sqf_input(sqf::runtime::runtime& runtime, Logger& logger, sqf_input& input, bool check_only, bool verbose, std::string_view purpose)
+{
+    try
+    {
+        if (verbose)
+        {
+            std::cout << "Loading file '" << input.path << "' for " << purpose << " ..." << std::endl;
+        }
+        if (input.deferred && !input.contents)
+        {
+            input.contents = sqf::runtime::fileio::open_file_from_disk(input.path);
+        }
+        if (!input.contents)
+        {
+            if (input.exception)
+            {
+                std::rethrow_exception(input.exception);
+            }
+            std::cout << "Failed to load file '" << input.path << "'" << std::endl;
+            return false;
+        }
+        if (verbose)
+        {
+            std::cout << "Preprocessing file '" << input.path << std::endl;
+        }
+        if (input.deferred)
+        {
+            input.preprocessed = runtime.parser_preprocessor().preprocess(runtime, input.contents->contents(), { input.path, {} });
+        }
+        input.preprocess_log.flush(logger);
+        if (!input.preprocessed.has_value())
+        {
+            if (input.exception)
+            {
+                std::rethrow_exception(input.exception);
+            }
+            std::cout << "Failed to preprocess file '" << input.path << "'" << std::endl;
+            return false;
+        }
+        if (verbose)
+        {
+            std::cout << "Parsing file '" << input.path << std::endl;
+        }
+        if (input.deferred)
+        {
+            if (check_only)
+            {
+                input.parsed = runtime.parser_sqf().check_syntax(runtime, *input.preprocessed, { input.path, {} });
+            }
+            else
+            {
+                input.set = runtime.parser_sqf().parse(runtime, *input.preprocessed, { input.path, {} });
+                input.parsed = input.set.has_value();
+            }
+        }
+        input.parse_log.flush(logger);
+        if (input.exception)
+        {
+            std::rethrow_exception(input.exception);
+        }
+        if (!input.parsed && !check_only)
+        {
+            std::cout << "Failed to parse file '" << input.path << "'" << std::endl;
+        }
+        return input.parsed;
+    }
+    catch (const std::runtime_error& ex)
+    {
+        std::cout << "Failed to load file '" << input.path << "': " << ex.what() << std::endl;
+        return false;
+    }
+}
+
+/// <summary>
+/// Loads, preprocesses and parses all inputs using up to jobs threads and reports them in order,
+/// invoking on_parsed on the calling thread for every input that got parsed successfully.
+/// </summary>
+/// <returns>true if all inputs got parsed successfully.</returns>
+template<typename TFunc>
+bool process_sqf_inputs(sqf::runtime::runtime& runtime, Logger& logger, std::vector<sqf_input>& inputs, size_t jobs, bool check_only, bool verbose, std::string_view purpose, TFunc on_parsed)
+{
+    if (jobs > 1 && inputs.size() > 1)
+    {
+        auto operators = runtime.sqfop_names_table();
+        parallel_for(inputs.size(), jobs, [&](size_t i) { prepare_sqf_input(runtime, operators, inputs[i], check_only); });
+    }
+    bool success = true;
+    for (auto& input : inputs)
+    {
+        if (finish_sqf_input(runtime, logger, input, check_only, verbose, purpose))
+        {
+            on_parsed(input);
+        }
+        else
+        {
+            success = false;
+        }
+        // Release the memory early, as the inputs may be plenty.
+        input.contents.reset();
+        input.preprocessed.reset();
+        input.set.reset();
+    }
+    return success;
+}
+
 int main(int argc, char** argv)
 {
     CRTDBG(_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF | _CRTDBG_LEAK_CHECK_DF));
@@ -183,12 +407,16 @@ int main_actual(int argc, char** argv)
     TCLAP::ValueArg<long> maxRuntimeArg("m", "max-runtime", "Sets the maximum allowed runtime for the VM. 0 means no restriction in place.", false, 0, "MILLISECONDS");
     cmd.add(maxRuntimeArg);
 
-    TCLAP::MultiArg<std::string> inputArg("i", "input", "Loads provided file from disk. File-Type is determined using default file extensions (sqf, cpp, hpp, pbo). " RELPATHHINT "!BE AWARE! This is case-sensitive!", false, "PATH");
+    TCLAP::MultiArg<std::string> inputArg("i", "input", "Loads provided file from disk. File-Type is determined using default file extensions (sqf, sqfc, cpp, hpp, pbo). " RELPATHHINT "!BE AWARE! This is case-sensitive!", false, "PATH");
     cmd.add(inputArg);
 
     TCLAP::MultiArg<std::string> inputSqfArg("", "input-sqf", "Loads provided SQF file from disk. Will be executed as if it was spawned. Executed from left to right. " RELPATHHINT "!BE AWARE! This is case-sensitive!", false, "PATH");
     cmd.add(inputSqfArg);
 
+    TCLAP::MultiArg<std::string> inputAllArg("", "input-all", "Implicitly adds all SQF files in a given directory and the subdirectories to the `--input-sqf PATH` arg. "
+        "Combined with '--parse-only', this checks the syntax of a whole project. " RELPATHHINT, false, "PATH");
+    cmd.add(inputAllArg);
+
     TCLAP::MultiArg<std::string> inputConfigArg("", "input-config", "Loads provided config file from disk. Will be parsed before files, added using '--input'. " RELPATHHINT "!BE AWARE! This is case-sensitive!", false, "PATH");
     cmd.add(inputConfigArg);
 
@@ -204,6 +432,10 @@ int main_actual(int argc, char** argv)
     TCLAP::MultiArg<std::string> preprocessFileArg("E", "preprocess-file", "Runs the preprocessor on provided file and prints it to stdout. " RELPATHHINT "!BE AWARE! This is case-sensitive!", false, "PATH");
     cmd.add(preprocessFileArg);
 
+    TCLAP::MultiArg<std::string> compileBytecodeArg("", "compile-bytecode", "Preprocesses and parses the provided SQF file and writes the result as precompiled module next to it "
+        "(extension is changed to sqfc). execVM will prefer such modules over the SQF file, as long as they are not older than it. " RELPATHHINT, false, "PATH");
+    cmd.add(compileBytecodeArg);
+
     TCLAP::MultiArg<std::string> defineArg("D", "define", "Allows to add PreProcessor definitions. Note that file-based definitions may override and/or conflict with theese.", false, "NAME|NAME=VALUE");
     cmd.add(defineArg);
 
@@ -230,6 +462,29 @@ int main_actual(int argc, char** argv)
     cmd.add(useSqcArg);
 #endif
 
+    TCLAP::ValueArg<std::string> snapshotSaveArg("", "snapshot-save", "Writes the config and namespaces to the provided file once all inputs got loaded. "
+        "The file can be passed to '--snapshot-load' to skip config parsing on subsequent runs. " RELPATHHINT, false, "", "PATH");
+    cmd.add(snapshotSaveArg);
+
+    TCLAP::ValueArg<std::string> configSaveRapifiedArg("", "config-save-rapified", "Writes the config to the provided file in rapified (binarized) form once all inputs got loaded. "
+        "Rapified configs are detected when loading config files and skip preprocessing. " RELPATHHINT, false, "", "PATH");
+    cmd.add(configSaveRapifiedArg);
+
+    TCLAP::ValueArg<std::string> snapshotLoadArg("", "snapshot-load", "Loads the config and namespaces from a file created using '--snapshot-save' before any other input is processed. " RELPATHHINT, false, "", "PATH");
+    cmd.add(snapshotLoadArg);
+
+    TCLAP::ValueArg<std::string> bytecodeCacheArg("", "bytecode-cache", "Keeps the compiled form of all parsed SQF in the provided directory and reuses it on subsequent runs, "
+        "skipping the parsing of unchanged files. Entries created by other SQF-VM versions are reported and replaced. " RELPATHHINT, false, "", "PATH");
+    cmd.add(bytecodeCacheArg);
+
+    TCLAP::ValueArg<std::string> configCacheArg("", "config-cache", "Keeps the config created from the config files provided in the provided directory and reuses it on subsequent runs, "
+        "skipping preprocessing and parsing as long as neither the files, the files they include nor the defines changed. " RELPATHHINT, false, "", "PATH");
+    cmd.add(configCacheArg);
+
+    TCLAP::ValueArg<long> jobsArg("j", "jobs", "Sets the amount of threads used to preprocess and parse the provided SQF files and large config files. "
+        "Files are still reported and executed in the order they got provided. 0 uses one thread per hardware thread available.", false, 0, "COUNT");
+    cmd.add(jobsArg);
+
     TCLAP::SwitchArg automatedArg("a", "automated", "Disables all possible prompts.", false);
     cmd.add(automatedArg);
 
@@ -263,6 +518,13 @@ int main_actual(int argc, char** argv)
         "Mapping is separated by a '|', with the left side being the physical, and the right argument the virtual path. " RELPATHHINT, false, "PATH|VIRTUAL");
     cmd.add(virtualArg);
 
+    TCLAP::MultiArg<std::string> virtualAutoArg("", "virtual-auto", "Recursively searches the provided directory for $PBOPREFIX$ files and maps each directory containing one onto the prefix it contains. "
+        "Directories are searched using the amount of threads set via '--jobs'. " RELPATHHINT, false, "PATH");
+    cmd.add(virtualAutoArg);
+
+    TCLAP::ValueArg<std::string> virtualAutoManifestArg("", "virtual-auto-manifest", "Keeps the results of '--virtual-auto' in the provided file, so that subsequent runs only list directories that changed since. " RELPATHHINT, false, "", "PATH");
+    cmd.add(virtualAutoManifestArg);
+
     TCLAP::SwitchArg verboseArg("V", "verbose", "Enables additional output.", false);
     cmd.add(verboseArg);
 
@@ -415,6 +677,7 @@ int main_actual(int argc, char** argv)
     std::vector<std::string> sqf_files = inputSqfArg.getValue();
     std::vector<std::string> config_files = inputConfigArg.getValue();
     std::vector<std::string> pbo_files = inputPboArg.getValue();
+    std::vector<std::string> module_files;
     bool errflag = false;
     bool automated = automatedArg.getValue();
     // bool noAssemblyCreation = noAssemblyCreationArg.getValue();
@@ -426,7 +689,11 @@ int main_actual(int argc, char** argv)
         {
             sqf_files.push_back(f);
         }
-        else if (ext == "cpp" || ext == "hpp" || ext == "ext")
+        else if (ext == "sqfc")
+        {
+            module_files.push_back(f);
+        }
+        else if (ext == "cpp" || ext == "hpp" || ext == "ext" || ext == "bin")
         {
             config_files.push_back(f);
         }
@@ -441,12 +708,42 @@ int main_actual(int argc, char** argv)
         }
     }
 
+    for (auto& f : inputAllArg.getValue())
+    {
+        std::vector<std::string> found;
+        auto path = std::filesystem::absolute((std::filesystem::path(executable_path) / f).lexically_normal());
+        std::error_code ec;
+        for (
+            auto it = std::filesystem::recursive_directory_iterator(path, std::filesystem::directory_options::skip_permission_denied, ec);
+            it != std::filesystem::recursive_directory_iterator();
+            it.increment(ec))
+        {
+            if (it->is_directory()) { continue; }
+            auto ext = it->path().extension().string();
+            std::transform(ext.begin(), ext.end(), ext.begin(), [](char c) { return (char)std::tolower(c); });
+            if (ext == ".sqf")
+            {
+                found.push_back(it->path().string());
+            }
+        }
+        if (ec)
+        {
+            errflag = true;
+            std::cout << "Failed to list directory '" << path.string() << "': " << ec.message() << std::endl;
+        }
+        // Iteration order is unspecified. Sorted descending, as sqf_files gets reversed below.
+        std::sort(found.begin(), found.end(), std::greater<std::string>());
+        sqf_files.insert(sqf_files.end(), found.begin(), found.end());
+    }
+
     std::reverse(sqf_files.begin(), sqf_files.end());
     std::reverse(config_files.begin(), config_files.end());
     std::reverse(pbo_files.begin(), pbo_files.end());
+    std::reverse(module_files.begin(), module_files.end());
 
     bool noLoadExecDir = noLoadExecDirArg.getValue();
     bool verbose = verboseArg.getValue();
+    size_t jobs = jobsArg.getValue() > 0 ? static_cast<size_t>(jobsArg.getValue()) : std::max<size_t>(1, std::thread::hardware_concurrency());
 
 
 
@@ -460,21 +757,36 @@ int main_actual(int argc, char** argv)
     
 
     sqf::runtime::runtime runtime(logger, conf);
-    runtime.fileio(std::make_unique<sqf::fileio::impl_default>(logger));
-    runtime.parser_config(std::make_unique<sqf::parser::config::impl_default>(logger));
-    runtime.parser_preprocessor(std::make_unique<sqf::parser::preprocessor::impl_default>(logger));
+    auto fileio = std::make_unique<sqf::fileio::impl_default>(logger);
+    auto& fileio_default = *fileio;
+    runtime.fileio(std::move(fileio));
+    runtime.parser_config(std::make_unique<sqf::parser::config::impl_default>(logger, jobs));
+    auto preprocessor = std::make_unique<sqf::parser::preprocessor::impl_default>(logger);
+    auto& preprocessor_default = *preprocessor;
+    runtime.parser_preprocessor(std::move(preprocessor));
+    std::unique_ptr<sqf::runtime::parser::sqf> parser_sqf;
 #if defined(SQF_SQC_SUPPORT)
     if (useSqcArg.getValue())
     {
-        runtime.parser_sqf(std::make_unique<sqf::sqc::parser>(logger));
+        parser_sqf = std::make_unique<sqf::sqc::parser>(logger);
     }
     else
     {
-        runtime.parser_sqf(std::make_unique<sqf::parser::sqf::parser>(logger));
+        parser_sqf = std::make_unique<sqf::parser::sqf::parser>(logger);
     }
 #else
-    runtime.parser_sqf(std::make_unique<sqf::parser::sqf::parser>(logger));
+    parser_sqf = std::make_unique<sqf::parser::sqf::parser>(logger);
 #endif
+    if (!bytecodeCacheArg.getValue().empty())
+    {
+        auto sanitized = std::filesystem::absolute((std::filesystem::path(executable_path) / bytecodeCacheArg.getValue()).lexically_normal());
+        parser_sqf = std::make_unique<sqf::parser::sqf::bytecode_cache>(logger, sanitized, std::move(parser_sqf));
+        if (verbose)
+        {
+            std::cout << "Using bytecode cache at '" << sanitized.string() << "'." << std::endl;
+        }
+    }
+    runtime.parser_sqf(std::move(parser_sqf));
     if (noOperatorsArg.getValue())
     {
         sqf::operators::ops_sqfvm(runtime);
@@ -550,6 +862,44 @@ int main_actual(int argc, char** argv)
             std::cout << "Mapped '" << virt << "' onto '" << phys << "'." << std::endl;
         }
     }
+    auto virtual_auto = virtualAutoArg.getValue();
+    for (size_t i = 0; i < virtual_auto.size(); i++)
+    {
+        auto sanitized = std::filesystem::absolute((std::filesystem::path(executable_path) / virtual_auto[i]).lexically_normal()).string();
+        std::filesystem::path manifest;
+        if (!virtualAutoManifestArg.getValue().empty())
+        {
+            manifest = std::filesystem::absolute((std::filesystem::path(executable_path) / virtualAutoManifestArg.getValue()).lexically_normal());
+            // Each directory searched gets its own manifest, as they would replace each other otherwise.
+            if (virtual_auto.size() > 1)
+            {
+                manifest += "." + std::to_string(i);
+            }
+        }
+        for (auto& mapping : sqf::runtime::fileio::find_prefixes(sanitized, jobs, manifest))
+        {
+            runtime.fileio().add_mapping(mapping.physical, mapping.prefix);
+            if (verbose)
+            {
+                std::cout << "Mapped '" << mapping.prefix << "' onto '" << mapping.physical << "'." << std::endl;
+            }
+        }
+    }
+    for (auto& f : pbo_files)
+    {
+        auto sanitized = std::filesystem::absolute((std::filesystem::path(executable_path) / f).lexically_normal()).string();
+        auto archive = fileio_default.mount_pbo(sanitized);
+        if (!archive)
+        {
+            errflag = true;
+            std::cout << "Failed to mount PBO '" << sanitized << "'." << std::endl;
+            continue;
+        }
+        if (verbose)
+        {
+            std::cout << "Mounted '" << sanitized << "' onto '/" << archive->prefix() << "'." << std::endl;
+        }
+    }
     
 
     // Prepare Dummy-Commands
@@ -595,6 +945,32 @@ int main_actual(int argc, char** argv)
         }
     }
 
+    // Restore warm state from snapshot
+    if (!snapshotLoadArg.getValue().empty())
+    {
+        auto sanitized = std::filesystem::absolute((std::filesystem::path(executable_path) / snapshotLoadArg.getValue()).lexically_normal()).string();
+        std::ifstream in_file(sanitized, std::ios_base::binary);
+        auto snapshot = runtime.snapshot_create();
+        if (!in_file.good())
+        {
+            errflag = true;
+            std::cout << "Failed to open snapshot '" << sanitized << "'." << std::endl;
+        }
+        else if (!snapshot->deserialize(in_file))
+        {
+            errflag = true;
+            std::cout << "Failed to load snapshot '" << sanitized << "'. File is either corrupted or of an incompatible version." << std::endl;
+        }
+        else
+        {
+            runtime.snapshot_apply(snapshot);
+            if (verbose)
+            {
+                std::cout << "Loaded snapshot '" << sanitized << "'." << std::endl;
+            }
+        }
+    }
+
     if (errflag)
     {
         if (!automated)
@@ -642,14 +1018,14 @@ int main_actual(int argc, char** argv)
                 {
                     std::cout << "Loading file '" << sanitized << "' for compilation ..." << std::endl;
                 }
-                auto file = sqf::runtime::fileio::read_file_from_disk(sanitized);
-                if (!file.has_value())
+                auto file = sqf::runtime::fileio::open_file_from_disk(sanitized);
+                if (!file)
                 {
                     std::cout << "Failed to load file '" << sanitized << "'" << std::endl;
                     errflag = true;
                     continue;
                 }
-                auto str = *file;
+                auto str = file->contents();
                 if (verbose)
                 {
                     std::cout << "Preprocessing file '" << sanitized << std::endl;
@@ -750,14 +1126,14 @@ int main_actual(int argc, char** argv)
             {
                 std::cout << "Loading file '" << sanitized << "' for preprocessing ..." << std::endl;
             }
-            auto file = sqf::runtime::fileio::read_file_from_disk(sanitized);
-            if (!file.has_value())
+            auto file = sqf::runtime::fileio::open_file_from_disk(sanitized);
+            if (!file)
             {
                 std::cout << "Failed to load file '" << sanitized << "'" << std::endl;
                 errflag = true;
                 continue;
             }
-            auto str = *file;
+            auto str = file->contents();
             if (verbose)
             {
                 std::cout << "Preprocessing file '" << sanitized << std::endl;
@@ -780,79 +1156,150 @@ int main_actual(int argc, char** argv)
         }
     }
 
-    // Load all sqf-files provided via arg.
-    for (auto& sqf_file : sqf_files)
+    // Compile the files into precompiled modules
     {
-        auto sanitized = std::filesystem::absolute((std::filesystem::path(executable_path) / sqf_file).lexically_normal()).string();
-        try
+        std::vector<sqf_input> inputs;
+        for (auto& f : compileBytecodeArg.getValue())
         {
-            if (sanitized.empty())
+            auto sanitized = std::filesystem::absolute((std::filesystem::path(executable_path) / f).lexically_normal()).string();
+            if (!sanitized.empty())
             {
-                continue;
+                inputs.emplace_back(sanitized, logger);
             }
-            if (verbose)
+        }
+        auto success = process_sqf_inputs(runtime, logger, inputs, jobs, false, verbose, "bytecode compilation", [&](sqf_input& input) {
+            auto path = std::filesystem::path(input.path);
+            path.replace_extension(sqf::opcodes::bytecode::extension);
+            std::ofstream out_file(path, std::ios_base::binary | std::ios_base::trunc);
+            if (!out_file.good() || !sqf::opcodes::bytecode::write(out_file, *input.set))
             {
-                std::cout << "Loading file '" << sanitized << "' for sqf processing ..." << std::endl;
+                errflag = true;
+                std::cout << "Failed to write module '" << path.string() << "'." << std::endl;
             }
-            auto file = sqf::runtime::fileio::read_file_from_disk(sanitized);
-            if (!file.has_value())
+            else if (verbose)
             {
-                std::cout << "Failed to load file '" << sanitized << "'" << std::endl;
-                errflag = true;
-                continue;
+                std::cout << "Wrote module '" << path.string() << "'." << std::endl;
             }
-            auto str = *file;
+        });
+        if (!success)
+        {
+            errflag = true;
+        }
+    }
+
+    // Load all precompiled modules provided via arg.
+    for (auto& f : module_files)
+    {
+        auto sanitized = std::filesystem::absolute((std::filesystem::path(executable_path) / f).lexically_normal()).string();
+        std::ifstream in_file(sanitized, std::ios_base::binary);
+        if (!in_file.good())
+        {
+            errflag = true;
+            std::cout << "Failed to load file '" << sanitized << "'" << std::endl;
+            continue;
+        }
+        auto set = sqf::opcodes::bytecode::read(in_file);
+        if (!set.has_value())
+        {
+            errflag = true;
+            std::cout << "Failed to load module '" << sanitized << "'. File is either corrupted or of an incompatible version." << std::endl;
+            continue;
+        }
+        if (!parseOnly)
+        {
+            auto context = runtime.context_create().lock();
+            sqf::runtime::frame f(runtime.default_value_scope(), *set);
+            context->push_frame(f);
+            context->name(sanitized);
             if (verbose)
             {
-                std::cout << "Preprocessing file '" << sanitized << std::endl;
+                std::cout << "Created Context '" << sanitized << "'" << std::endl;
             }
-            auto ppedStr = runtime.parser_preprocessor().preprocess(runtime, str, { sanitized, {} });
-            if (ppedStr.has_value())
+        }
+    }
+
+    // Load all sqf-files provided via arg.
+    {
+        std::vector<sqf_input> inputs;
+        for (auto& sqf_file : sqf_files)
+        {
+            auto sanitized = std::filesystem::absolute((std::filesystem::path(executable_path) / sqf_file).lexically_normal()).string();
+            if (!sanitized.empty())
             {
-                if (verbose)
-                {
-                    std::cout << "Parsing file '" << sanitized << std::endl;
-                }
-                if (parseOnlyArg.getValue())
-                {
-                    auto success = runtime.parser_sqf().check_syntax(runtime, *ppedStr, { sanitized, {} });
-                    errflag = !success;
-                }
-                else
-                {
-                    auto set = runtime.parser_sqf().parse(runtime, *ppedStr, { sanitized, {} });
-                    if (set.has_value())
-                    {
-                        auto context = runtime.context_create().lock();
-                        sqf::runtime::frame f(runtime.default_value_scope(), *set);
-                        context->push_frame(f);
-                        context->name(sanitized);
-                        if (verbose)
-                        {
-                            std::cout << "Created Context '" << sanitized << "'" << std::endl;
-                        }
-                    }
-                    else
-                    {
-                        errflag = true;
-                        std::cout << "Failed to parse file '" << sanitized << "'" << std::endl;
-                    }
-                }
+                inputs.emplace_back(sanitized, logger);
             }
-            else
+        }
+        auto success = process_sqf_inputs(runtime, logger, inputs, jobs, parseOnlyArg.getValue(), verbose, "sqf processing", [&](sqf_input& input) {
+            if (parseOnlyArg.getValue())
             {
-                errflag = true;
-                std::cout << "Failed to preprocess file '" << sanitized << "'" << std::endl;
+                return;
             }
-        }
-        catch (const std::runtime_error& ex)
+            auto context = runtime.context_create().lock();
+            sqf::runtime::frame f(runtime.default_value_scope(), *input.set);
+            context->push_frame(f);
+            context->name(input.path);
+            if (verbose)
+            {
+                std::cout << "Created Context '" << input.path << "'" << std::endl;
+            }
+        });
+        if (!success)
         {
             errflag = true;
-            std::cout << "Failed to load file '" << sanitized << "': " << ex.what() << std::endl;
+        }
+        auto cache = dynamic_cast<sqf::parser::sqf::bytecode_cache*>(&runtime.parser_sqf());
+        if (cache && verbose)
+        {
+            auto stats = cache->stats();
+            std::cout << "Bytecode cache: " << stats.hits << " hits, " << stats.misses << " misses, " << stats.stale << " stale entries." << std::endl;
+        }
+    }
+
+    // Restore config created from the same config-files from cache
+    std::optional<sqf::parser::config::config_cache> config_cache;
+    std::vector<std::string> config_dependencies;
+    bool config_cached = false;
+    if (!configCacheArg.getValue().empty() && !config_files.empty() && !parseOnlyArg.getValue())
+    {
+        auto sanitized = std::filesystem::absolute((std::filesystem::path(executable_path) / configCacheArg.getValue()).lexically_normal());
+        if (runtime.confighost().containers().size() > 1)
+        {
+            // Entries only hold what the config-files created, thus cannot be applied on top of existing config.
+            if (verbose)
+            {
+                std::cout << "Not using config cache at '" << sanitized.string() << "', as config got loaded already." << std::endl;
+            }
+        }
+        else
+        {
+            config_cache.emplace(logger, sanitized);
+            // Inputs changing the way includes get resolved or preprocessed.
+            for (auto& it : virtualArg.getValue()) { config_cache->add_input("--virtual", it); }
+            for (auto& it : virtualAutoArg.getValue()) { config_cache->add_input("--virtual-auto", it); }
+            for (auto& it : pbo_files) { config_cache->add_input("--input-pbo", it); }
+            for (auto& it : defineArg.getValue()) { config_cache->add_input("--define", it); }
+            for (auto& f : config_files)
+            {
+                auto sanitized_file = std::filesystem::absolute((std::filesystem::path(executable_path) / f).lexically_normal()).string();
+                auto file = sqf::runtime::fileio::open_file_from_disk(sanitized_file);
+                config_cache->add_input(sanitized_file, file ? file->contents() : std::string_view{});
+            }
+            auto cached = config_cache->load();
+            if (cached.has_value())
+            {
+                runtime.confighost() = std::move(*cached);
+                config_cached = true;
+                config_files.clear();
+            }
+            if (verbose)
+            {
+                std::cout << (config_cached ? "Loaded config from cache entry '" : "No valid config cache entry '") << config_cache->entry_path().string() << "'." << std::endl;
+            }
         }
     }
 
     // Load & merge all config-files provided via arg.
+    auto config_fingerprint = runtime.parser_preprocessor().fingerprint();
     for (auto& f : config_files)
     {
         auto sanitized = std::filesystem::absolute((std::filesystem::path(executable_path) / f).lexically_normal()).string();
@@ -866,19 +1313,27 @@ int main_actual(int argc, char** argv)
             {
                 std::cout << "Loading file '" << sanitized << "' for config processing ..." << std::endl;
             }
-            auto file = sqf::runtime::fileio::read_file_from_disk(sanitized);
-            if (!file.has_value())
+            auto file = sqf::runtime::fileio::open_file_from_disk(sanitized);
+            if (!file)
             {
                 std::cout << "Failed to load file '" << sanitized << "'" << std::endl;
                 errflag = true;
                 continue;
             }
-            auto str = *file;
-            if (verbose)
+            auto str = file->contents();
+            std::optional<std::string> ppedStr;
+            if (sqf::parser::config::rapified::is_rapified(str))
             {
-                std::cout << "Preprocessing file '" << sanitized << std::endl;
+                ppedStr = std::string(str);
+            }
+            else
+            {
+                if (verbose)
+                {
+                    std::cout << "Preprocessing file '" << sanitized << std::endl;
+                }
+                ppedStr = preprocessor_default.preprocess(runtime, str, { sanitized, {} }, nullptr, nullptr, &config_dependencies);
             }
-            auto ppedStr = runtime.parser_preprocessor().preprocess(runtime, str, { sanitized, {} });
             if (ppedStr.has_value())
             {
                 if (verbose)
@@ -912,6 +1367,14 @@ int main_actual(int argc, char** argv)
             std::cout << "Failed to load file '" << sanitized << "': " << ex.what() << std::endl;
         }
     }
+    // Configs expanding eg. __COUNTER__ or __DATE__ differ between runs and thus are not stored.
+    if (config_cache.has_value() && !config_cached && !errflag && config_fingerprint == runtime.parser_preprocessor().fingerprint())
+    {
+        if (config_cache->store(runtime.confighost(), config_dependencies) && verbose)
+        {
+            std::cout << "Stored config in cache entry '" << config_cache->entry_path().string() << "'." << std::endl;
+        }
+    }
     if (errflag || parseOnly)
     {
         if (verbose && errflag)
@@ -961,6 +1424,38 @@ int main_actual(int argc, char** argv)
             std::cout << "Failed to parse commandline input." << std::endl;
         }
     }
+
+    // Store config in rapified form
+    if (!configSaveRapifiedArg.getValue().empty())
+    {
+        auto sanitized = std::filesystem::absolute((std::filesystem::path(executable_path) / configSaveRapifiedArg.getValue()).lexically_normal()).string();
+        std::ofstream out_file(sanitized, std::ios_base::binary | std::ios_base::trunc);
+        auto rapified = sqf::parser::config::rapified::write(runtime.confighost());
+        if (!out_file.good() || !out_file.write(rapified.data(), rapified.size()))
+        {
+            errflag = true;
+            std::cout << "Failed to write rapified config '" << sanitized << "'." << std::endl;
+        }
+        else if (verbose)
+        {
+            std::cout << "Wrote rapified config '" << sanitized << "'." << std::endl;
+        }
+    }
+    // Store warm state into snapshot
+    if (!snapshotSaveArg.getValue().empty())
+    {
+        auto sanitized = std::filesystem::absolute((std::filesystem::path(executable_path) / snapshotSaveArg.getValue()).lexically_normal()).string();
+        std::ofstream out_file(sanitized, std::ios_base::binary | std::ios_base::trunc);
+        if (!out_file.good() || !runtime.snapshot_create()->serialize(out_file))
+        {
+            errflag = true;
+            std::cout << "Failed to write snapshot '" << sanitized << "'." << std::endl;
+        }
+        else if (verbose)
+        {
+            std::cout << "Wrote snapshot '" << sanitized << "'." << std::endl;
+        }
+    }
 //     if (serverArg.isSet())
 //     {
 //         networking_init();
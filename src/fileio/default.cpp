@@ -30,138 +30,163 @@ inline bool file_exists(std::filesystem::path p)
     return infile.good();
 }
 
-std::optional<sqf::runtime::fileio::pathinfo> sqf::fileio::impl_default::get_info_virtual(std::string_view viewVirtual, sqf::runtime::fileio::pathinfo current) const
+std::optional<std::string> sqf::fileio::impl_default::normalize_virtual(std::string_view view)
 {
-    // Create & Cleanse stuff
-    auto virt = std::string(viewVirtual);
-    std::replace(virt.begin(), virt.end(), '\\', '/');
-    virt = std::string(sqf::runtime::util::trim(virt));
-    std::string virtFull = virt;
-
-    log(logmessage::fileio::ResolveVirtualRequested(current.physical, virt));
-
-    // Abort conditions
-    if (virt.empty())
+    std::vector<std::string_view> segments;
+    while (!view.empty())
     {
-        log(logmessage::fileio::ResolveVirtualFileNotFound(current.physical, virt));
-        return {};
-    }
-
-    // Prepare local tree-node list
-    std::vector<std::shared_ptr<path_element>> nodes;
-    nodes.push_back(m_virtual_file_root);
-
-#if WIN32
-    if (virt[0] != '/' && !(virt.length() >= 2 && virt[1] == ':'))
-#else
-    if (virt[0] != '/')
-#endif
-    { // Navigate current virtual path if relative
-
-        // Iterate over the whole existing virtual path
-        if (!current.virtual_.empty())
+        auto end = view.find_first_of("/\\");
+        auto segment = view.substr(0, end);
+        view = end == std::string_view::npos ? std::string_view{} : view.substr(end + 1);
+        if (segment.empty() || segment == "."sv)
         {
-            virtFull = current.virtual_ + "/" + virt;
-
-            std::istringstream stream_virt(current.virtual_);
-            for (auto it = std::istream_iterator<StringDelimiter<'/'>>{ stream_virt }; it != std::istream_iterator<StringDelimiter<'/'>>{}; ++it)
-            {
-                if (it->empty())
-                { /* skip empty */
-                    continue;
-                }
-                if (nodes.back()->next.find(*it) != nodes.back()->next.end())
-                {
-                    nodes.push_back(nodes.back()->next.at(*it));
-                    log(logmessage::fileio::ResolveVirtualNavigateDown(current.physical, virt, *it));
-                }
-                else
-                { /* Dead-End. File Not Found. */
-                    log(logmessage::fileio::ResolveVirtualFileNotFound(current.physical, virt));
-                    return {};
-                }
+            continue;
+        }
+        if (segment == ".."sv)
+        {
+            if (segments.empty())
+            { /* Leaving the root. */
+                return {};
             }
+            segments.pop_back();
+            continue;
         }
+        segments.push_back(segment);
     }
-
-    // Explore further until we hit dead-end
+    if (segments.empty())
+    {
+        return "/"s;
+    }
+    std::string normalized;
+    for (auto segment : segments)
+    {
+        normalized.push_back('/');
+        normalized.append(segment);
+    }
+    return normalized;
+}
+bool sqf::fileio::impl_default::is_virtual_directory(std::string_view view) const
+{
+    const path_element* node = m_virtual_file_root.get();
+    while (!view.empty())
+    {
+        auto end = view.find('/');
+        auto segment = std::string(view.substr(0, end));
+        view = end == std::string_view::npos ? std::string_view{} : view.substr(end + 1);
+        if (segment.empty())
+        {
+            continue;
+        }
+        auto res = node->next.find(segment);
+        if (res == node->next.end())
+        {
+            return false;
+        }
+        node = res->second.get();
+    }
+    return true;
+}
+std::optional<sqf::runtime::fileio::pathinfo> sqf::fileio::impl_default::get_info_virtual(Logger& logger, const std::string& virt, const sqf::runtime::fileio::pathinfo& current) const
+{
     {
-        std::istringstream stream_virt(virt);
-        auto it = std::istream_iterator<StringDelimiter<'/'>>{ stream_virt };
-        for (; it != std::istream_iterator<StringDelimiter<'/'>>{}; ++it)
+        std::lock_guard lock(m_index_mutex);
+        auto res = m_index.find(virt);
+        if (res != m_index.end())
         {
-            if (it->empty()) { /* skip empty */ continue; }
-            if (*it == ".."s && !nodes.empty())
+            log(logger, logmessage::fileio::ResolveVirtualRequested(current.physical, virt));
+            if (res->second.has_value())
             {
-                // Move dir-up
-                nodes.pop_back();
-                log(logmessage::fileio::ResolveVirtualNavigateUp(current.physical, virt));
+                log(logger, logmessage::fileio::ResolveVirtualFileMatched(current.physical, virt, res->second->physical));
             }
             else
             {
-                if (nodes.empty())
-                {
-                    log(logmessage::fileio::ResolveVirtualNavigateNoNodesLeftForExploring(current.physical, virt));
-                    break;
-                }
-                else if (nodes.back()->next.find(*it) == nodes.back()->next.end())
-                { /* Dead-End.  */
-                    log(logmessage::fileio::ResolveVirtualNavigateDeadEnd(current.physical, virt, *it));
-                    break;
-                }
-                else
-                {
-                    nodes.push_back(nodes.back()->next.at(*it));
-                    log(logmessage::fileio::ResolveVirtualNavigateDown(current.physical, virt, *it));
-                }
+                log(logger, logmessage::fileio::ResolveVirtualFileNotFound(current.physical, virt));
             }
+            return res->second;
         }
+    }
+    auto res = resolve_virtual(logger, virt, current);
+    std::lock_guard lock(m_index_mutex);
+    m_index.emplace(virt, res);
+    return res;
+}
+std::optional<sqf::runtime::fileio::pathinfo> sqf::fileio::impl_default::resolve_virtual(Logger& logger, const std::string& virtFull, const sqf::runtime::fileio::pathinfo& current) const
+{
+    log(logger, logmessage::fileio::ResolveVirtualRequested(current.physical, virtFull));
 
-        
-        if (nodes.empty())
-        { /* Invalid path from our perspective. Return File-Not-Found. */
-
-            log(logmessage::fileio::ResolveVirtualFileNotFound(current.physical, virt));
-            return {};
-        }
-
-        // Set virtual to remaining and ensure no further dir-up occur
-        virt.clear();
-        for (; it != std::istream_iterator<StringDelimiter<'/'>>{}; ++it)
-        {
-            if (*it == ".."s) { /* skip dir-up */ continue; }
-            virt.append("/");
-            virt.append(*it);
+    // Explore the tree until we hit dead-end
+    const path_element* node = m_virtual_file_root.get();
+    std::string_view remainder = virtFull;
+    while (remainder.length() > 1)
+    {
+        auto end = remainder.find('/', 1);
+        auto segment = std::string(remainder.substr(1, end == std::string_view::npos ? std::string_view::npos : end - 1));
+        auto res = node->next.find(segment);
+        if (res == node->next.end())
+        { /* Dead-End.  */
+            log(logger, logmessage::fileio::ResolveVirtualNavigateDeadEnd(current.physical, virtFull, segment));
+            break;
         }
-        log(logmessage::fileio::ResolveVirtualGotRemainder(current.physical, virt));
+        node = res->second.get();
+        log(logger, logmessage::fileio::ResolveVirtualNavigateDown(current.physical, virtFull, segment));
+        remainder = end == std::string_view::npos ? std::string_view{} : remainder.substr(end);
     }
+    auto virt = std::string(remainder);
+    log(logger, logmessage::fileio::ResolveVirtualGotRemainder(current.physical, virt));
+
     // Check every physical path in current tree_element if the file exists
-    for (auto& phys : nodes.back()->physical)
+    for (auto& phys : node->physical)
     {
         auto tmp = phys.string() + virt;
         std::filesystem::path p(tmp);
-        log(logmessage::fileio::ResolveVirtualTestFileExists(current.physical, virt, p.string()));
+        log(logger, logmessage::fileio::ResolveVirtualTestFileExists(current.physical, virt, p.string()));
         if (file_exists(p))
         {
             auto actual = p.string();
-            log(logmessage::fileio::ResolveVirtualFileMatched(current.physical, virt, actual));
+            log(logger, logmessage::fileio::ResolveVirtualFileMatched(current.physical, virt, actual));
             return { { actual, virtFull } };
         }
     }
+    // Followed by the archives mounted there
+    for (auto& archive : node->archives)
+    {
+        log(logger, logmessage::fileio::ResolveVirtualTestFileExists(current.physical, virt, archive->physical()));
+        if (auto entry = archive->find(virt))
+        {
+            log(logger, logmessage::fileio::ResolveVirtualFileMatched(current.physical, virt, archive->physical()));
+            auto name = entry->name;
+            std::replace(name.begin(), name.end(), '\\', '/');
+            return { { archive->physical(), name, virtFull } };
+        }
+    }
 
-    log(logmessage::fileio::ResolveVirtualFileNotFound(current.physical, virt));
+    log(logger, logmessage::fileio::ResolveVirtualFileNotFound(current.physical, virt));
     // As we reached this, file-not-found
     return {};
 }
-std::optional<sqf::runtime::fileio::pathinfo> sqf::fileio::impl_default::get_info_physical(std::string_view viewVirtual, sqf::runtime::fileio::pathinfo current) const
+std::optional<sqf::runtime::fileio::pathinfo> sqf::fileio::impl_default::get_info_physical(Logger& logger, std::string_view viewVirtual, sqf::runtime::fileio::pathinfo current) const
 {
-    log(logmessage::fileio::ResolvePhysicalRequested(current.physical, current.virtual_, viewVirtual));
+    log(logger, logmessage::fileio::ResolvePhysicalRequested(current.physical, current.virtual_, viewVirtual));
 
     std::filesystem::path toFindPath(viewVirtual);
     toFindPath = toFindPath.lexically_normal();
     if (toFindPath.is_relative() || viewVirtual.size() > 3 && (viewVirtual.substr(0, 3) == "../"sv || viewVirtual.substr(0, 3) == "..\\"sv))
     {
-        if (std::filesystem::is_regular_file(current.physical))
+        auto archive = current.additional.empty() ? m_archives.end() : m_archives.find(current.physical);
+        if (archive != m_archives.end())
+        { // Relative to an entry of a mounted archive, which only exists virtually
+            auto relative = std::string(viewVirtual);
+            std::replace(relative.begin(), relative.end(), '\\', '/');
+            auto virt = normalize_virtual(archive->second->prefix() + "/" + std::filesystem::path(current.additional).parent_path().generic_string() + "/" + relative);
+            if (!virt.has_value())
+            {
+                log(logger, logmessage::fileio::ResolvePhysicalFailedToLookup(current.physical, current.virtual_, viewVirtual));
+                return {};
+            }
+            return get_info_virtual(logger, *virt, current);
+        }
+        // Paths resolved by us always refer to files, sparing the filesystem probe for includes of those.
+        if (!current.virtual_.empty() || std::filesystem::is_regular_file(current.physical))
         {
             auto tmp = std::filesystem::path(current.physical);
             auto tmp2 = tmp.parent_path();
@@ -173,23 +198,24 @@ std::optional<sqf::runtime::fileio::pathinfo> sqf::fileio::impl_default::get_inf
         }
         toFindPath = toFindPath.lexically_normal();
     }
-    log(logmessage::fileio::ResolvePhysicalAdjustedPath(current.physical, current.virtual_, viewVirtual));
+    log(logger, logmessage::fileio::ResolvePhysicalAdjustedPath(current.physical, current.virtual_, viewVirtual));
     for (auto& it : m_path_elements)
     {
         for (auto& phys : it->physical)
         {
-            log(logmessage::fileio::ResolvePhysicalTestingAgainst(current.physical, current.virtual_, phys.string()));
+            log(logger, logmessage::fileio::ResolvePhysicalTestingAgainst(current.physical, current.virtual_, phys.string()));
             auto pair = std::mismatch(phys.begin(), phys.end(), toFindPath.begin());
             auto rootEnd = std::get<0>(pair);
             auto nothing = std::get<0>(pair);
             if (rootEnd == phys.end() && !std::equal(phys.begin(), phys.end(), toFindPath.begin(), toFindPath.end()))
             {
-                log(logmessage::fileio::ResolvePhysicalMatched(current.physical, current.virtual_, phys.string()));
-                toFindPath = it->virtual_full + "/" + toFindPath.string().substr(phys.string().size() + 1);
-                toFindPath = toFindPath.lexically_normal();
-                auto toFindString = toFindPath.string();
-                std::replace(toFindString.begin(), toFindString.end(), '\\', '/');
-                auto res = get_info_virtual(toFindString, current);
+                log(logger, logmessage::fileio::ResolvePhysicalMatched(current.physical, current.virtual_, phys.string()));
+                auto virt = normalize_virtual(it->virtual_full + "/" + toFindPath.string().substr(phys.string().size() + 1));
+                if (!virt.has_value())
+                {
+                    continue;
+                }
+                auto res = get_info_virtual(logger, *virt, current);
                 if (res.has_value())
                 {
                     return res;
@@ -197,10 +223,48 @@ std::optional<sqf::runtime::fileio::pathinfo> sqf::fileio::impl_default::get_inf
             }
         }
     }
-    log(logmessage::fileio::ResolvePhysicalFailedToLookup(current.physical, current.virtual_, viewVirtual));
+    log(logger, logmessage::fileio::ResolvePhysicalFailedToLookup(current.physical, current.virtual_, viewVirtual));
     return {};
 }
 
+std::optional<sqf::runtime::fileio::pathinfo> sqf::fileio::impl_default::get_info(std::string_view view, sqf::runtime::fileio::pathinfo current, Logger& logger) const
+{
+    // Create & Cleanse stuff
+    auto virt = std::string(sqf::runtime::util::trim(view));
+    std::replace(virt.begin(), virt.end(), '\\', '/');
+    if (virt.empty())
+    {
+        log(logger, logmessage::fileio::ResolveVirtualFileNotFound(current.physical, virt));
+        return {};
+    }
+
+    // Resolve relative requests to an absolute virtual path first, so that all requests
+    // of the same file share one index entry, no matter which file they originate from.
+#if WIN32
+    bool relative = virt[0] != '/' && !(virt.length() >= 2 && virt[1] == ':');
+#else
+    bool relative = virt[0] != '/';
+#endif
+    std::optional<std::string> normalized;
+    if (!relative || current.virtual_.empty())
+    {
+        normalized = normalize_virtual(virt);
+    }
+    else if (is_virtual_directory(current.virtual_))
+    {
+        normalized = normalize_virtual(current.virtual_ + "/" + virt);
+    }
+    if (normalized.has_value())
+    {
+        auto res = get_info_virtual(logger, *normalized, current);
+        if (res.has_value())
+        {
+            return res;
+        }
+    }
+    return get_info_physical(logger, view, current);
+}
+
 void sqf::fileio::impl_default::add_mapping(std::string_view viewPhysical, std::string_view viewVirtual)
 {
     // Create & Cleanse stuff
@@ -208,12 +272,82 @@ void sqf::fileio::impl_default::add_mapping(std::string_view viewPhysical, std::
     std::replace(phys.begin(), phys.end(), '\\', '/');
     auto path_phys = std::filesystem::path(phys);
 
+    // Add physical path to final tree node
+    make_path_element(viewVirtual)->physical.push_back(std::filesystem::path(phys).lexically_normal());
+}
+std::shared_ptr<const sqf::fileio::pbo_archive> sqf::fileio::impl_default::mount_pbo(std::string_view viewPhysical)
+{
+    auto phys = std::filesystem::path(viewPhysical).lexically_normal().string();
+    auto archive = pbo_archive::open(phys);
+    if (!archive)
+    {
+        return {};
+    }
+    auto element = make_path_element(archive->prefix());
+    element->archives.push_back(archive);
+    m_archives[phys] = archive;
+    index_archives(*element);
+    return archive;
+}
+void sqf::fileio::impl_default::index_invalidate(std::string_view virtual_full)
+{
+    std::lock_guard lock(m_index_mutex);
+    if (virtual_full == "/"sv)
+    {
+        m_index.clear();
+        return;
+    }
+    for (auto it = m_index.begin(); it != m_index.end();)
+    {
+        auto& key = it->first;
+        if (key.length() >= virtual_full.length() && std::string_view(key).substr(0, virtual_full.length()) == virtual_full &&
+            (key.length() == virtual_full.length() || key[virtual_full.length()] == '/'))
+        {
+            it = m_index.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+void sqf::fileio::impl_default::index_archives(const path_element& element)
+{
+    if (!element.physical.empty())
+    { /* Physical paths take precedence and need probing. */
+        return;
+    }
+    auto base = element.virtual_full == "/"sv ? std::string{} : element.virtual_full;
+    std::lock_guard lock(m_index_mutex);
+    for (auto& archive : element.archives)
+    {
+        for (auto& entry : archive->entries())
+        {
+            auto name = entry.name;
+            std::replace(name.begin(), name.end(), '\\', '/');
+            auto first = name.substr(0, name.find('/'));
+            if (name.empty() || element.next.find(first) != element.next.end())
+            { /* Resolved by a deeper element. */
+                continue;
+            }
+            auto virt = normalize_virtual(base + "/" + name);
+            if (virt.has_value())
+            {
+                // Earlier archives take precedence, thus never replace.
+                m_index.try_emplace(*virt, sqf::runtime::fileio::pathinfo{ archive->physical(), name, *virt });
+            }
+        }
+    }
+}
+std::shared_ptr<sqf::fileio::impl_default::path_element> sqf::fileio::impl_default::make_path_element(std::string_view viewVirtual)
+{
     auto virt = std::string(viewVirtual);
     std::replace(virt.begin(), virt.end(), '\\', '/');
 
     // Iterate over the whole virtual path and add missing elements to the file_tree
     std::istringstream stream_virt(virt);
     std::shared_ptr<path_element> tree = m_virtual_file_root;
+    std::shared_ptr<path_element> first_created;
     std::vector<std::string> path_elements;
     for (auto it = std::istream_iterator<StringDelimiter<'/'>>{ stream_virt }; it != std::istream_iterator<StringDelimiter<'/'>>{}; ++it)
     {
@@ -230,19 +364,47 @@ void sqf::fileio::impl_default::add_mapping(std::string_view viewPhysical, std::
             tree = tree->next[*it] = std::make_shared<path_element>();
             tree->virtual_full = sstream.str();
             m_path_elements.push_back(tree);
+            if (!first_created)
+            {
+                first_created = tree;
+            }
         }
         else
         {
             tree = res->second;
         }
     }
-
-    // Add physical path to final tree node
-    tree->physical.push_back(std::filesystem::path(phys).lexically_normal());
+    // The new element shadows whatever its path resolved to before, the caller is about to change the element returned.
+    index_invalidate((first_created ? first_created : tree)->virtual_full);
+    return tree;
 }
 
+std::shared_ptr<const sqf::runtime::fileio::file_handle> sqf::fileio::impl_default::open_file_or_entry(const sqf::runtime::fileio::pathinfo& info) const
+{
+    if (info.additional.empty())
+    {
+        return sqf::runtime::fileio::open_file_from_disk(info.physical);
+    }
+    auto archive = m_archives.find(info.physical);
+    if (archive == m_archives.end())
+    {
+        return {};
+    }
+    auto entry = archive->second->find(info.additional);
+    return entry ? archive->second->read(*entry) : nullptr;
+}
 std::string sqf::fileio::impl_default::read_file(sqf::runtime::fileio::pathinfo info) const
 {
-    auto res = sqf::runtime::fileio::read_file_from_disk(info.physical);
-    return *res;
+    if (info.additional.empty())
+    {
+        auto res = sqf::runtime::fileio::read_file_from_disk(info.physical);
+        return *res;
+    }
+    auto res = open_file_or_entry(info);
+    return res ? std::string(res->contents()) : std::string{};
+}
+std::shared_ptr<const sqf::runtime::fileio::file_handle> sqf::fileio::impl_default::open_file(sqf::runtime::fileio::pathinfo info) const
+{
+    auto res = open_file_or_entry(info);
+    return res ? res : std::make_shared<const file_handle>(std::string{});
 }
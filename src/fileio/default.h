@@ -1,8 +1,10 @@
 #pragma once
 #include "../runtime/fileio.h"
 #include "../runtime/logging.h"
+#include "pbo.h"
 #include <unordered_map>
 #include <filesystem>
+#include <mutex>
 #include <string>
 #include <vector>
 #include <memory>
@@ -16,13 +18,56 @@ namespace sqf::fileio
         {
             std::unordered_map<std::string, std::shared_ptr<path_element>> next;
             std::vector<std::filesystem::path> physical;
+            // Archives mounted at this path, searched after the physical paths.
+            std::vector<std::shared_ptr<const pbo_archive>> archives;
             std::string virtual_full;
         };
         std::shared_ptr<path_element> m_virtual_file_root;
         using file_tree_iterator = std::unordered_map<std::string, std::shared_ptr<path_element>>::iterator;
 
         std::vector<std::shared_ptr<path_element>> m_path_elements;
+        // Mounted archives by their physical path, as referred to by pathinfo::physical.
+        std::unordered_map<std::string, std::shared_ptr<const pbo_archive>> m_archives;
 
+        /// <summary>
+        /// Returns the element of the provided virtual path, creating all missing elements.
+        /// Drops the index entries below the first element created (or the element returned),
+        /// as the caller is about to change the mappings there.
+        /// </summary>
+        std::shared_ptr<path_element> make_path_element(std::string_view viewVirtual);
+        /// <summary>
+        /// Opens the file provided, which may be an entry of a mounted archive.
+        /// </summary>
+        /// <returns>The file handle or nullptr if the file could not be opened.</returns>
+        std::shared_ptr<const file_handle> open_file_or_entry(const sqf::runtime::fileio::pathinfo& info) const;
+
+        // Resolved files (misses included) by their normalized absolute virtual path, shared by every request
+        // resolving to that path, no matter which file it originates from. Entries of mounted archives are added
+        // when mounting, files of physical mappings once they got requested.
+        // Changing the mappings below a virtual path only drops the entries below it.
+        // Files created or removed on disk after they got looked up are not noticed.
+        mutable std::mutex m_index_mutex;
+        mutable std::unordered_map<std::string, std::optional<sqf::runtime::fileio::pathinfo>> m_index;
+        /// <summary>
+        /// Drops all index entries at or below the provided virtual path.
+        /// </summary>
+        void index_invalidate(std::string_view virtual_full);
+        /// <summary>
+        /// Adds the entries of the archives mounted at the provided element to the index,
+        /// unless they would be shadowed by physical paths or deeper elements.
+        /// </summary>
+        void index_archives(const path_element& element);
+
+        /// <summary>
+        /// Normalizes the provided virtual path: '\' becomes '/', empty and '.' segments are removed
+        /// and '..' segments are applied. Relative paths are treated as relative to the root.
+        /// </summary>
+        /// <returns>The absolute path (eg. "/x/cba/file.hpp") or empty optional if '..' leaves the root.</returns>
+        static std::optional<std::string> normalize_virtual(std::string_view view);
+        /// <summary>
+        /// Whether the provided virtual path exists as element, allowing to resolve requests relative to it.
+        /// </summary>
+        bool is_virtual_directory(std::string_view view) const;
 
         void get_directories_recursive(std::vector<std::string>& paths, const std::shared_ptr<path_element>& el) const
         {
@@ -36,19 +81,31 @@ namespace sqf::fileio
             }
         }
         /// <summary>
-        /// Attempts to interpret the view provided as virtual path.
+        /// Resolves the provided normalized absolute virtual path, using the index if possible.
         /// </summary>
-        /// <param name="view">The path to lookup as string_view.</param>
-        /// <param name="current">The current pathinfo as available</param>
+        /// <param name="virt">The path to lookup, as returned by normalize_virtual.</param>
+        /// <param name="current">The current pathinfo as available, only used for diagnostics.</param>
         /// <returns>empty optional on filenotfound or the pathinfo to the actual file.</returns>
-        std::optional<sqf::runtime::fileio::pathinfo> get_info_virtual(std::string_view view, sqf::runtime::fileio::pathinfo current) const;
+        std::optional<sqf::runtime::fileio::pathinfo> get_info_virtual(Logger& logger, const std::string& virt, const sqf::runtime::fileio::pathinfo& current) const;
+        /// <summary>
+        /// Walks the mapping tree along the provided normalized absolute virtual path and probes the files found there.
+        /// </summary>
+        std::optional<sqf::runtime::fileio::pathinfo> resolve_virtual(Logger& logger, const std::string& virt, const sqf::runtime::fileio::pathinfo& current) const;
         /// <summary>
         /// Attempts to interpret the view provided as physical path.
         /// </summary>
         /// <param name="view">The path to lookup as string_view.</param>
         /// <param name="current">The current pathinfo as available</param>
         /// <returns>empty optional on filenotfound or the pathinfo to the actual file.</returns>
-        std::optional<sqf::runtime::fileio::pathinfo> get_info_physical(std::string_view view, sqf::runtime::fileio::pathinfo current) const;
+        std::optional<sqf::runtime::fileio::pathinfo> get_info_physical(Logger& logger, std::string_view view, sqf::runtime::fileio::pathinfo current) const;
+
+        static void log(Logger& logger, LogMessageBase&& message)
+        {
+            if (logger.isEnabled(message.getLevel()))
+            {
+                logger.log(message);
+            }
+        }
     public:
         impl_default(Logger& logger) : CanLog(logger),
             m_virtual_file_root(std::make_shared<path_element>()),
@@ -59,16 +116,18 @@ namespace sqf::fileio
         }
 #pragma region sqf::runtime::fileio
         virtual std::optional<sqf::runtime::fileio::pathinfo> get_info(std::string_view view, sqf::runtime::fileio::pathinfo current) const override
-        {
-            auto res =  get_info_virtual(view, current);
-            if (!res.has_value())
-            {
-                return get_info_physical(view, current);
-            }
-            return res;
-        }
+        { return get_info(view, std::move(current), get_logger()); }
+        virtual std::optional<sqf::runtime::fileio::pathinfo> get_info(std::string_view view, sqf::runtime::fileio::pathinfo current, Logger& logger) const override;
         virtual void add_mapping(std::string_view viewPhysical, std::string_view viewVirtual) override;
+        /// <summary>
+        /// Mounts the PBO archive at the provided physical path onto its prefix.
+        /// Files inside are reported with the archive as physical and the entry name as additional path.
+        /// </summary>
+        /// <param name="viewPhysical">Physical path of the archive.</param>
+        /// <returns>The archive mounted or nullptr if it could not be opened.</returns>
+        std::shared_ptr<const pbo_archive> mount_pbo(std::string_view viewPhysical);
         virtual std::string read_file(sqf::runtime::fileio::pathinfo info) const override;
+        virtual std::shared_ptr<const file_handle> open_file(sqf::runtime::fileio::pathinfo info) const override;
         virtual std::vector<std::string> get_directories() const override
         {
             std::vector<std::string> paths;
@@ -0,0 +1,245 @@
+#include "pbo.h"
+#include "../runtime/util.h"
+
+#include <algorithm>
+#include <cctype>
+#include <filesystem>
+
+namespace
+{
+    // Packing methods, stored as four characters in reverse order (eg. "sreV" for 'Vers').
+    constexpr uint32_t method_version = 0x56657273;
+    constexpr uint32_t method_compressed = 0x43707273;
+    constexpr uint32_t method_encrypted = 0x456E6372;
+}
+
+bool sqf::fileio::pbo_archive::read_header(std::string_view data)
+{
+    size_t pos = 0;
+    auto read_string = [&](std::string& out) -> bool {
+        auto end = data.find('\0', pos);
+        if (end == std::string_view::npos)
+        {
+            return false;
+        }
+        out = data.substr(pos, end - pos);
+        pos = end + 1;
+        return true;
+    };
+    auto read_uint32 = [&](uint32_t& out) -> bool {
+        if (data.length() - pos < 4)
+        {
+            return false;
+        }
+        auto bytes = reinterpret_cast<const unsigned char*>(data.data() + pos);
+        out = static_cast<uint32_t>(bytes[0]) | (static_cast<uint32_t>(bytes[1]) << 8) |
+            (static_cast<uint32_t>(bytes[2]) << 16) | (static_cast<uint32_t>(bytes[3]) << 24);
+        pos += 4;
+        return true;
+    };
+
+    bool first = true;
+    while (true)
+    {
+        entry e{};
+        uint32_t method, reserved, timestamp;
+        if (!read_string(e.name) || !read_uint32(method) || !read_uint32(e.original_size) ||
+            !read_uint32(reserved) || !read_uint32(timestamp) || !read_uint32(e.data_size))
+        {
+            return false;
+        }
+        switch (method)
+        {
+        case method_version: e.method = packing::version; break;
+        case method_compressed: e.method = packing::compressed; break;
+        case method_encrypted: e.method = packing::encrypted; break;
+        default: e.method = packing::none; break;
+        }
+        if (first && e.name.empty() && e.method == packing::version)
+        { // Properties, terminated by an empty key. Missing in eg. PBOs exported by 3DEN.
+            first = false;
+            std::string key;
+            while (read_string(key) && !key.empty())
+            {
+                std::string value;
+                if (!read_string(value))
+                {
+                    return false;
+                }
+                m_properties.emplace_back(std::move(key), std::move(value));
+            }
+            continue;
+        }
+        first = false;
+        if (e.name.empty())
+        { // Terminating entry
+            break;
+        }
+        m_entries.push_back(std::move(e));
+    }
+
+    // Data of all entries follows the header in the same order.
+    size_t offset = pos;
+    for (size_t i = 0; i < m_entries.size(); i++)
+    {
+        auto& e = m_entries[i];
+        e.offset = offset;
+        if (data.length() - offset < e.data_size)
+        {
+            return false;
+        }
+        offset += e.data_size;
+        m_index.emplace(normalize(e.name), i);
+    }
+    return true;
+}
+
+std::shared_ptr<const sqf::fileio::pbo_archive> sqf::fileio::pbo_archive::open(std::string_view physical_path)
+{
+    auto mapping = ::sqf::runtime::fileio::file_handle::map(physical_path, false);
+    if (!mapping)
+    {
+        return {};
+    }
+    std::shared_ptr<pbo_archive> archive(new pbo_archive());
+    archive->m_physical = std::string(physical_path);
+    archive->m_mapping = std::move(mapping);
+    if (!archive->read_header(archive->m_mapping->contents()))
+    {
+        return {};
+    }
+
+    std::string prefix;
+    auto property = std::find_if(archive->m_properties.begin(), archive->m_properties.end(),
+        [](const std::pair<std::string, std::string>& it) { return normalize(it.first) == "prefix"; });
+    if (property != archive->m_properties.end())
+    {
+        prefix = property->second;
+    }
+    else if (auto e = archive->find("$PBOPREFIX$"))
+    {
+        auto contents = archive->read(*e);
+        if (contents)
+        {
+            auto view = contents->contents();
+            prefix = view.substr(0, view.find_first_of("\r\n"));
+        }
+    }
+    else
+    {
+        prefix = std::filesystem::path(archive->m_physical).stem().string();
+    }
+    std::replace(prefix.begin(), prefix.end(), '\\', '/');
+    archive->m_prefix = std::string(::sqf::runtime::util::trim(prefix, " \t/"));
+    return archive;
+}
+
+std::string sqf::fileio::pbo_archive::normalize(std::string_view name)
+{
+    auto start = name.find_first_not_of("\\/");
+    std::string res(start == std::string_view::npos ? std::string_view{} : name.substr(start));
+    std::transform(res.begin(), res.end(), res.begin(), [](char c) -> char {
+        return c == '\\' ? '/' : static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    });
+    return res;
+}
+
+std::optional<std::string> sqf::fileio::pbo_archive::lzss_decompress(std::string_view input, size_t size)
+{
+    // Each flag byte is followed by eight items, a set bit denoting a literal byte and a cleared bit a
+    // back reference of two bytes: 12 bits of distance and 4 bits of length - 3. References reaching
+    // before the start of the output yield spaces. The trailing checksum is not validated.
+    std::string output;
+    output.reserve(size);
+    size_t pos = 0;
+    while (output.size() < size)
+    {
+        if (pos >= input.length())
+        {
+            return {};
+        }
+        auto flags = static_cast<unsigned char>(input[pos++]);
+        for (size_t bit = 0; bit < 8 && output.size() < size; bit++, flags >>= 1)
+        {
+            if (flags & 1)
+            {
+                if (pos >= input.length())
+                {
+                    return {};
+                }
+                output.push_back(input[pos++]);
+                continue;
+            }
+            if (input.length() - pos < 2)
+            {
+                return {};
+            }
+            auto low = static_cast<unsigned char>(input[pos]);
+            auto high = static_cast<unsigned char>(input[pos + 1]);
+            pos += 2;
+            auto distance = static_cast<size_t>(low) | (static_cast<size_t>(high & 0xF0) << 4);
+            auto length = std::min<size_t>((high & 0x0F) + 3, size - output.size());
+            if (distance == 0)
+            {
+                return {};
+            }
+            auto from = static_cast<ptrdiff_t>(output.size()) - static_cast<ptrdiff_t>(distance);
+            for (size_t i = 0; i < length; i++, from++)
+            {
+                output.push_back(from < 0 ? ' ' : output[static_cast<size_t>(from)]);
+            }
+        }
+    }
+    return output;
+}
+
+const sqf::fileio::pbo_archive::entry* sqf::fileio::pbo_archive::find(std::string_view name) const
+{
+    auto res = m_index.find(normalize(name));
+    return res == m_index.end() ? nullptr : &m_entries[res->second];
+}
+
+std::shared_ptr<const sqf::runtime::fileio::file_handle> sqf::fileio::pbo_archive::read(const entry& e) const
+{
+    auto data = m_mapping->contents().substr(e.offset, e.data_size);
+    switch (e.method)
+    {
+    case packing::none:
+    case packing::version:
+        return std::make_shared<const ::sqf::runtime::fileio::file_handle>(m_mapping, data);
+    case packing::encrypted:
+        return {};
+    case packing::compressed:
+        break;
+    }
+
+    auto index = static_cast<size_t>(&e - m_entries.data());
+    {
+        std::lock_guard lock(m_decoded_mutex);
+        auto res = m_decoded.find(index);
+        if (res != m_decoded.end())
+        {
+            return res->second;
+        }
+    }
+    auto decompressed = lzss_decompress(data, e.original_size);
+    if (!decompressed.has_value())
+    {
+        return {};
+    }
+    auto buffer = std::make_shared<const std::string>(std::move(*decompressed));
+    auto handle = std::make_shared<const ::sqf::runtime::fileio::file_handle>(buffer, *buffer);
+
+    std::lock_guard lock(m_decoded_mutex);
+    if (m_decoded_size + buffer->size() > decoded_cache_limit)
+    {
+        m_decoded.clear();
+        m_decoded_size = 0;
+    }
+    auto res = m_decoded.emplace(index, handle);
+    if (res.second)
+    {
+        m_decoded_size += buffer->size();
+    }
+    return res.first->second;
+}
@@ -0,0 +1,109 @@
+#pragma once
+#include "../runtime/fileio.h"
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace sqf::fileio
+{
+    /// <summary>
+    /// Read-only PBO archive. Only the header is parsed when opening,
+    /// entries are served on demand from the memory mapped archive.
+    /// </summary>
+    /// <remarks>
+    /// Uncompressed entries refer to the mapping without copying.
+    /// Compressed entries get decompressed once and are kept until the cache exceeds decoded_cache_limit.
+    /// Safe to read from multiple threads at once.
+    /// </remarks>
+    class pbo_archive
+    {
+    public:
+        enum class packing
+        {
+            none,
+            compressed,
+            encrypted,
+            version
+        };
+        struct entry
+        {
+            /// <summary>
+            /// The name as stored in the archive, usually separated using '\'.
+            /// </summary>
+            std::string name;
+            packing method;
+            uint32_t original_size;
+            uint32_t data_size;
+            /// <summary>
+            /// Offset of the data inside of the archive.
+            /// </summary>
+            size_t offset;
+        };
+        /// <summary>
+        /// Upper bound of decompressed bytes kept by an archive.
+        /// </summary>
+        static constexpr size_t decoded_cache_limit = 64 * 1024 * 1024;
+    private:
+        std::string m_physical;
+        std::string m_prefix;
+        std::shared_ptr<const ::sqf::runtime::fileio::file_handle> m_mapping;
+        std::vector<std::pair<std::string, std::string>> m_properties;
+        std::vector<entry> m_entries;
+        // normalize(entry.name) -> index into m_entries
+        std::unordered_map<std::string, size_t> m_index;
+
+        mutable std::mutex m_decoded_mutex;
+        mutable std::unordered_map<size_t, std::shared_ptr<const ::sqf::runtime::fileio::file_handle>> m_decoded;
+        mutable size_t m_decoded_size = 0;
+
+        pbo_archive() = default;
+        bool read_header(std::string_view data);
+    public:
+        /// <summary>
+        /// Opens the archive at the provided path and parses its header.
+        /// </summary>
+        /// <returns>The archive or nullptr if the file could not be opened or is no valid PBO.</returns>
+        static std::shared_ptr<const pbo_archive> open(std::string_view physical_path);
+
+        /// <summary>
+        /// Normalizes an entry name or path for lookups: '\' becomes '/',
+        /// leading separators are removed and all characters are lowercased.
+        /// </summary>
+        static std::string normalize(std::string_view name);
+
+        /// <summary>
+        /// Decompresses the LZSS compressed data of an entry.
+        /// </summary>
+        /// <param name="input">The compressed data, optionally followed by its checksum.</param>
+        /// <param name="size">The size of the decompressed data.</param>
+        /// <returns>The decompressed data or an empty optional if input is malformed.</returns>
+        static std::optional<std::string> lzss_decompress(std::string_view input, size_t size);
+
+        const std::string& physical() const { return m_physical; }
+        /// <summary>
+        /// The virtual path the archive is mounted at, taken from the 'prefix' property,
+        /// a $PBOPREFIX$ entry or the name of the archive (in that order). Separated using '/'.
+        /// </summary>
+        const std::string& prefix() const { return m_prefix; }
+        const std::vector<std::pair<std::string, std::string>>& properties() const { return m_properties; }
+        const std::vector<entry>& entries() const { return m_entries; }
+
+        /// <summary>
+        /// Finds an entry by its name, ignoring case and the kind of separator used.
+        /// </summary>
+        /// <returns>The entry or nullptr if the archive contains no such entry.</returns>
+        const entry* find(std::string_view name) const;
+
+        /// <summary>
+        /// Reads the contents of the provided entry of this archive.
+        /// </summary>
+        /// <returns>The contents or nullptr if the entry is encrypted or malformed.</returns>
+        std::shared_ptr<const ::sqf::runtime::fileio::file_handle> read(const entry& e) const;
+    };
+}
@@ -0,0 +1,539 @@
+#include "bytecode.h"
+#include "common.h"
+#include "../runtime/d_array.h"
+#include "../runtime/d_string.h"
+#include "../runtime/d_scalar.h"
+#include "../runtime/d_boolean.h"
+#include "../runtime/d_code.h"
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <utility>
+
+namespace
+{
+    // Binary layout (native endianness, every section is an array of fixed-size records):
+    //   header:    char[4] magic, uint32 version, uint32 strings, uint32 string_bytes, uint32 constants, uint32 sources, uint32 debug, uint32 code, uint32 entry_start, uint32 entry_size
+    //   strings:   uint32[strings + 1] offsets into string data, char[string_bytes] string data
+    //   constants: constants * constant_record
+    //   sources:   sources * source_record
+    //   debug:     debug * debug_record
+    //   code:      code * code_record
+    // Code blocks are contiguous ranges of code records; the entry range is the top-level instruction_set.
+    // Code segments are not stored, but recreated from the source contents when needed.
+    // As all sections are plain records, a module can be read using a handful of bulk reads or mapped into memory.
+    const char module_magic[4] = { 'S', 'Q', 'F', 'C' };
+    const uint32_t no_debug_info = ~static_cast<uint32_t>(0);
+    const uint32_t no_source = ~static_cast<uint32_t>(0);
+
+    enum class opcode : uint8_t
+    {
+        end_statement,
+        push,
+        make_array,
+        get_variable,
+        assign_to,
+        assign_to_local,
+        call_nular,
+        call_unary,
+        call_binary
+    };
+    enum class constant_tag : uint8_t
+    {
+        nil,
+        scalar,
+        boolean,
+        string,
+        array,
+        code
+    };
+
+#pragma pack(push, 1)
+    struct header_record
+    {
+        char magic[4];
+        uint32_t version;
+        uint32_t strings;
+        uint32_t string_bytes;
+        uint32_t constants;
+        uint32_t sources;
+        uint32_t debug;
+        uint32_t code;
+        uint32_t entry_start;
+        uint32_t entry_size;
+    };
+    struct constant_record
+    {
+        constant_tag tag;
+        uint8_t padding[3];
+        // scalar: float bits, boolean: 0 or 1, string: string index, array: first element constant, code: first code record
+        uint32_t a;
+        // array: element count, code: code record count
+        uint32_t b;
+    };
+    struct source_record
+    {
+        uint32_t physical;
+        uint32_t additional;
+        uint32_t virtual_;
+        uint32_t contents;
+    };
+    struct debug_record
+    {
+        uint32_t source;
+        uint32_t line;
+        uint32_t column;
+        uint32_t offset;
+        uint32_t length;
+    };
+    struct code_record
+    {
+        opcode code;
+        uint8_t padding;
+        // call_binary: precedence of the operator
+        int16_t precedence;
+        // push: constant index, make_array: element count, others: string index
+        uint32_t operand;
+        uint32_t debug;
+    };
+#pragma pack(pop)
+
+    template<typename T>
+    bool read_records(std::istream& in, std::vector<T>& out, uint32_t count)
+    {
+        out.resize(count);
+        in.read(reinterpret_cast<char*>(out.data()), sizeof(T) * count);
+        return !in.fail();
+    }
+    template<typename T>
+    void write_records(std::ostream& out, const std::vector<T>& in)
+    {
+        out.write(reinterpret_cast<const char*>(in.data()), sizeof(T) * in.size());
+    }
+
+    class writer
+    {
+        std::unordered_map<std::string, uint32_t> m_string_lookup;
+        std::vector<uint32_t> m_string_offsets = { 0 };
+        std::string m_string_data;
+        std::vector<constant_record> m_constants;
+        std::unordered_map<const sqf::runtime::diagnostics::source_file*, uint32_t> m_source_lookup;
+        std::vector<source_record> m_sources;
+        std::vector<debug_record> m_debug;
+        std::vector<code_record> m_code;
+
+        uint32_t string_index(std::string_view str)
+        {
+            auto res = m_string_lookup.find(std::string(str));
+            if (res != m_string_lookup.end())
+            {
+                return res->second;
+            }
+            auto index = static_cast<uint32_t>(m_string_offsets.size() - 1);
+            m_string_data.append(str);
+            m_string_offsets.push_back(static_cast<uint32_t>(m_string_data.size()));
+            m_string_lookup.emplace(std::string(str), index);
+            return index;
+        }
+        uint32_t source_index(const std::shared_ptr<const sqf::runtime::diagnostics::source_file>& source)
+        {
+            if (!source)
+            {
+                return no_source;
+            }
+            auto res = m_source_lookup.find(source.get());
+            if (res != m_source_lookup.end())
+            {
+                return res->second;
+            }
+            m_sources.push_back({
+                string_index(source->path().physical),
+                string_index(source->path().additional),
+                string_index(source->path().virtual_),
+                string_index(source->contents()) });
+            auto index = static_cast<uint32_t>(m_sources.size() - 1);
+            m_source_lookup.emplace(source.get(), index);
+            return index;
+        }
+        uint32_t debug_index(const sqf::runtime::diagnostics::source_location& location)
+        {
+            m_debug.push_back({
+                source_index(location.source),
+                location.line,
+                location.column,
+                location.offset,
+                location.length });
+            return static_cast<uint32_t>(m_debug.size() - 1);
+        }
+        std::optional<constant_record> constant(const sqf::runtime::value& val)
+        {
+            constant_record record = {};
+            if (val.empty())
+            {
+                record.tag = constant_tag::nil;
+            }
+            else if (val.is<sqf::runtime::t_scalar>())
+            {
+                float f = val.data<sqf::types::d_scalar, float>();
+                record.tag = constant_tag::scalar;
+                std::memcpy(&record.a, &f, sizeof(float));
+            }
+            else if (val.is<sqf::runtime::t_boolean>())
+            {
+                record.tag = constant_tag::boolean;
+                record.a = val.data<sqf::types::d_boolean, bool>() ? 1 : 0;
+            }
+            else if (val.is<sqf::runtime::t_string>())
+            {
+                record.tag = constant_tag::string;
+                record.a = string_index(val.data<sqf::types::d_string, std::string>());
+            }
+            else if (val.is<sqf::runtime::t_array>())
+            {
+                auto arr = val.data<sqf::types::d_array>();
+                std::vector<constant_record> elements;
+                for (auto& it : *arr)
+                {
+                    auto element = constant(it);
+                    if (!element.has_value()) { return {}; }
+                    elements.push_back(*element);
+                }
+                record.tag = constant_tag::array;
+                record.a = static_cast<uint32_t>(m_constants.size());
+                record.b = static_cast<uint32_t>(elements.size());
+                m_constants.insert(m_constants.end(), elements.begin(), elements.end());
+            }
+            else if (val.is<sqf::runtime::t_code>())
+            {
+                auto range = write_set(val.data<sqf::types::d_code>()->value());
+                if (!range.has_value()) { return {}; }
+                record.tag = constant_tag::code;
+                record.a = range->first;
+                record.b = range->second;
+            }
+            else
+            {
+                return {};
+            }
+            return record;
+        }
+        bool write_instruction(const sqf::runtime::instruction& inst, size_t index)
+        {
+            code_record record = {};
+            if (dynamic_cast<const sqf::opcodes::end_statement*>(&inst))
+            {
+                record.code = opcode::end_statement;
+            }
+            else if (auto push = dynamic_cast<const sqf::opcodes::push*>(&inst))
+            {
+                auto res = constant(push->value());
+                if (!res.has_value()) { return false; }
+                m_constants.push_back(*res);
+                record.code = opcode::push;
+                record.operand = static_cast<uint32_t>(m_constants.size() - 1);
+            }
+            else if (auto make_array = dynamic_cast<const sqf::opcodes::make_array*>(&inst))
+            {
+                record.code = opcode::make_array;
+                record.operand = static_cast<uint32_t>(make_array->array_size());
+            }
+            else if (auto get_variable = dynamic_cast<const sqf::opcodes::get_variable*>(&inst))
+            {
+                record.code = opcode::get_variable;
+                record.operand = string_index(get_variable->variable_name());
+            }
+            else if (auto assign_to = dynamic_cast<const sqf::opcodes::assign_to*>(&inst))
+            {
+                record.code = opcode::assign_to;
+                record.operand = string_index(assign_to->variable_name());
+            }
+            else if (auto assign_to_local = dynamic_cast<const sqf::opcodes::assign_to_local*>(&inst))
+            {
+                record.code = opcode::assign_to_local;
+                record.operand = string_index(assign_to_local->variable_name());
+            }
+            else if (auto call_nular = dynamic_cast<const sqf::opcodes::call_nular*>(&inst))
+            {
+                record.code = opcode::call_nular;
+                record.operand = string_index(call_nular->operator_name());
+            }
+            else if (auto call_unary = dynamic_cast<const sqf::opcodes::call_unary*>(&inst))
+            {
+                record.code = opcode::call_unary;
+                record.operand = string_index(call_unary->operator_name());
+            }
+            else if (auto call_binary = dynamic_cast<const sqf::opcodes::call_binary*>(&inst))
+            {
+                record.code = opcode::call_binary;
+                record.precedence = call_binary->precedence();
+                record.operand = string_index(call_binary->operator_name());
+            }
+            else
+            {
+                return false;
+            }
+            record.debug = debug_index(inst.location());
+            m_code[index] = record;
+            return true;
+        }
+    public:
+        // Reserves a contiguous range for the set first, so that nested code blocks get appended behind it.
+        std::optional<std::pair<uint32_t, uint32_t>> write_set(const sqf::runtime::instruction_set& set)
+        {
+            auto start = m_code.size();
+            m_code.resize(start + set.size());
+            size_t index = start;
+            for (auto& inst : set)
+            {
+                if (!write_instruction(*inst, index++)) { return {}; }
+            }
+            return std::make_pair(static_cast<uint32_t>(start), static_cast<uint32_t>(set.size()));
+        }
+        void flush(std::ostream& out, std::pair<uint32_t, uint32_t> entry)
+        {
+            header_record header = {};
+            std::memcpy(header.magic, module_magic, sizeof(module_magic));
+            header.version = sqf::opcodes::bytecode::version;
+            header.strings = static_cast<uint32_t>(m_string_offsets.size() - 1);
+            header.string_bytes = static_cast<uint32_t>(m_string_data.size());
+            header.constants = static_cast<uint32_t>(m_constants.size());
+            header.sources = static_cast<uint32_t>(m_sources.size());
+            header.debug = static_cast<uint32_t>(m_debug.size());
+            header.code = static_cast<uint32_t>(m_code.size());
+            header.entry_start = entry.first;
+            header.entry_size = entry.second;
+            out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            write_records(out, m_string_offsets);
+            out.write(m_string_data.data(), m_string_data.size());
+            write_records(out, m_constants);
+            write_records(out, m_sources);
+            write_records(out, m_debug);
+            write_records(out, m_code);
+        }
+    };
+
+    class reader
+    {
+        header_record m_header;
+        std::vector<uint32_t> m_string_offsets;
+        std::string m_string_data;
+        std::vector<constant_record> m_constants;
+        std::vector<source_record> m_source_records;
+        std::vector<debug_record> m_debug;
+        std::vector<code_record> m_code;
+        // Created on first use, so that all instructions of a source share the same source_file.
+        mutable std::vector<std::shared_ptr<const sqf::runtime::diagnostics::source_file>> m_sources;
+        mutable std::unordered_map<uint32_t, std::shared_ptr<const std::string>> m_contents;
+
+        bool string_at(uint32_t index, std::string& out) const
+        {
+            if (index >= m_header.strings) { return false; }
+            auto begin = m_string_offsets[index];
+            auto end = m_string_offsets[index + 1];
+            if (begin > end || end > m_string_data.size()) { return false; }
+            out.assign(m_string_data.data() + begin, end - begin);
+            return true;
+        }
+        bool source_at(uint32_t index, std::shared_ptr<const sqf::runtime::diagnostics::source_file>& source) const
+        {
+            if (index == no_source) { return true; }
+            if (index >= m_source_records.size()) { return false; }
+            if (!m_sources[index])
+            {
+                auto& record = m_source_records[index];
+                sqf::runtime::fileio::pathinfo path;
+                if (!string_at(record.physical, path.physical) ||
+                    !string_at(record.additional, path.additional) ||
+                    !string_at(record.virtual_, path.virtual_))
+                {
+                    return false;
+                }
+                auto& contents = m_contents[record.contents];
+                if (!contents)
+                {
+                    std::string str;
+                    if (!string_at(record.contents, str)) { return false; }
+                    contents = std::make_shared<const std::string>(std::move(str));
+                }
+                m_sources[index] = std::make_shared<sqf::runtime::diagnostics::source_file>(path, contents);
+            }
+            source = m_sources[index];
+            return true;
+        }
+        bool debug_at(uint32_t index, sqf::runtime::diagnostics::source_location& location) const
+        {
+            if (index == no_debug_info) { return true; }
+            if (index >= m_debug.size()) { return false; }
+            auto& record = m_debug[index];
+            location.line = record.line;
+            location.column = record.column;
+            location.offset = record.offset;
+            location.length = record.length;
+            return source_at(record.source, location.source);
+        }
+        bool constant_at(uint32_t index, sqf::runtime::value& val, size_t depth) const
+        {
+            if (index >= m_constants.size() || depth > m_constants.size()) { return false; }
+            auto& record = m_constants[index];
+            switch (record.tag)
+            {
+            case constant_tag::nil:
+                val = {};
+                return true;
+            case constant_tag::scalar:
+            {
+                float f;
+                std::memcpy(&f, &record.a, sizeof(float));
+                val = f;
+                return true;
+            }
+            case constant_tag::boolean:
+                val = record.a != 0;
+                return true;
+            case constant_tag::string:
+            {
+                std::string str;
+                if (!string_at(record.a, str)) { return false; }
+                val = std::make_shared<sqf::types::d_string>(str);
+                return true;
+            }
+            case constant_tag::array:
+            {
+                if (static_cast<uint64_t>(record.a) + record.b > m_constants.size()) { return false; }
+                std::vector<sqf::runtime::value> arr(record.b);
+                for (uint32_t i = 0; i < record.b; i++)
+                {
+                    if (!constant_at(record.a + i, arr[i], depth + 1)) { return false; }
+                }
+                val = arr;
+                return true;
+            }
+            case constant_tag::code:
+            {
+                auto set = set_at(record.a, record.b, depth + 1);
+                if (!set.has_value()) { return false; }
+                val = std::make_shared<sqf::types::d_code>(*set);
+                return true;
+            }
+            default:
+                return false;
+            }
+        }
+        sqf::runtime::instruction::sptr instruction_at(uint32_t index, size_t depth) const
+        {
+            auto& record = m_code[index];
+            sqf::runtime::instruction::sptr inst;
+            std::string name;
+            switch (record.code)
+            {
+            case opcode::end_statement:
+                inst = std::make_shared<sqf::opcodes::end_statement>();
+                break;
+            case opcode::push:
+            {
+                sqf::runtime::value val;
+                if (!constant_at(record.operand, val, depth)) { return {}; }
+                inst = std::make_shared<sqf::opcodes::push>(val);
+            } break;
+            case opcode::make_array:
+                inst = std::make_shared<sqf::opcodes::make_array>(record.operand);
+                break;
+            case opcode::get_variable:
+                if (!string_at(record.operand, name)) { return {}; }
+                inst = std::make_shared<sqf::opcodes::get_variable>(name);
+                break;
+            case opcode::assign_to:
+                if (!string_at(record.operand, name)) { return {}; }
+                inst = std::make_shared<sqf::opcodes::assign_to>(name);
+                break;
+            case opcode::assign_to_local:
+                if (!string_at(record.operand, name)) { return {}; }
+                inst = std::make_shared<sqf::opcodes::assign_to_local>(name);
+                break;
+            case opcode::call_nular:
+                if (!string_at(record.operand, name)) { return {}; }
+                inst = std::make_shared<sqf::opcodes::call_nular>(name);
+                break;
+            case opcode::call_unary:
+                if (!string_at(record.operand, name)) { return {}; }
+                inst = std::make_shared<sqf::opcodes::call_unary>(name);
+                break;
+            case opcode::call_binary:
+                if (!string_at(record.operand, name)) { return {}; }
+                inst = std::make_shared<sqf::opcodes::call_binary>(name, record.precedence);
+                break;
+            default:
+                return {};
+            }
+            sqf::runtime::diagnostics::source_location location;
+            if (!debug_at(record.debug, location)) { return {}; }
+            inst->location(std::move(location));
+            return inst;
+        }
+        std::optional<sqf::runtime::instruction_set> set_at(uint32_t start, uint32_t size, size_t depth) const
+        {
+            if (static_cast<uint64_t>(start) + size > m_code.size() || depth > m_code.size()) { return {}; }
+            std::vector<sqf::runtime::instruction::sptr> instructions;
+            instructions.reserve(size);
+            for (uint32_t i = start; i < start + size; i++)
+            {
+                auto inst = instruction_at(i, depth);
+                if (!inst) { return {}; }
+                instructions.push_back(inst);
+            }
+            return instructions;
+        }
+    public:
+        std::optional<sqf::runtime::instruction_set> read(std::istream& in)
+        {
+            in.read(reinterpret_cast<char*>(&m_header), sizeof(m_header));
+            if (!in.good() ||
+                std::memcmp(m_header.magic, module_magic, sizeof(module_magic)) != 0 ||
+                m_header.version != sqf::opcodes::bytecode::version)
+            {
+                return {};
+            }
+            m_string_data.resize(m_header.string_bytes);
+            if (!read_records(in, m_string_offsets, m_header.strings + 1)) { return {}; }
+            in.read(m_string_data.data(), m_string_data.size());
+            if (!read_records(in, m_constants, m_header.constants) ||
+                !read_records(in, m_source_records, m_header.sources) ||
+                !read_records(in, m_debug, m_header.debug) ||
+                !read_records(in, m_code, m_header.code))
+            {
+                return {};
+            }
+            m_sources.resize(m_source_records.size());
+            return set_at(m_header.entry_start, m_header.entry_size, 0);
+        }
+    };
+}
+
+bool sqf::opcodes::bytecode::write(std::ostream& out, const sqf::runtime::instruction_set& set)
+{
+    writer w;
+    auto entry = w.write_set(set);
+    if (!entry.has_value())
+    {
+        return false;
+    }
+    w.flush(out, *entry);
+    return out.good();
+}
+
+std::optional<sqf::runtime::instruction_set> sqf::opcodes::bytecode::read(std::istream& in)
+{
+    try
+    {
+        reader r;
+        return r.read(in);
+    }
+    catch (const std::exception&)
+    {
+        // Corrupted length fields may cause allocation failures.
+        return {};
+    }
+}
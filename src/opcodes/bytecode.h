@@ -0,0 +1,40 @@
+#pragma once
+#include "../runtime/instruction_set.h"
+
+#include <istream>
+#include <ostream>
+#include <optional>
+#include <cstdint>
+
+namespace sqf::opcodes::bytecode
+{
+    /// <summary>
+    /// Version of the binary module format.
+    /// Has to be increased whenever the layout written by write changes.
+    /// </summary>
+    static const uint32_t version = 3;
+
+    /// <summary>
+    /// File extension of precompiled SQF modules.
+    /// </summary>
+    static const char* const extension = ".sqfc";
+
+    /// <summary>
+    /// Writes the provided instruction_set as binary module to the output stream.
+    /// A module consists of a string table, a constant pool, the source files, the debug info
+    /// and a stream of fixed-size instruction records, in which nested code blocks
+    /// are contiguous ranges.
+    /// </summary>
+    /// <param name="out">The stream to write to.</param>
+    /// <param name="set">The instruction_set to write.</param>
+    /// <returns>false if the set contains instructions or values that cannot be represented.</returns>
+    bool write(std::ostream& out, const sqf::runtime::instruction_set& set);
+
+    /// <summary>
+    /// Reads a module previously written using write.
+    /// Modules written with a different format version are rejected.
+    /// </summary>
+    /// <param name="in">The stream to read from.</param>
+    /// <returns>Empty optional if the input is malformed.</returns>
+    std::optional<sqf::runtime::instruction_set> read(std::istream& in);
+}
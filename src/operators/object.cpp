@@ -5,6 +5,87 @@
 #include "../runtime/d_array.h"
 #include "../runtime/d_scalar.h"
 
+#pragma region ::sqf::types::object::object_storage
+
+sqf::types::object::object_storage::~object_storage()
+{
+    // Objects may outlive their storage.
+    for (auto& obj : m_inner)
+    {
+        obj->m_storage = nullptr;
+    }
+}
+
+size_t sqf::types::object::object_storage::push_back(std::shared_ptr<object> obj)
+{
+    m_inner.push_back(obj);
+    obj->m_storage = this;
+    index_insert(obj.get());
+    return ++m_id;
+}
+
+void sqf::types::object::object_storage::erase(std::shared_ptr<object> obj)
+{
+    auto it = std::find(m_inner.begin(), m_inner.end(), obj);
+    if (it != m_inner.end())
+    {
+        index_erase(obj.get(), obj->m_position);
+        obj->m_storage = nullptr;
+        *it = m_inner.back();
+        m_inner.pop_back();
+    }
+}
+
+void sqf::types::object::object_storage::moved(object* obj, ::sqf::runtime::vec3 previous)
+{
+    auto& from = cell_of(previous);
+    auto& to = cell_of(obj->m_position);
+    if (&from != &to)
+    {
+        index_erase(obj, previous);
+        index_insert(obj);
+    }
+}
+
+int32_t sqf::types::object::object_storage::cell_coordinate(double value)
+{
+    auto cell = std::floor(value / cell_size);
+    // Clamped, keeping far away objects in the outermost cells.
+    return static_cast<int32_t>(std::clamp(cell, (double)INT32_MIN, (double)INT32_MAX));
+}
+
+std::vector<sqf::types::object*>& sqf::types::object::object_storage::cell_of(::sqf::runtime::vec3 position)
+{
+    if (!std::isfinite(position.x) || !std::isfinite(position.y))
+    {
+        return m_unbounded;
+    }
+    return m_cells[cell_key(cell_coordinate(position.x), cell_coordinate(position.y))];
+}
+
+void sqf::types::object::object_storage::index_insert(object* obj)
+{
+    cell_of(obj->m_position).push_back(obj);
+}
+
+void sqf::types::object::object_storage::index_erase(object* obj, ::sqf::runtime::vec3 position)
+{
+    auto& cell = cell_of(position);
+    auto it = std::find(cell.begin(), cell.end(), obj);
+    if (it != cell.end())
+    {
+        *it = cell.back();
+        cell.pop_back();
+    }
+    if (cell.empty() && &cell != &m_unbounded)
+    {
+        // Keeps m_cells limited to occupied cells, see in_range.
+        m_cells.erase(cell_key(cell_coordinate(position.x), cell_coordinate(position.y)));
+    }
+}
+
+#pragma endregion
+
 #pragma region ::sqf::types::object::soldiers
 
 bool sqf::types::object::soldiers_::push_back(sqf::runtime::value val)
@@ -60,6 +141,7 @@ void sqf::types::object::soldiers_::erase(std::shared_ptr<d_object> obj)
 
 sqf::types::object::object(sqf::runtime::config config, bool is_vehicle) :
     m_netid(~(size_t)0),
+    m_storage(nullptr),
     m_config(config),
     m_is_vehicle(is_vehicle),
     m_varname(""),
@@ -11,6 +11,9 @@
 #include <array>
 #include <vector>
 #include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <unordered_map>
 
 namespace sqf
 {
@@ -28,18 +31,96 @@ namespace sqf
             class object_storage : public sqf::runtime::runtime::datastorage
             {
             private:
+                // Edge length of the cells of the uniform grid over x and y, objects get indexed by (see in_range).
+                static constexpr double cell_size = 64;
+
                 std::vector<std::shared_ptr<object>> m_inner;
                 size_t m_id;
                 std::shared_ptr<object> m_player;
+                std::unordered_map<uint64_t, std::vector<object*>> m_cells;
+                // Objects with non-finite coordinates, belonging to no cell.
+                std::vector<object*> m_unbounded;
+
+                static int32_t cell_coordinate(double value);
+                static uint64_t cell_key(int32_t x, int32_t y) { return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(y); }
+                std::vector<object*>& cell_of(::sqf::runtime::vec3 position);
+                void index_insert(object* obj);
+                void index_erase(object* obj, ::sqf::runtime::vec3 position);
             public:
                 object_storage() : m_inner(), m_id(0) {}
-                virtual ~object_storage() override {}
-                size_t push_back(std::shared_ptr<object> obj) { m_inner.push_back(obj); return ++m_id; }
-                void erase(std::shared_ptr<object> obj) { auto it = std::find(m_inner.begin(), m_inner.end(), obj); if (it != m_inner.end()) { *it = m_inner.back(); m_inner.pop_back(); } }
+                virtual ~object_storage() override;
+                size_t push_back(std::shared_ptr<object> obj);
+                void erase(std::shared_ptr<object> obj);
                 std::vector<std::shared_ptr<object>>::iterator begin() { return m_inner.begin(); }
                 std::vector<std::shared_ptr<object>>::iterator end() { return m_inner.end(); }
                 std::shared_ptr<object> player() { return m_player; }
                 void player(std::shared_ptr<object> obj) { m_player = obj; }
+
+                /// <summary>
+                /// Updates the index after the position of the provided object changed.
+                /// Called by object::position.
+                /// </summary>
+                void moved(object* obj, ::sqf::runtime::vec3 previous);
+
+                /// <summary>
+                /// Invokes func for every object whose x and y coordinates lie within the square of the provided radius
+                /// around the provided position, using the grid to skip objects further away.
+                /// Objects beyond the square may be passed too, thus callers still have to check the actual distance.
+                /// </summary>
+                template<typename TFunc>
+                void in_range(::sqf::runtime::vec3 center, float radius, TFunc func)
+                {
+                    for (auto obj : m_unbounded)
+                    {
+                        func(obj);
+                    }
+                    if (!std::isfinite(center.x) || !std::isfinite(center.y) || !std::isfinite(radius))
+                    {
+                        // Distances to or compared with non-finite values do not prune anything.
+                        for (auto& cell : m_cells)
+                        {
+                            for (auto obj : cell.second) { func(obj); }
+                        }
+                        return;
+                    }
+                    // Padded, as distances get calculated using floats.
+                    double padding = 1e-4 * (std::abs(center.x) + std::abs(center.y) + std::abs(radius)) + 1e-3;
+                    auto x0 = cell_coordinate(center.x - (double)radius - padding);
+                    auto x1 = cell_coordinate(center.x + (double)radius + padding);
+                    auto y0 = cell_coordinate(center.y - (double)radius - padding);
+                    auto y1 = cell_coordinate(center.y + (double)radius + padding);
+                    if (x0 > x1 || y0 > y1)
+                    {
+                        return;
+                    }
+                    if ((x1 - (double)x0 + 1) * (y1 - (double)y0 + 1) > m_cells.size())
+                    {
+                        // Covering more cells than are occupied.
+                        for (auto& cell : m_cells)
+                        {
+                            auto x = static_cast<int32_t>(static_cast<uint32_t>(cell.first >> 32));
+                            auto y = static_cast<int32_t>(static_cast<uint32_t>(cell.first));
+                            if (x0 <= x && x <= x1 && y0 <= y && y <= y1)
+                            {
+                                for (auto obj : cell.second) { func(obj); }
+                            }
+                        }
+                        return;
+                    }
+                    for (auto x = x0;; x++)
+                    {
+                        for (auto y = y0;; y++)
+                        {
+                            auto res = m_cells.find(cell_key(x, y));
+                            if (res != m_cells.end())
+                            {
+                                for (auto obj : res->second) { func(obj); }
+                            }
+                            if (y == y1) { break; }
+                        }
+                        if (x == x1) { break; }
+                    }
+                }
             };
             struct configuration_
             {
@@ -89,6 +170,8 @@ namespace sqf
             };
         private:
             size_t m_netid;
+            // Storage indexing this object, unset once destroyed.
+            object_storage* m_storage;
             sqf::runtime::config m_config;
             bool m_is_vehicle;
 
@@ -115,7 +198,15 @@ namespace sqf
             bool alive() const { return m_damage < 1; }
 
             ::sqf::runtime::vec3 position() const { return m_position; }
-            void position(::sqf::runtime::vec3 vec) { m_position = vec; }
+            void position(::sqf::runtime::vec3 vec)
+            {
+                auto previous = m_position;
+                m_position = vec;
+                if (m_storage)
+                {
+                    m_storage->moved(this, previous);
+                }
+            }
 
             ::sqf::runtime::vec3 velocity() const { return m_velocity; }
             void velocity(::sqf::runtime::vec3 vec) { m_velocity = vec; }
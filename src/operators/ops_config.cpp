@@ -42,7 +42,7 @@ namespace
             std::vector<std::string> path;
             do
             {
-                path.push_back(nav->name);
+                path.emplace_back(nav->name);
                 nav = nav.parent_logical();
             } while (nav->id_parent_logical != config::invalid_id);
 
@@ -117,7 +117,7 @@ namespace
         std::vector<value> path;
         do
         {
-            path.push_back(nav->name);
+            path.push_back(std::string(nav->name));
             nav = nav.parent_logical();
         } while (nav->id_parent_logical != config::invalid_id);
 
@@ -233,50 +233,72 @@ namespace
         auto cd = right.data<d_config, config>();
         return cd.is_null();
     }
-    value configclasses_code_config(runtime& runtime, value::cref left, value::cref right)
+    class behavior_config_filter_exit : public frame::behavior
     {
-        class behavior_configclasses_exit : public frame::behavior
+    private:
+        std::shared_ptr<d_array> m_out_arr;
+        std::shared_ptr<const std::vector<config>> m_candidates;
+        size_t m_index;
+        std::string m_operator;
+    public:
+        behavior_config_filter_exit(std::shared_ptr<const std::vector<config>> candidates, std::string op) :
+            m_out_arr(std::make_shared<d_array>()), m_candidates(std::move(candidates)), m_index(0), m_operator(std::move(op)) {}
+        virtual result enact(sqf::runtime::runtime& runtime, sqf::runtime::frame& frame) override
         {
-        private:
-            std::shared_ptr<d_array> m_out_arr;
-            confignav m_confignav;
-            confignav::iterator m_iterator_current;
-        public:
-            behavior_configclasses_exit(confignav confignav) : m_out_arr(std::make_shared<d_array>()), m_confignav(confignav), m_iterator_current(confignav.begin()) {}
-            virtual result enact(sqf::runtime::runtime& runtime, sqf::runtime::frame& frame) override
+            auto res = runtime.context_active().pop_value();
+            if (res.has_value())
             {
-                auto res = runtime.context_active().pop_value();
-                if (res.has_value())
+                auto value = res->data_try<d_boolean, bool>();
+                if (value.has_value())
                 {
-                    auto value = res->data_try<d_boolean, bool>();
-                    if (value.has_value())
+                    if (*value)
                     {
-                        m_out_arr->push_back({ *m_iterator_current });
+                        m_out_arr->push_back({ m_candidates->at(m_index) });
                     }
-                    else
-                    {
-                        runtime.__logmsg(logmessage::runtime::TypeMissmatch((*frame.current())->diag_info(), t_boolean(), res->type()));
-                    }
-                }
-                else
-                {
-                    runtime.__logmsg(logmessage::runtime::CallstackFoundNoValue((*frame.current())->diag_info(), "configClasses"s));
-                }
-                if (++m_iterator_current == m_confignav.end())
-                {
-                    runtime.context_active().push_value(m_out_arr);
-                    return result::ok;
                 }
                 else
                 {
-                    runtime.context_active().clear_values();
-                    frame.clear_value_scope();
-                    frame["_x"] = { *m_iterator_current };
-                    return result::seek_start;
+                    runtime.__logmsg(logmessage::runtime::TypeMissmatch((*frame.current())->diag_info(), t_boolean(), res->type()));
                 }
-            };
+            }
+            else
+            {
+                runtime.__logmsg(logmessage::runtime::CallstackFoundNoValue((*frame.current())->diag_info(), m_operator));
+            }
+            if (++m_index == m_candidates->size())
+            {
+                runtime.context_active().push_value(m_out_arr);
+                return result::ok;
+            }
+            else
+            {
+                runtime.context_active().clear_values();
+                frame.clear_value_scope();
+                frame["_x"] = { m_candidates->at(m_index) };
+                return result::seek_start;
+            }
         };
-
+    };
+    // Runs the provided condition for each candidate, pushing those it returned true for as array.
+    value config_filter(runtime& runtime, std::string code, std::shared_ptr<const std::vector<config>> candidates, std::string op)
+    {
+        if (candidates->empty())
+        {
+            return std::make_shared<d_array>();
+        }
+        auto& parser = runtime.parser_sqf();
+        auto res = parser.parse(runtime, code, runtime.context_active().current_frame().path_from_position());
+        if (res.has_value())
+        {
+            auto first = candidates->front();
+            frame f(runtime.default_value_scope(), res.value(), std::make_shared<behavior_config_filter_exit>(std::move(candidates), std::move(op)));
+            f["_x"] = { first };
+            runtime.context_active().push_frame(f);
+        }
+        return {};
+    }
+    value configclasses_code_config(runtime& runtime, value::cref left, value::cref right)
+    {
         auto code = left.data<d_string, std::string>();
         auto conf = right.data<d_config, config>();
 
@@ -287,68 +309,18 @@ namespace
             runtime.__logmsg(err::ReturningEmptyArray(runtime.context_active().current_frame().diag_info_from_position()));
             return std::make_shared<d_array>();
         }
-        if (nav->size() == 0)
+        auto classes = std::make_shared<std::vector<config>>();
+        for (auto& member : *nav.members(false))
         {
-            return std::make_shared<d_array>();
-        }
-        else
-        {
-            auto& parser = runtime.parser_sqf();
-            auto res = parser.parse(runtime, code, runtime.context_active().current_frame().diag_info_from_position().path);
-
-            if (res.has_value())
+            if (member.navigate(runtime.confighost())->value.empty())
             {
-                frame f(runtime.default_value_scope(), res.value(), std::make_shared<behavior_configclasses_exit>(nav));
-                f["_x"] = nav->operator[](0);
-                runtime.context_active().push_frame(f);
+                classes->push_back(member);
             }
         }
-        return {};
+        return config_filter(runtime, code, std::move(classes), "configClasses"s);
     }
     value configproperties_array(runtime& runtime, value::cref right)
     {
-        class behavior_configproperties_exit : public frame::behavior
-        {
-        private:
-            std::shared_ptr<d_array> m_out_arr;
-            confignav m_confignav;
-            confignav::iterator m_iterator_current;
-        public:
-            behavior_configproperties_exit(confignav confignav) : m_out_arr(std::make_shared<d_array>()), m_confignav(confignav), m_iterator_current(confignav.begin()) {}
-            virtual result enact(sqf::runtime::runtime& runtime, sqf::runtime::frame& frame) override
-            {
-                auto res = runtime.context_active().pop_value();
-                if (res.has_value())
-                {
-                    auto value = res->data_try<d_boolean, bool>();
-                    if (value.has_value())
-                    {
-                        m_out_arr->push_back({ *m_iterator_current });
-                    }
-                    else
-                    {
-                        runtime.__logmsg(logmessage::runtime::TypeMissmatch((*frame.current())->diag_info(), t_boolean(), res->type()));
-                    }
-                }
-                else
-                {
-                    runtime.__logmsg(logmessage::runtime::CallstackFoundNoValue((*frame.current())->diag_info(), "configClasses"s));
-                }
-                if (++m_iterator_current == m_confignav.end())
-                {
-                    runtime.context_active().push_value(m_out_arr);
-                    return result::ok;
-                }
-                else
-                {
-                    runtime.context_active().clear_values();
-                    frame.clear_value_scope();
-                    frame["_x"] = { *m_iterator_current };
-                    return result::seek_start;
-                }
-            };
-        };
-
         auto arr = right.data<d_array>();
         if (!arr->check_type(runtime, std::array<sqf::runtime::type, 3>{ t_config(), t_string(), t_boolean() }, 1))
         {
@@ -357,37 +329,16 @@ namespace
         auto conf = arr->get<d_config, config>(0);
         auto code = arr->get<d_string, std::string>(1, "true"s);
         auto inherit = arr->get<d_boolean, bool>(2, true);
-        if (inherit)
-        {
-            auto nav = conf.navigate(runtime.confighost());
-            if (nav.empty())
-            {
-                runtime.__logmsg(err::ExpectedNonNullValue(runtime.context_active().current_frame().diag_info_from_position()));
-                runtime.__logmsg(err::ReturningEmptyArray(runtime.context_active().current_frame().diag_info_from_position()));
-                return std::make_shared<d_array>();
-            }
-            if (nav->size() == 0)
-            {
-                return std::make_shared<d_array>();
-            }
-            else
-            {
-                auto& parser = runtime.parser_sqf();
-                auto res = parser.parse(runtime, code, runtime.context_active().current_frame().diag_info_from_position().path);
 
-                if (res.has_value())
-                {
-                    frame f(runtime.default_value_scope(), res.value(), std::make_shared<behavior_configproperties_exit>(nav));
-                    f["_x"] = nav->operator[](0);
-                    runtime.context_active().push_frame(f);
-                }
-            }
-            return {};
-        }
-        else
+        auto nav = conf.navigate(runtime.confighost());
+        if (nav.empty())
         {
-            return configclasses_code_config(runtime, code, conf);
+            runtime.__logmsg(err::ExpectedNonNullValue(runtime.context_active().current_frame().diag_info_from_position()));
+            runtime.__logmsg(err::ReturningEmptyArray(runtime.context_active().current_frame().diag_info_from_position()));
+            return std::make_shared<d_array>();
         }
+        // Precomputed per class, as scripts tend to query the same classes over and over.
+        return config_filter(runtime, code, nav.members(inherit), "configProperties"s);
     }
 }
 void sqf::operators::ops_config(::sqf::runtime::runtime& runtime)
@@ -13,11 +13,14 @@
 #include "../runtime/diagnostics/d_stacktrace.h"
 #include "../runtime/d_code.h"
 #include "../runtime/git_sha1.h"
+#include "../opcodes/bytecode.h"
 
 #include "dlops_storage.h"
 
 
 #include <cmath>
+#include <sstream>
+#include <filesystem>
 
 
 
@@ -156,11 +159,98 @@ namespace
         }
         return {};
     }
+    std::optional<instruction_set> parse_cached(runtime& runtime, std::string_view contents, const sqf::runtime::fileio::pathinfo& pathinfo)
+    {
+        auto& cache = runtime.compile_cache();
+        auto key = sqf::runtime::compile_cache::key_of(contents, pathinfo);
+        auto cached = cache.code(key);
+        if (cached.has_value())
+        {
+            return cached;
+        }
+        auto res = runtime.parser_sqf().parse(runtime, std::string(contents), pathinfo);
+        if (res.has_value())
+        {
+            cache.code(std::move(key), *res);
+        }
+        return res;
+    }
+    // Loads the precompiled module next to the requested file (eg. `file.sqfc` for `file.sqf`), if it is not older than the file itself.
+    // Decoded modules are kept in the compile cache, keyed by their write time so that replacing the module invalidates them.
+    std::optional<instruction_set> load_module(runtime& runtime, std::string_view path, const std::optional<sqf::runtime::fileio::pathinfo>& source)
+    {
+        auto& fileio = runtime.fileio();
+        auto module_path = std::filesystem::path(path).replace_extension(sqf::opcodes::bytecode::extension).string();
+        auto module_info = fileio.get_info(module_path, {});
+        if (!module_info.has_value())
+        {
+            return {};
+        }
+        // Files inside of a PBO do not change while running.
+        bool cacheable = !module_info->additional.empty();
+        int64_t write_time = 0;
+        size_t size = 0;
+        if (module_info->additional.empty())
+        {
+            std::error_code err_module, err_size;
+            auto time_module = std::filesystem::last_write_time(module_info->physical, err_module);
+            size = static_cast<size_t>(std::filesystem::file_size(module_info->physical, err_size));
+            if (!err_module && !err_size)
+            {
+                cacheable = true;
+                write_time = static_cast<int64_t>(time_module.time_since_epoch().count());
+            }
+            if (!err_module && source.has_value() && source->additional.empty())
+            {
+                std::error_code err_source;
+                auto time_source = std::filesystem::last_write_time(source->physical, err_source);
+                if (!err_source && time_module < time_source)
+                {
+                    return {};
+                }
+            }
+        }
+        auto& cache = runtime.compile_cache();
+        auto key = sqf::runtime::compile_cache::module_key(*module_info, write_time, size);
+        if (cacheable)
+        {
+            auto cached = cache.module(key);
+            if (cached.has_value())
+            {
+                return cached;
+            }
+        }
+        std::istringstream in(fileio.read_file(*module_info));
+        auto res = sqf::opcodes::bytecode::read(in);
+        if (res.has_value() && cacheable)
+        {
+            cache.module(std::move(key), *res);
+        }
+        return res;
+    }
+    std::optional<std::string> preprocess_cached(runtime& runtime, const sqf::runtime::fileio::pathinfo& pathinfo)
+    {
+        auto& cache = runtime.compile_cache();
+        auto& preproc = runtime.parser_preprocessor();
+        auto file = runtime.fileio().open_file(pathinfo);
+        auto contents = file->contents();
+        auto key = sqf::runtime::compile_cache::key_of(contents, pathinfo, preproc.fingerprint());
+        auto cached = cache.preprocessed(key);
+        if (cached.has_value())
+        {
+            return cached;
+        }
+        auto res = preproc.preprocess(runtime, contents, pathinfo);
+        if (res.has_value())
+        {
+            cache.preprocessed(std::move(key), *res);
+        }
+        return res;
+    }
     value compile_string(runtime& runtime, value::cref right)
     {
         auto r = right.data<d_string, std::string>();
-        auto& parser = runtime.parser_sqf();
-        auto res = parser.parse(runtime, r, runtime.context_active().current_frame().diag_info_from_position().path);
+        auto res = parse_cached(runtime, r, runtime.context_active().current_frame().path_from_position());
         if (!res.has_value())
         {
             runtime.__runtime_error() = true;
@@ -1859,8 +1949,7 @@ namespace
         auto pathinfo = fileio.get_info(right.data<d_string, std::string_view>(), {});
         if (pathinfo.has_value())
         {
-            auto& preproc = runtime.parser_preprocessor();
-            auto str = preproc.preprocess(runtime, *pathinfo);
+            auto str = preprocess_cached(runtime, *pathinfo);
             return str.has_value() ? *str : ""s;
         }
         else
@@ -1994,29 +2083,35 @@ namespace
         runtime.context_active().push_frame(f);
         return {};
     }
+    value execvm_spawn(runtime& runtime, value::cref left, const instruction_set& set)
+    {
+        auto context_weak = runtime.context_create();
+        auto lock = context_weak.lock();
+        auto scriptdata = std::make_shared<d_script>(context_weak);
+        frame f(runtime.default_value_scope(), set);
+        f["_thisScript"] = scriptdata;
+        f["_this"] = left;
+        lock->push_frame(f);
+        return scriptdata;
+    }
     value execvm_any_string(runtime& runtime, value::cref left, value::cref right)
     {
         auto& fileio = runtime.fileio();
         auto pathinfo = fileio.get_info(right.data<d_string, std::string_view>(), {});
+        auto module = load_module(runtime, right.data<d_string, std::string_view>(), pathinfo);
+        if (module.has_value())
+        {
+            return execvm_spawn(runtime, left, *module);
+        }
         if (pathinfo.has_value())
         {
-            auto& preproc = runtime.parser_preprocessor();
-            auto str = preproc.preprocess(runtime, *pathinfo);
+            auto str = preprocess_cached(runtime, *pathinfo);
             if (str.has_value())
             {
-                auto r = right.data<d_string, std::string>();
-                auto& parser = runtime.parser_sqf();
-                auto res = parser.parse(runtime, r, runtime.context_active().current_frame().diag_info_from_position().path);
+                auto res = parse_cached(runtime, *str, *pathinfo);
                 if (res.has_value())
                 {
-                    auto context_weak = runtime.context_create();
-                    auto lock = context_weak.lock();
-                    auto scriptdata = std::make_shared<d_script>(context_weak);
-                    frame f(runtime.default_value_scope(), res.value());
-                    f["_thisScript"] = scriptdata;
-                    f["_this"] = left;
-                    lock->push_frame(f);
-                    return scriptdata;
+                    return execvm_spawn(runtime, left, *res);
                 }
                 else
                 {
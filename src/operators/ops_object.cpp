@@ -25,6 +25,9 @@
 
 #include <cstdlib>
 #include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
 
 
 namespace err = logmessage::runtime;
@@ -524,22 +527,6 @@ namespace
         }
         return l->value()->distance2d(r->value());
     }
-    class nearestobjects_distancesort3d
-    {
-        std::array<float, 3> pos;
-    public:
-        nearestobjects_distancesort3d(std::array<float, 3> p) : pos(p) {}
-        nearestobjects_distancesort3d(vec3 p) : pos({ p.x, p.y, p.z }) {}
-        bool operator() (value::cref l, value::cref r) const { return l.data<d_object>()->value()->distance3d(pos) < r.data<d_object>()->value()->distance3d(pos); }
-    };
-    class nearestobjects_distancesort2d
-    {
-        std::array<float, 2> pos;
-    public:
-        nearestobjects_distancesort2d(std::array<float, 2> p) : pos(p) {}
-        nearestobjects_distancesort2d(vec3 p) : pos({ p.x, p.y }) {}
-        bool operator() (value::cref l, value::cref r) const { return l.data<d_object>()->value()->distance2d(pos) < r.data<d_object>()->value()->distance2d(pos); }
-    };
     value nearestobjects_array(runtime& runtime, value::cref right)
     {
         auto arr = right.data<d_array>();
@@ -580,8 +567,8 @@ namespace
         for (size_t i = 0; i < filterarr->size(); i++)
         {
             if (!filterarr->at(i).is< t_string>())
-                runtime.__logmsg(err::ExpectedSubArrayTypeMissmatch(runtime.context_active().current_frame().diag_info_from_position(), std::array<size_t, 2> { 1, i }, t_string(), filterarr->at(i).type()));
             {
+                runtime.__logmsg(err::ExpectedSubArrayTypeMissmatch(runtime.context_active().current_frame().diag_info_from_position(), std::array<size_t, 2> { 1, i }, t_string(), filterarr->at(i).type()));
                 return {};
             }
         }
@@ -601,58 +588,38 @@ namespace
             }
             is2ddistance = arr->at(3).data<d_boolean, bool>();
         }
-        auto outputarr = std::make_shared<d_array>();
-        if (is2ddistance)
-        {
-            std::array<float, 2> position2d{ position.x, position.y };
-            for (auto& object : runtime.storage<object::object_storage>())
-            {
-                if (object->distance2d(position2d) > radius) continue;
+        // Candidates come from the grid of the object storage, only covering objects near the position.
+        std::vector<std::pair<float, object*>> found;
+        runtime.storage<object::object_storage>().in_range(position, radius, [&](object* obj) {
+            auto distance = is2ddistance ? obj->distance2d(position) : obj->distance3d(position);
+            if (distance > radius) return;
 
-                bool match = filterarr->empty() || !runtime.configuration().enable_classname_check;
-                if (!match)
+            bool match = filterarr->empty() || !runtime.configuration().enable_classname_check;
+            if (!match)
+            {
+                auto cfgObject = obj->config().navigate(runtime.confighost());
+                if (!cfgObject.empty())
                 {
-                    auto cfgObject = object->config().navigate(runtime.confighost());
-
-                    if (!cfgObject.empty())
-                    {
-                        auto found = std::find_if(filterarr->begin(), filterarr->end(), [&cfgObject](value::cref value) {
-                            return cfgObject.has_inherited_with_name(value.data<d_string, std::string>());
+                    auto res = std::find_if(filterarr->begin(), filterarr->end(), [&cfgObject](value::cref value) {
+                        return cfgObject.has_inherited_with_name(value.data<d_string, std::string>());
                         });
-                        match = found != filterarr->end();
-                    }
-                }
-                if (match)
-                {
-                    outputarr->push_back(value(std::make_shared<d_object>(object)));
+                    match = res != filterarr->end();
                 }
             }
-            std::sort(outputarr->begin(), outputarr->end(), nearestobjects_distancesort2d(position2d));
-        }
-        else
-        {
-            for (auto& object : runtime.storage<object::object_storage>())
+            if (match)
             {
-                if (object->distance3d(position) > radius) continue;
-                
-                bool match = filterarr->empty() || !runtime.configuration().enable_classname_check;
-                if (!match)
-                {
-                    auto cfgObject = object->config().navigate(runtime.confighost());
-                    if (!cfgObject.empty())
-                    {
-                        auto found = std::find_if(filterarr->begin(), filterarr->end(), [&cfgObject](value::cref value) {
-                            return cfgObject.has_inherited_with_name(value.data<d_string, std::string>());
-                            });
-                        match = found != filterarr->end();
-                    }
-                }
-                if (match)
-                {
-                    outputarr->push_back(value(std::make_shared<d_object>(object)));
-                }
+                // Non-finite positions yield NaN, which would break the ordering below.
+                found.emplace_back(std::isnan(distance) ? std::numeric_limits<float>::infinity() : distance, obj);
             }
-            std::sort(outputarr->begin(), outputarr->end(), nearestobjects_distancesort3d(position));
+        });
+        // Ties are ordered by netid, as the grid yields objects in no particular order.
+        std::sort(found.begin(), found.end(), [](const std::pair<float, object*>& l, const std::pair<float, object*>& r) {
+            return l.first < r.first || (!(r.first < l.first) && l.second->netid() < r.second->netid());
+            });
+        auto outputarr = std::make_shared<d_array>();
+        for (auto& it : found)
+        {
+            outputarr->push_back(value(std::make_shared<d_object>(it.second->shared_from_this())));
         }
         return value(outputarr);
     }
@@ -741,7 +708,7 @@ namespace
                 std::vector<std::string> path;
                 do
                 {
-                    path.push_back(nav->name);
+                    path.emplace_back(nav->name);
                     nav = nav.parent_logical();
                 } while (nav->id_parent_logical != config::invalid_id);
                 runtime.__logmsg(err::ConfigEntryNotFoundWeak(runtime.context_active().current_frame().diag_info_from_position(), path, test_type_str));
@@ -55,7 +55,7 @@ namespace
     value assembly___string(runtime& runtime, value::cref right)
     {
         auto str = right.data<d_string>();
-        auto set = runtime.parser_sqf().parse(runtime, *str, runtime.context_active().current_frame().diag_info_from_position().path);
+        auto set = runtime.parser_sqf().parse(runtime, *str, runtime.context_active().current_frame().path_from_position());
         if (set.has_value())
         {
             std::vector<value> outarr;
@@ -409,14 +409,14 @@ namespace
     }
     value pwd___(runtime& runtime)
     {
-        auto path = std::filesystem::path(runtime.context_active().current_frame().diag_info_from_position().path.physical);
+        auto path = std::filesystem::path(runtime.context_active().current_frame().path_from_position().physical);
         auto str = std::filesystem::absolute(path).string();
         std::replace(str.begin(), str.end(), '\\', '/');
         return str;
     }
     value currentdirectory___(runtime& runtime)
     {
-        auto pathinfo = runtime.context_active().current_frame().diag_info_from_position().path;
+        auto pathinfo = runtime.context_active().current_frame().path_from_position();
         auto path = std::filesystem::path(pathinfo.physical);
         auto str = std::filesystem::absolute(path.parent_path()).string();
         std::replace(str.begin(), str.end(), '\\', '/');
@@ -508,6 +508,17 @@ namespace
     {
         return { std::make_shared<d_namespace>(runtime.get_value_scope(right.data<d_string, std::string>())) };
     }
+    value compilecache___(runtime& runtime)
+    {
+        auto stats = runtime.compile_cache().stats();
+        return std::vector<value>{
+            static_cast<float>(stats.hits),
+            static_cast<float>(stats.misses),
+            static_cast<float>(stats.evictions),
+            static_cast<float>(stats.size),
+            static_cast<float>(stats.capacity)
+        };
+    }
     value nobubble___any_code(runtime& runtime, value::cref left, value::cref right)
     {
         frame f = { runtime.default_value_scope(), right.data<d_code, instruction_set>() };
@@ -704,4 +715,5 @@ void sqf::operators::ops_sqfvm(sqf::runtime::runtime& runtime)
     runtime.register_sqfop(unary("noBubble__", t_code(), "Acts like call but disables bubbling of variables for the lower scope. (lower scope will have no access to upper scope variables)", nobubble___code));
     runtime.register_sqfop(binary(4, "noBubble__", t_any(), t_code(), "Acts like call but disables bubbling of variables for the lower scope. (lower scope will have no access to upper scope variables)", nobubble___any_code));
     runtime.register_sqfop(unary("customNamespace__", t_string(), "operator to get a custom namespace that lives as long as the VM lives.", customnamespace___string));
+    runtime.register_sqfop(nular("compileCache__", "Returns the statistics of the compile cache used by compile, execVM and preprocessFile in the format [hits, misses, evictions, size, capacity].", compilecache___));
 }
\ No newline at end of file
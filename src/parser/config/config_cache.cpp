@@ -0,0 +1,213 @@
+#include "config_cache.h"
+#include "../../runtime/fileio.h"
+#include "../../runtime/git_sha1.h"
+
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <thread>
+
+namespace
+{
+    // Entry layout (native endianness):
+    //   char[8] magic, uint32 version, string revision, uint64 key,
+    //   uint32 dependencies, dependencies * { string physical, uint64 size, int64 modification time },
+    //   uint64 image length, image (see sqf::runtime::confighost::write_image)
+    //   string: uint32 length, char[length]
+    const char entry_magic[8] = { 'S', 'Q', 'F', 'V', 'M', 'C', 'F', 'C' };
+    const uint32_t entry_version = 1;
+
+    // FNV-1a, as std::hash is not guaranteed to be stable between builds.
+    uint64_t hash(std::string_view str, uint64_t seed = 14695981039346656037ULL)
+    {
+        for (auto c : str)
+        {
+            seed ^= static_cast<uint8_t>(c);
+            seed *= 1099511628211ULL;
+        }
+        return seed;
+    }
+
+    template<typename T>
+    void write_raw(std::ostream& out, T t) { out.write(reinterpret_cast<const char*>(&t), sizeof(T)); }
+    template<typename T>
+    bool read_raw(std::string_view in, size_t& pos, T& t)
+    {
+        if (pos > in.length() || in.length() - pos < sizeof(T)) { return false; }
+        std::memcpy(&t, in.data() + pos, sizeof(T));
+        pos += sizeof(T);
+        return true;
+    }
+    void write_string(std::ostream& out, std::string_view str)
+    {
+        write_raw<uint32_t>(out, static_cast<uint32_t>(str.length()));
+        out.write(str.data(), str.length());
+    }
+    bool read_string(std::string_view in, size_t& pos, std::string_view& str)
+    {
+        uint32_t length;
+        if (!read_raw(in, pos, length) || in.length() - pos < length) { return false; }
+        str = in.substr(pos, length);
+        pos += length;
+        return true;
+    }
+
+    // Size and modification time of a file, being zero if the file does not exist (anymore).
+    std::pair<uint64_t, int64_t> file_state(const std::filesystem::path& physical)
+    {
+        std::error_code err;
+        auto size = std::filesystem::file_size(physical, err);
+        if (err)
+        {
+            return { 0, 0 };
+        }
+        auto mtime = std::filesystem::last_write_time(physical, err);
+        if (err)
+        {
+            return { 0, 0 };
+        }
+        return { size, static_cast<int64_t>(mtime.time_since_epoch().count()) };
+    }
+}
+
+sqf::parser::config::config_cache::config_cache(Logger& logger, std::filesystem::path directory) :
+    CanLog(logger),
+    m_directory(std::move(directory)),
+    m_key(hash({}))
+{
+}
+
+void sqf::parser::config::config_cache::add_input(std::string_view name, std::string_view contents)
+{
+    // Lengths are part of the key, so that moving characters between name and contents changes it.
+    auto name_length = name.length();
+    auto contents_length = contents.length();
+    m_key = hash(std::string_view(reinterpret_cast<const char*>(&name_length), sizeof(name_length)), m_key);
+    m_key = hash(name, m_key);
+    m_key = hash(std::string_view(reinterpret_cast<const char*>(&contents_length), sizeof(contents_length)), m_key);
+    m_key = hash(contents, m_key);
+}
+
+std::filesystem::path sqf::parser::config::config_cache::entry_path() const
+{
+    std::stringstream sstream;
+    sstream << std::hex << std::setw(16) << std::setfill('0') << m_key << ".sqfcfg";
+    return m_directory / sstream.str();
+}
+
+std::optional<sqf::runtime::confighost> sqf::parser::config::config_cache::load()
+{
+    auto entry = entry_path();
+    std::error_code err;
+    if (!std::filesystem::exists(entry, err))
+    {
+        return {};
+    }
+    auto mapping = ::sqf::runtime::fileio::file_handle::map(entry.string(), false);
+    if (!mapping)
+    {
+        return {};
+    }
+    auto contents = mapping->contents();
+    size_t pos = sizeof(entry_magic);
+    uint32_t version;
+    std::string_view revision;
+    if (contents.length() < sizeof(entry_magic) || std::memcmp(contents.data(), entry_magic, sizeof(entry_magic)) != 0 ||
+        !read_raw(contents, pos, version) || !read_string(contents, pos, revision))
+    {
+        log(logmessage::fileio::ConfigCacheEntryStale(entry.string(), "unknown format"));
+        return {};
+    }
+    if (version != entry_version || revision != g_GIT_SHA1)
+    {
+        log(logmessage::fileio::ConfigCacheEntryStale(entry.string(), "created by revision " + std::string(revision)));
+        return {};
+    }
+    uint64_t key;
+    uint32_t dependencies;
+    if (!read_raw(contents, pos, key) || !read_raw(contents, pos, dependencies))
+    {
+        log(logmessage::fileio::ConfigCacheEntryStale(entry.string(), "truncated"));
+        return {};
+    }
+    if (key != m_key)
+    {
+        // Different inputs sharing the same entry name.
+        return {};
+    }
+    for (uint32_t i = 0; i < dependencies; i++)
+    {
+        std::string_view physical;
+        uint64_t size;
+        int64_t mtime;
+        if (!read_string(contents, pos, physical) || !read_raw(contents, pos, size) || !read_raw(contents, pos, mtime))
+        {
+            log(logmessage::fileio::ConfigCacheEntryStale(entry.string(), "truncated"));
+            return {};
+        }
+        if (file_state(std::filesystem::path(physical)) != std::make_pair(size, mtime))
+        {
+            log(logmessage::fileio::ConfigCacheEntryStale(entry.string(), "'" + std::string(physical) + "' got modified"));
+            return {};
+        }
+    }
+    uint64_t image_length;
+    if (!read_raw(contents, pos, image_length) || contents.length() - pos != image_length)
+    {
+        log(logmessage::fileio::ConfigCacheEntryStale(entry.string(), "truncated"));
+        return {};
+    }
+    auto host = ::sqf::runtime::confighost::read_image(contents.substr(pos));
+    if (!host.has_value())
+    {
+        log(logmessage::fileio::ConfigCacheEntryStale(entry.string(), "corrupted"));
+    }
+    return host;
+}
+
+bool sqf::parser::config::config_cache::store(const ::sqf::runtime::confighost& source, const std::vector<std::string>& dependencies)
+{
+    auto entry = entry_path();
+    std::error_code err;
+    std::filesystem::create_directories(m_directory, err);
+
+    // Written to a temporary file first, so that concurrent runs never observe partial entries.
+    std::stringstream tmp_suffix;
+    tmp_suffix << '.' << std::this_thread::get_id() << ".tmp";
+    auto tmp = entry;
+    tmp += tmp_suffix.str();
+    {
+        std::ofstream out(tmp, std::ios_base::binary | std::ios_base::trunc);
+        if (out.good())
+        {
+            out.write(entry_magic, sizeof(entry_magic));
+            write_raw<uint32_t>(out, entry_version);
+            write_string(out, g_GIT_SHA1);
+            write_raw<uint64_t>(out, m_key);
+            write_raw<uint32_t>(out, static_cast<uint32_t>(dependencies.size()));
+            for (auto& physical : dependencies)
+            {
+                auto state = file_state(physical);
+                write_string(out, physical);
+                write_raw<uint64_t>(out, state.first);
+                write_raw<int64_t>(out, state.second);
+            }
+            auto image = source.write_image();
+            write_raw<uint64_t>(out, image.length());
+            out.write(image.data(), image.length());
+            if (out.good())
+            {
+                out.close();
+                std::filesystem::rename(tmp, entry, err);
+                if (!err)
+                {
+                    return true;
+                }
+            }
+        }
+    }
+    std::filesystem::remove(tmp, err);
+    log(logmessage::fileio::ConfigCacheWriteFailed(entry.string()));
+    return false;
+}
@@ -0,0 +1,62 @@
+#pragma once
+#include "../../runtime/confighost.h"
+#include "../../runtime/logging.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace sqf::parser::config
+{
+    /// <summary>
+    /// Persists the config created from a set of inputs on disk (see confighost::write_image),
+    /// allowing subsequent runs to skip preprocessing and parsing them.
+    /// </summary>
+    /// <remarks>
+    /// Entries are keyed by a hash of the inputs, added using add_input before loading or storing.
+    /// Files only read while preprocessing (eg. includes) are recorded by each entry instead,
+    /// making it stale once any of them gets modified. Entries of other SQF-VM revisions are stale as well.
+    /// Stale entries are reported and replaced once stored again.
+    /// </remarks>
+    class config_cache : public CanLog
+    {
+        std::filesystem::path m_directory;
+        uint64_t m_key;
+    public:
+        /// <summary>
+        /// Creates a new config_cache.
+        /// </summary>
+        /// <param name="logger">The logger to report stale entries and write failures to.</param>
+        /// <param name="directory">The directory to keep the entries in. Will be created if missing.</param>
+        config_cache(Logger& logger, std::filesystem::path directory);
+
+        /// <summary>
+        /// Adds an input to the key of the entry. Inputs are expected to be added in the order they get applied.
+        /// </summary>
+        /// <param name="name">Identifies the input, eg. the path of a file or the name of a setting.</param>
+        /// <param name="contents">The contents of the input.</param>
+        void add_input(std::string_view name, std::string_view contents);
+
+        /// <summary>
+        /// The file of the entry for all inputs added so far.
+        /// </summary>
+        std::filesystem::path entry_path() const;
+
+        /// <summary>
+        /// Loads the entry for all inputs added so far.
+        /// </summary>
+        /// <returns>The config or an empty optional if there is no valid entry.</returns>
+        std::optional<::sqf::runtime::confighost> load();
+
+        /// <summary>
+        /// Stores the provided config as entry for all inputs added so far.
+        /// </summary>
+        /// <param name="source">The config created from the inputs.</param>
+        /// <param name="dependencies">Physical paths of all other files the config was created from.</param>
+        /// <returns>True if the entry got written, false otherwise.</returns>
+        bool store(const ::sqf::runtime::confighost& source, const std::vector<std::string>& dependencies);
+    };
+}
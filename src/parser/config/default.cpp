@@ -1,11 +1,16 @@
 #include "default.h"
 #include "../../runtime/util.h"
+#include "../scan.h"
 
 #include "../../runtime/d_array.h"
 #include "../../runtime/d_scalar.h"
 #include "../../runtime/d_string.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cwctype>
+#include <iterator>
+#include <thread>
 #include <utility>
 #include <vector>
 #include <cstring>
@@ -32,10 +37,97 @@ VALUE = STRING | NUMBER | LOCALIZATION | ARRAY;
 namespace err = logmessage::config;
 using namespace ::sqf::runtime::util;
 
+namespace
+{
+	// Contents shorter than this are always parsed at once.
+	const size_t parallel_min_length = 256 * 1024;
+	const size_t parallel_min_chunk_length = 64 * 1024;
+
+	// Splits contents into chunks of at least min_length characters (but the last one), each ending with a top-level ';'.
+	// Mirrors the parser only as far as needed to track the nesting of curly brackets:
+	// Strings are only recognized in value position (after '=', '{' or ','), as unquoted text may contain quotes,
+	// and #line directives are skipped. Bad splits are caught by the chunks failing to parse.
+	std::vector<std::string_view> split_top_level(std::string_view contents, size_t min_length)
+	{
+		std::vector<std::string_view> chunks;
+		size_t start = 0;
+		size_t depth = 0;
+		char previous = '\0';
+		for (size_t i = 0; i < contents.length() && contents[i] != '\0'; i++)
+		{
+			auto c = contents[i];
+			switch (c)
+			{
+			case ' ': case '\t': case '\r': case '\n':
+				continue;
+			case '#':
+				if (contents.compare(i + 1, 4, "line") == 0)
+				{
+					i = std::min(contents.find('\n', i), contents.length());
+					continue;
+				}
+				break;
+			case '"': case '\'':
+				if (previous == '=' || previous == '{' || previous == ',')
+				{
+					// Doubled quotes are part of the string.
+					for (i++; i < contents.length() && contents[i] != '\0'; i++)
+					{
+						if (contents[i] == c)
+						{
+							if (i + 1 < contents.length() && contents[i + 1] == c) { i++; }
+							else { break; }
+						}
+					}
+					if (i >= contents.length() || contents[i] == '\0')
+					{
+						// Unterminated, thus the rest of the contents belong to it.
+						i = contents.length();
+						continue;
+					}
+				}
+				break;
+			case '{':
+				depth++;
+				break;
+			case '}':
+				if (depth > 0) { depth--; }
+				break;
+			case ';':
+				if (depth == 0 && i + 1 - start >= min_length)
+				{
+					chunks.push_back(contents.substr(start, i + 1 - start));
+					start = i + 1;
+				}
+				break;
+			}
+			previous = c;
+		}
+		if (start < contents.length())
+		{
+			chunks.push_back(contents.substr(start));
+		}
+		return chunks;
+	}
+}
+
 void sqf::parser::config::impl_default::instance::skip()
 {
 	while (true)
 	{
+#ifndef DF__SQF_CONFIG__REPORT_PROGRESS_BY_LINE
+		{
+			auto start = m_contents.begin() + m_info.adjusted_offset;
+			auto stop = scan::skip_whitespace(start, m_contents.end());
+			if (stop != start)
+			{
+				// Tabs and carriage returns are not accounted for in file_offset (see below).
+				m_info.file_offset += scan::count_if<scan::any_of<' ', '\n'>>(start, stop);
+				m_info.adjusted_offset += stop - start;
+				scan::advance(start, stop, m_info.line, m_info.column);
+			}
+		}
+#endif // DF__SQF_CONFIG__REPORT_PROGRESS_BY_LINE
 		switch (m_contents[m_info.adjusted_offset])
 		{
 		case ' ': m_info.adjusted_offset++; m_info.file_offset++; m_info.column++; continue;
@@ -91,10 +183,8 @@ size_t sqf::parser::config::impl_default::instance::endchr(size_t off) { return
 //identifier = [_a-zA-Z0-9]*;
 size_t sqf::parser::config::impl_default::instance::identifier(size_t off)
 {
-	return util::len_match<
-		'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o', 'p', 'q', 'r', 's', 't', 'u', 'v', 'w', 'x', 'y', 'z',
-		'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P', 'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z',
-		'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '_'>(m_contents + off);
+	auto start = m_contents.begin() + off;
+	return scan::skip_identifier(start, m_contents.end()) - start;
 }
 //operator_ = [-*+/a-zA-Z><=%_]+;
 size_t sqf::parser::config::impl_default::instance::operator_(size_t off)
@@ -455,24 +545,21 @@ void sqf::parser::config::impl_default::instance::STRING(::sqf::parser::config::
 	size_t i;
 	auto startchr = m_contents[m_info.adjusted_offset];
 	m_info.column++;
-	for (i = m_info.adjusted_offset + 1; m_contents[i] != '\0' && (m_contents[i] != startchr || m_contents[i + 1] == startchr); i++)
+	auto start = m_contents.begin() + m_info.adjusted_offset + 1;
+	auto it = start;
+	while (true)
 	{
-		if (m_contents[i] == startchr)
+		// Contents are null-terminated, thus it[1] is always valid.
+		it = startchr == '"' ? scan::find_first_of<'"', '\0'>(it, m_contents.end()) : scan::find_first_of<'\'', '\0'>(it, m_contents.end());
+		if (it != m_contents.end() && *it == startchr && it[1] == startchr)
 		{
-			m_info.column++;
-			i++;
-		}
-		switch (m_contents[i])
-		{
-		case '\n':
-			m_info.column = 0;
-			m_info.line++;
-			break;
-		default:
-			m_info.column++;
-			break;
+			it += 2;
+			continue;
 		}
+		break;
 	}
+	scan::advance(start, it, m_info.line, m_info.column);
+	i = it - m_contents.begin();
 	i++;
 	m_info.column++;
 	auto fullstring = i - m_info.adjusted_offset - 2 < 0 ? "" : std::string(m_contents.substr(m_info.adjusted_offset + 1, i - m_info.adjusted_offset - 2));
@@ -677,6 +764,69 @@ sqf::parser::config::impl_default::astnode sqf::parser::config::impl_default::in
 	return node;
 }
 
+sqf::parser::config::impl_default::astnode sqf::parser::config::impl_default::parse_ast(std::string& contents, const ::sqf::runtime::fileio::pathinfo& pathinfo, bool& errflag)
+{
+	if (m_jobs > 1 && contents.length() >= parallel_min_length)
+	{
+		// More chunks than threads, as top-level classes may differ a lot in size.
+		auto chunks = split_top_level(contents, std::max(parallel_min_chunk_length, contents.length() / (m_jobs * 4)));
+		if (chunks.size() > 1)
+		{
+			struct parsed_chunk
+			{
+				std::string contents;
+				astnode root;
+				bool errflag = false;
+			};
+			std::vector<parsed_chunk> parsed(chunks.size());
+			auto parse_chunk = [&](size_t i) {
+				// Messages get dropped, as failing chunks cause the contents to be parsed again at once below,
+				// reporting errors at their actual location.
+				BufferedLogger logger(get_logger());
+				impl_default chunk_owner(logger);
+				parsed[i].contents = std::string(chunks[i]);
+				instance inst(chunk_owner, parsed[i].contents, pathinfo);
+				parsed[i].root = inst.parse(parsed[i].errflag);
+			};
+
+			std::atomic<size_t> next = 0;
+			std::vector<std::thread> threads;
+			auto threads_count = std::min(m_jobs, chunks.size());
+			threads.reserve(threads_count);
+			for (size_t j = 0; j < threads_count; j++)
+			{
+				threads.emplace_back([&]() {
+					for (auto i = next++; i < chunks.size(); i = next++)
+					{
+						parse_chunk(i);
+					}
+				});
+			}
+			for (auto& thread : threads)
+			{
+				thread.join();
+			}
+
+			if (std::none_of(parsed.begin(), parsed.end(), [](const parsed_chunk& chunk) { return chunk.errflag; }))
+			{
+				// Merged in source order, thus applying it behaves exactly like applying the contents parsed at once.
+				astnode node;
+				node.kind = nodetype::NODELIST;
+				node.content = contents;
+				node.length = 0;
+				for (auto& chunk : parsed)
+				{
+					node.length += chunk.root.length;
+					std::move(chunk.root.children.begin(), chunk.root.children.end(), std::back_inserter(node.children));
+				}
+				return node;
+			}
+		}
+	}
+	instance i(*this, contents, pathinfo);
+	return i.parse(errflag);
+}
+
 bool sqf::parser::config::impl_default::apply_to_confighost(sqf::parser::config::impl_default::astnode& node, ::sqf::runtime::confighost& confighost, ::sqf::runtime::confignav parent)
 {
 	// ToDo: Check if a corresponding config already exists in confighost before creating it to avoid duplicates
@@ -5,6 +5,7 @@
 #include "../../runtime/confighost.h"
 #include "../../runtime/fileio.h"
 #include "../../runtime/util.h"
+#include "rapified.h"
 
 #include <string>
 #include <string_view>
@@ -106,23 +107,53 @@ namespace sqf::parser::config
 
             ::sqf::parser::config::impl_default::astnode parse(bool& errflag);
         };
+        size_t m_jobs;
+
+        /// <summary>
+        /// Parses the provided contents into a NODELIST astnode.
+        /// Large contents get split at top-level statements and parsed using up to m_jobs threads,
+        /// yielding the same astnode (apart from the diagnostic info of its children) as parsing them at once.
+        /// </summary>
+        ::sqf::parser::config::impl_default::astnode parse_ast(std::string& contents, const ::sqf::runtime::fileio::pathinfo& pathinfo, bool& errflag);
         bool apply_to_confighost(::sqf::parser::config::impl_default::astnode& node, ::sqf::runtime::confighost& confighost, ::sqf::runtime::confignav parent);
+        bool parse_rapified(::sqf::runtime::confighost& target, std::string_view contents, const ::sqf::runtime::fileio::pathinfo& pathinfo)
+        {
+            size_t error_offset;
+            if (rapified::read(target, contents, error_offset))
+            {
+                return true;
+            }
+            log(logmessage::config::MalformedRapifiedConfig(::sqf::runtime::diagnostics::diag_info(1, 0, error_offset, pathinfo, {}), error_offset));
+            return false;
+        }
     public:
-        impl_default(Logger& logger) : CanLog(logger) { }
+        /// <summary>
+        /// Creates a new config parser.
+        /// </summary>
+        /// <param name="logger">The logger to report errors to.</param>
+        /// <param name="jobs">The amount of threads large configs may get parsed with.</param>
+        impl_default(Logger& logger, size_t jobs = 1) : CanLog(logger), m_jobs(jobs) { }
         virtual ~impl_default() override { };
 
         virtual bool check_syntax(std::string contents, ::sqf::runtime::fileio::pathinfo pathinfo) override
         {
-            instance i(*this, contents, pathinfo);
+            if (rapified::is_rapified(contents))
+            {
+                ::sqf::runtime::confighost scratch;
+                return parse_rapified(scratch, contents, pathinfo);
+            }
             bool errflag = false;
-            auto root = i.parse(errflag);
+            auto root = parse_ast(contents, pathinfo, errflag);
             return !errflag;
         }
         virtual bool parse(::sqf::runtime::confighost& target, std::string contents, ::sqf::runtime::fileio::pathinfo pathinfo) override
         {
-            instance i(*this, contents, pathinfo);
+            if (rapified::is_rapified(contents))
+            {
+                return parse_rapified(target, contents, pathinfo);
+            }
             bool errflag = false;
-            auto root = i.parse(errflag);
+            auto root = parse_ast(contents, pathinfo, errflag);
             if (errflag)
             {
                 return {};
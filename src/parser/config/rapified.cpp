@@ -0,0 +1,515 @@
+#include "rapified.h"
+
+#include "../../runtime/d_array.h"
+#include "../../runtime/d_scalar.h"
+#include "../../runtime/d_string.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace
+{
+    // Layout (little endian):
+    //   header: char[4] "\0raP", uint32 0, uint32 8, uint32 offset of the enum table, class body of the root
+    //   class body: asciiz inherited, compressed entry count, entries
+    //   entry: uint8 kind followed by
+    //     0 class:        asciiz name, uint32 offset of the class body
+    //     1 value:        uint8 value kind, asciiz name, value
+    //     2 array:        asciiz name, array
+    //     3 extern class: asciiz name
+    //     4 delete class: asciiz name
+    //     5 array append: uint32 flags, asciiz name, array
+    //   array: compressed count, elements (uint8 value kind, value)
+    //   value: 0 asciiz string, 1 float, 2 int32, 3 array, 4 asciiz variable, 6 int64
+    //   compressed: 7 bits per byte, least significant first, highest bit set if more bytes follow
+    //   enum table: uint32 count, entries (asciiz name, uint32 value)
+    const char signature[4] = { '\0', 'r', 'a', 'P' };
+
+    enum class entry_kind : uint8_t
+    {
+        class_ = 0,
+        value = 1,
+        array = 2,
+        extern_class = 3,
+        delete_class = 4,
+        array_append = 5
+    };
+    enum class value_kind : uint8_t
+    {
+        string = 0,
+        float_ = 1,
+        int32 = 2,
+        array = 3,
+        variable = 4,
+        int64 = 6
+    };
+
+    // Class bodies refer to each other by offset, thus malformed configs could contain cycles.
+    constexpr size_t max_depth = 512;
+
+    class reader
+    {
+        std::string_view m_contents;
+        size_t m_pos;
+    public:
+        reader(std::string_view contents, size_t pos) : m_contents(contents), m_pos(pos) {}
+        size_t position() const { return m_pos; }
+
+        template<typename T>
+        bool read_raw(T& out)
+        {
+            if (m_pos > m_contents.length() || m_contents.length() - m_pos < sizeof(T))
+            {
+                return false;
+            }
+            uint8_t bytes[sizeof(T)];
+            std::memcpy(bytes, m_contents.data() + m_pos, sizeof(T));
+            typename std::conditional<sizeof(T) == 8, uint64_t, uint32_t>::type value = 0;
+            for (size_t i = sizeof(T); i > 0; i--)
+            {
+                value = (value << 8) | bytes[i - 1];
+            }
+            if constexpr (sizeof(T) == 1)
+            {
+                out = static_cast<T>(value);
+            }
+            else
+            {
+                std::memcpy(&out, &value, sizeof(T));
+            }
+            m_pos += sizeof(T);
+            return true;
+        }
+        bool read_asciiz(std::string_view& out)
+        {
+            auto end = m_contents.find('\0', m_pos);
+            if (end == std::string_view::npos)
+            {
+                return false;
+            }
+            out = m_contents.substr(m_pos, end - m_pos);
+            m_pos = end + 1;
+            return true;
+        }
+        bool read_compressed(uint32_t& out)
+        {
+            out = 0;
+            for (uint32_t shift = 0; shift < 32; shift += 7)
+            {
+                uint8_t byte;
+                if (!read_raw(byte))
+                {
+                    return false;
+                }
+                out |= static_cast<uint32_t>(byte & 0x7F) << shift;
+                if ((byte & 0x80) == 0)
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+    };
+
+    // Reads a config, either validating it only (target being empty) or applying it to the target.
+    class config_reader
+    {
+        std::string_view m_contents;
+    public:
+        size_t error_offset = 0;
+
+        config_reader(std::string_view contents) : m_contents(contents) {}
+
+        bool fail(const reader& r)
+        {
+            error_offset = r.position();
+            return false;
+        }
+
+        bool read_value(reader& r, value_kind kind, ::sqf::runtime::value& out, size_t depth)
+        {
+            switch (kind)
+            {
+            case value_kind::string:
+            case value_kind::variable:
+            {
+                std::string_view str;
+                if (!r.read_asciiz(str)) { return fail(r); }
+                out = ::sqf::runtime::value(std::make_shared<::sqf::types::d_string>(std::string(str)));
+                return true;
+            }
+            case value_kind::float_:
+            {
+                float f;
+                if (!r.read_raw(f)) { return fail(r); }
+                out = ::sqf::runtime::value(std::make_shared<::sqf::types::d_scalar>(f));
+                return true;
+            }
+            case value_kind::int32:
+            {
+                int32_t i;
+                if (!r.read_raw(i)) { return fail(r); }
+                out = ::sqf::runtime::value(std::make_shared<::sqf::types::d_scalar>(i));
+                return true;
+            }
+            case value_kind::int64:
+            {
+                int64_t i;
+                if (!r.read_raw(i)) { return fail(r); }
+                out = ::sqf::runtime::value(std::make_shared<::sqf::types::d_scalar>(i));
+                return true;
+            }
+            case value_kind::array:
+                return read_array(r, out, depth + 1);
+            default:
+                return fail(r);
+            }
+        }
+        bool read_array(reader& r, ::sqf::runtime::value& out, size_t depth)
+        {
+            uint32_t count;
+            if (depth > max_depth || !r.read_compressed(count))
+            {
+                return fail(r);
+            }
+            std::vector<::sqf::runtime::value> values;
+            values.reserve(std::min<size_t>(count, m_contents.length()));
+            for (uint32_t i = 0; i < count; i++)
+            {
+                uint8_t kind;
+                if (!r.read_raw(kind))
+                {
+                    return fail(r);
+                }
+                if (!read_value(r, static_cast<value_kind>(kind), values.emplace_back(), depth))
+                {
+                    return false;
+                }
+            }
+            out = ::sqf::runtime::value(std::make_shared<::sqf::types::d_array>(std::move(values)));
+            return true;
+        }
+
+        // Reads the entries of the class body at the provided offset. Nested classes are read as they are
+        // encountered, applying everything in the same order parsing the text form would.
+        bool read_body(size_t offset, const ::sqf::runtime::confignav* target, size_t depth)
+        {
+            reader r(m_contents, offset);
+            std::string_view inherited;
+            uint32_t count;
+            if (offset > m_contents.length() || depth > max_depth || !r.read_asciiz(inherited) || !r.read_compressed(count))
+            {
+                return fail(r);
+            }
+            for (uint32_t i = 0; i < count; i++)
+            {
+                uint8_t kind;
+                std::string_view name;
+                if (!r.read_raw(kind))
+                {
+                    return fail(r);
+                }
+                switch (static_cast<entry_kind>(kind))
+                {
+                case entry_kind::class_:
+                {
+                    uint32_t body;
+                    if (!r.read_asciiz(name) || !r.read_raw(body))
+                    {
+                        return fail(r);
+                    }
+                    reader peek(m_contents, body);
+                    std::string_view body_inherited;
+                    if (!peek.read_asciiz(body_inherited))
+                    {
+                        return fail(peek);
+                    }
+                    if (target)
+                    {
+                        auto node = target->append_or_replace(std::string(name), std::string(body_inherited));
+                        if (!read_body(body, &node, depth + 1)) { return false; }
+                    }
+                    else if (!read_body(body, nullptr, depth + 1))
+                    {
+                        return false;
+                    }
+                } break;
+                case entry_kind::value:
+                {
+                    uint8_t value_kind_raw;
+                    ::sqf::runtime::value value;
+                    if (!r.read_raw(value_kind_raw) || !r.read_asciiz(name))
+                    {
+                        return fail(r);
+                    }
+                    if (static_cast<value_kind>(value_kind_raw) == value_kind::array || !read_value(r, static_cast<value_kind>(value_kind_raw), value, depth))
+                    {
+                        return fail(r);
+                    }
+                    if (target)
+                    {
+                        target->append_or_replace(std::string(name)).value(std::move(value));
+                    }
+                } break;
+                case entry_kind::array:
+                case entry_kind::array_append:
+                {
+                    uint32_t flags;
+                    ::sqf::runtime::value value;
+                    if ((static_cast<entry_kind>(kind) == entry_kind::array_append && !r.read_raw(flags)) || !r.read_asciiz(name))
+                    {
+                        return fail(r);
+                    }
+                    if (!read_array(r, value, depth))
+                    {
+                        return false;
+                    }
+                    if (!target)
+                    {
+                        break;
+                    }
+                    auto node = target->append_or_replace(std::string(name));
+                    node.value(value);
+                    if (static_cast<entry_kind>(kind) == entry_kind::array_append)
+                    {
+                        auto parent_inherited = node.parent_logical().parent_inherited();
+                        auto valuefield = parent_inherited / std::string(name);
+                        if (!valuefield.empty())
+                        {
+                            auto self = node->value.data_try<::sqf::types::d_array>();
+                            auto other = valuefield->value.data_try<::sqf::types::d_array>();
+                            if (self.get() && other.get())
+                            {
+                                self->insert(self->end(), other->begin(), other->end());
+                            }
+                        }
+                    }
+                } break;
+                case entry_kind::extern_class:
+                {
+                    if (!r.read_asciiz(name))
+                    {
+                        return fail(r);
+                    }
+                    if (target)
+                    {
+                        target->append_or_replace(std::string(name));
+                    }
+                } break;
+                case entry_kind::delete_class:
+                {
+                    if (!r.read_asciiz(name))
+                    {
+                        return fail(r);
+                    }
+                    if (target)
+                    {
+                        target->delete_inherited_or_replace(std::string(name));
+                    }
+                } break;
+                default:
+                    return fail(r);
+                }
+            }
+            return true;
+        }
+    };
+
+    class writer
+    {
+        const std::vector<::sqf::runtime::config::container>& m_containers;
+    public:
+        std::string output;
+
+        writer(const std::vector<::sqf::runtime::config::container>& containers) : m_containers(containers) {}
+
+        template<typename T>
+        void write_raw(T value)
+        {
+            uint8_t bytes[sizeof(T)];
+            typename std::conditional<sizeof(T) == 8, uint64_t, uint32_t>::type raw = 0;
+            std::memcpy(&raw, &value, sizeof(T));
+            for (size_t i = 0; i < sizeof(T); i++, raw >>= 8)
+            {
+                bytes[i] = static_cast<uint8_t>(raw & 0xFF);
+            }
+            output.append(reinterpret_cast<const char*>(bytes), sizeof(T));
+        }
+        void patch_uint32(size_t pos, uint32_t value)
+        {
+            for (size_t i = 0; i < 4; i++, value >>= 8)
+            {
+                output[pos + i] = static_cast<char>(value & 0xFF);
+            }
+        }
+        void write_asciiz(std::string_view str)
+        {
+            output.append(str.substr(0, str.find('\0')));
+            output.push_back('\0');
+        }
+        void write_compressed(uint32_t value)
+        {
+            do
+            {
+                auto byte = static_cast<uint8_t>(value & 0x7F);
+                value >>= 7;
+                output.push_back(static_cast<char>(value ? byte | 0x80 : byte));
+            } while (value);
+        }
+
+        // Scalars holding integers are written as such, as done when rapifying the text form.
+        static value_kind kind_of(const ::sqf::runtime::value& value)
+        {
+            if (value.data_try<::sqf::types::d_array>())
+            {
+                return value_kind::array;
+            }
+            if (auto scalar = value.data_try<::sqf::types::d_scalar>())
+            {
+                auto f = scalar->value();
+                return std::trunc(f) == f && f >= -2147483648.0f && f < 2147483648.0f ? value_kind::int32 : value_kind::float_;
+            }
+            return value_kind::string;
+        }
+        void write_value(const ::sqf::runtime::value& value, value_kind kind, size_t depth)
+        {
+            switch (kind)
+            {
+            case value_kind::array: write_array(*value.data_try<::sqf::types::d_array>(), depth + 1); break;
+            case value_kind::int32: write_raw(static_cast<int32_t>(value.data_try<::sqf::types::d_scalar>()->value())); break;
+            case value_kind::float_: write_raw(value.data_try<::sqf::types::d_scalar>()->value()); break;
+            default: write_asciiz(value.to_string()); break;
+            }
+        }
+        // Arrays are not expected to contain themselves, yet are cut off at max_depth to not recurse endlessly.
+        void write_array(::sqf::types::d_array& arr, size_t depth)
+        {
+            if (depth > max_depth)
+            {
+                write_compressed(0);
+                return;
+            }
+            write_compressed(static_cast<uint32_t>(arr.size()));
+            for (auto& it : arr)
+            {
+                auto kind = kind_of(it);
+                output.push_back(static_cast<char>(kind));
+                write_value(it, kind, depth);
+            }
+        }
+
+        void write_body(size_t id)
+        {
+            auto& container = m_containers[id];
+            write_asciiz(container.id_parent_inherited == ::sqf::runtime::config::invalid_id ? std::string_view{} : m_containers[container.id_parent_inherited].name);
+
+            std::vector<std::string_view> deleted;
+            std::vector<size_t> children;
+            for (auto& child : container)
+            {
+                if (child.id == ::sqf::runtime::config::invalid_id)
+                {
+                    deleted.push_back(child.name());
+                }
+                else
+                {
+                    children.push_back(child.id);
+                }
+            }
+            write_compressed(static_cast<uint32_t>(children.size() + deleted.size()));
+
+            std::vector<std::pair<size_t, size_t>> classes;
+            for (auto child_id : children)
+            {
+                auto& child = m_containers[child_id];
+                if (child.value.empty())
+                {
+                    output.push_back(static_cast<char>(entry_kind::class_));
+                    write_asciiz(child.name);
+                    classes.emplace_back(output.size(), child_id);
+                    write_raw<uint32_t>(0);
+                    continue;
+                }
+                auto kind = kind_of(child.value);
+                if (kind == value_kind::array)
+                {
+                    output.push_back(static_cast<char>(entry_kind::array));
+                }
+                else
+                {
+                    output.push_back(static_cast<char>(entry_kind::value));
+                    output.push_back(static_cast<char>(kind));
+                }
+                write_asciiz(child.name);
+                write_value(child.value, kind, 0);
+            }
+            for (auto& name : deleted)
+            {
+                output.push_back(static_cast<char>(entry_kind::delete_class));
+                write_asciiz(name);
+            }
+            for (auto& [pos, child_id] : classes)
+            {
+                patch_uint32(pos, static_cast<uint32_t>(output.size()));
+                write_body(child_id);
+            }
+        }
+    };
+}
+
+bool sqf::parser::config::rapified::is_rapified(std::string_view contents)
+{
+    return contents.length() >= sizeof(signature) && std::memcmp(contents.data(), signature, sizeof(signature)) == 0;
+}
+
+bool sqf::parser::config::rapified::read(::sqf::runtime::confighost& target, std::string_view contents, size_t& error_offset)
+{
+    if (!is_rapified(contents))
+    {
+        error_offset = 0;
+        return false;
+    }
+    reader header(contents, sizeof(signature));
+    uint32_t always_zero, always_eight, enum_offset;
+    if (!header.read_raw(always_zero) || !header.read_raw(always_eight) || !header.read_raw(enum_offset))
+    {
+        error_offset = header.position();
+        return false;
+    }
+
+    config_reader validation(contents);
+    if (!validation.read_body(header.position(), nullptr, 0))
+    {
+        error_offset = validation.error_offset;
+        return false;
+    }
+    config_reader apply(contents);
+    auto root = target.root();
+    apply.read_body(header.position(), &root, 0);
+    return true;
+}
+
+std::string sqf::parser::config::rapified::write(const ::sqf::runtime::confighost& source)
+{
+    writer w(source.containers());
+    w.output.append(signature, sizeof(signature));
+    w.write_raw<uint32_t>(0);
+    w.write_raw<uint32_t>(8);
+    auto enum_offset_pos = w.output.size();
+    w.write_raw<uint32_t>(0);
+    if (!source.containers().empty())
+    {
+        w.write_body(0);
+    }
+    else
+    {
+        w.write_asciiz({});
+        w.write_compressed(0);
+    }
+    w.patch_uint32(enum_offset_pos, static_cast<uint32_t>(w.output.size()));
+    w.write_raw<uint32_t>(0);
+    return w.output;
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include "../../runtime/confighost.h"
+
+#include <string>
+#include <string_view>
+
+namespace sqf::parser::config
+{
+    /// <summary>
+    /// Reader and writer for rapified (binarized) configs, the format of config.bin files produced by the Arma tools.
+    /// </summary>
+    /// <remarks>
+    /// Classes get applied the same way parsing the text form does, thus inheritance and deletions are resolved
+    /// against the classes already present in the confighost. Enums are ignored.
+    /// </remarks>
+    namespace rapified
+    {
+        /// <summary>
+        /// Checks whether the provided contents start with the signature of a rapified config.
+        /// </summary>
+        bool is_rapified(std::string_view contents);
+
+        /// <summary>
+        /// Reads the rapified config into the provided confighost.
+        /// The whole config is validated first, leaving the confighost untouched if it is malformed.
+        /// </summary>
+        /// <param name="target">The confighost to merge the config into.</param>
+        /// <param name="contents">The rapified config.</param>
+        /// <param name="error_offset">Receives the offset the config was found to be malformed at.</param>
+        /// <returns>True on success. False if the config is malformed.</returns>
+        bool read(::sqf::runtime::confighost& target, std::string_view contents, size_t& error_offset);
+
+        /// <summary>
+        /// Writes the provided confighost in rapified form.
+        /// </summary>
+        /// <remarks>
+        /// Arrays extended using += are written with their final contents and classes
+        /// without body (class a;) are written as empty classes, as the confighost does not keep track of either.
+        /// </remarks>
+        std::string write(const ::sqf::runtime::confighost& source);
+    }
+}
@@ -5,8 +5,10 @@
 #include "../../runtime/value.h"
 
 #include <algorithm>
+#include <functional>
 #include <cctype>
 #include <sstream>
+#include <string_view>
 #include <utility>
 #include <vector>
 #include <string>
@@ -22,25 +24,32 @@ namespace err = logmessage::preprocessor;
 using namespace std::string_literals;
 using namespace sqf::runtime::util;
 
+// Identifies a file read, being the physical path for files on disk and
+// the physical path of the archive followed by the entry for files inside of archives.
+static std::string file_key(const ::sqf::runtime::fileio::pathinfo& pathinfo)
+{
+    return pathinfo.additional.empty() ? pathinfo.physical : pathinfo.physical + '/' + pathinfo.additional;
+}
+
 void sqf::parser::preprocessor::impl_default::instance::replace_stringify(
     ::sqf::runtime::runtime& runtime,
     preprocessorfileinfo& local_fileinfo,
     preprocessorfileinfo& original_fileinfo,
     const ::sqf::runtime::parser::macro& m,
     std::vector<std::string>& params,
-    std::stringstream& sstream,
+    std::string& output,
     const std::unordered_map<std::string, std::string>& param_map)
 {
 #ifdef DF__SQF_PREPROC__TRACE_MACRO_RESOLVE
-    auto ___begin = sstream.tellp();
+    auto ___begin = output.size();
 #endif
     char c;
-    replace_skip(runtime, local_fileinfo, sstream);
+    replace_skip(runtime, local_fileinfo, output);
     c = local_fileinfo.peek();
     if (c == '#')
     {
         local_fileinfo.next();
-        replace_concat(runtime, local_fileinfo, original_fileinfo, m, params, sstream, param_map);
+        replace_concat(runtime, local_fileinfo, original_fileinfo, m, params, output, param_map);
     }
     else
     {
@@ -51,35 +60,27 @@ void sqf::parser::preprocessor::impl_default::instance::replace_stringify(
         {
             word[i] = local_fileinfo.next();
         }
-        auto param_res = std::find_if(
-            m.args().begin(),
-            m.args().end(),
-            [word](std::string s) -> bool {
-                return s.compare(word) == 0;
-            }
-        );
+        auto param_res = std::find(m.args().begin(), m.args().end(), word);
         if (param_res != m.args().end())
         {
             auto index = param_res - m.args().begin();
-            sstream << '"' << params[index] << '"';
+            output.push_back('"');
+            output.append(params[index]);
+            output.push_back('"');
         }
         else
         {
-            auto macro_res = std::find_if(
-                m_macros.begin(),
-                m_macros.end(),
-                [word](std::unordered_map<std::string, ::sqf::runtime::parser::macro>::value_type m) -> bool {
-                    return m.first.compare(word) == 0;
-                }
-            );
+            auto macro_res = m_macros.find(word);
+            output.push_back('"');
             if (macro_res == m_macros.end())
             {
-                sstream << '"' << word << '"';
+                output.append(word);
             }
             else
             {
-                sstream << '"' << handle_macro(runtime, local_fileinfo, original_fileinfo, macro_res->second, param_map) << '"';
+                output.append(handle_macro(runtime, local_fileinfo, original_fileinfo, macro_res->second, param_map));
             }
+            output.push_back('"');
         }
     }
 #ifdef DF__SQF_PREPROC__TRACE_MACRO_RESOLVE
@@ -103,7 +104,7 @@ void sqf::parser::preprocessor::impl_default::instance::replace_stringify(
     }
     std::cout << " }";
 
-    std::cout << ", stringstream, unordered_map<string, string>: ";
+    std::cout << ", string, unordered_map<string, string>: ";
     std::cout << "{ ";
     ___first = false;
     for (auto& it : param_map)
@@ -119,7 +120,7 @@ void sqf::parser::preprocessor::impl_default::instance::replace_stringify(
         std::cout << "{ " << it.first << ", " << it.second << " }";
     }
     std::cout << " }";
-    std::cout << ")\033[0m:" << sstream.str().substr(___begin) << std::endl;
+    std::cout << ")\033[0m:" << output.substr(___begin) << std::endl;
 #endif
 }
 void sqf::parser::preprocessor::impl_default::instance::replace_concat(
@@ -128,14 +129,14 @@ void sqf::parser::preprocessor::impl_default::instance::replace_concat(
     preprocessorfileinfo& original_fileinfo,
     const ::sqf::runtime::parser::macro& m,
     std::vector<std::string>& params,
-    std::stringstream& sstream,
+    std::string& output,
     const std::unordered_map<std::string, std::string>& param_map)
 {
 #ifdef DF__SQF_PREPROC__TRACE_MACRO_RESOLVE
-    auto ___begin = sstream.tellp();
+    auto ___begin = output.size();
 #endif
     char c;
-    replace_skip(runtime, local_fileinfo, sstream);
+    replace_skip(runtime, local_fileinfo, output);
     c = local_fileinfo.peek();
     auto word_end = replace_find_wordend(runtime, local_fileinfo);
     std::string word;
@@ -144,34 +145,22 @@ void sqf::parser::preprocessor::impl_default::instance::replace_concat(
     {
         word[i] = local_fileinfo.next();
     }
-    auto param_res = std::find_if(
-        m.args().begin(),
-        m.args().end(),
-        [word](std::string s) -> bool {
-            return s.compare(word) == 0;
-        }
-    );
+    auto param_res = std::find(m.args().begin(), m.args().end(), word);
     if (param_res != m.args().end())
     {
         auto index = param_res - m.args().begin();
-        sstream << params[index];
+        output.append(params[index]);
     }
     else
     {
-        auto macro_res = std::find_if(
-            m_macros.begin(),
-            m_macros.end(),
-            [word](std::unordered_map<std::string, ::sqf::runtime::parser::macro>::value_type m) -> bool {
-                return m.first.compare(word) == 0;
-            }
-        );
+        auto macro_res = m_macros.find(word);
         if (macro_res == m_macros.end())
         {
-            sstream << word;
+            output.append(word);
         }
         else
         {
-            sstream << handle_macro(runtime, local_fileinfo, original_fileinfo, macro_res->second, param_map);
+            output.append(handle_macro(runtime, local_fileinfo, original_fileinfo, macro_res->second, param_map));
         }
     }
 #ifdef DF__SQF_PREPROC__TRACE_MACRO_RESOLVE
@@ -195,7 +184,7 @@ void sqf::parser::preprocessor::impl_default::instance::replace_concat(
     }
     std::cout << " }";
 
-    std::cout << ", stringstream, unordered_map<string, string>: ";
+    std::cout << ", string, unordered_map<string, string>: ";
     std::cout << "{ ";
     ___first = false;
     for (auto& it : param_map)
@@ -211,7 +200,7 @@ void sqf::parser::preprocessor::impl_default::instance::replace_concat(
         std::cout << "{ " << it.first << ", " << it.second << " }";
     }
     std::cout << " }";
-    std::cout << ")\033[0m:" << sstream.str().substr(___begin) << std::endl;
+    std::cout << ")\033[0m:" << output.substr(___begin) << std::endl;
 #endif
 }
 
@@ -255,12 +244,12 @@ exit:
 #endif
     return res;
 }
-void sqf::parser::preprocessor::impl_default::instance::replace_skip(::sqf::runtime::runtime& runtime, preprocessorfileinfo& fileinfo, std::stringstream& sstream)
+void sqf::parser::preprocessor::impl_default::instance::replace_skip(::sqf::runtime::runtime& runtime, preprocessorfileinfo& fileinfo, std::string& output)
 {
     bool flag = true;
     bool in_string = false;
 #ifdef DF__SQF_PREPROC__TRACE_MACRO_RESOLVE
-    auto ___begin = sstream.tellp();
+    auto ___begin = output.size();
 #endif
     while (flag)
     {
@@ -271,7 +260,7 @@ void sqf::parser::preprocessor::impl_default::instance::replace_skip(::sqf::runt
             {
                 in_string = false;
             }
-            sstream << c;
+            output.push_back(c);
         }
         else
         {
@@ -301,7 +290,7 @@ void sqf::parser::preprocessor::impl_default::instance::replace_skip(::sqf::runt
             case '"':
                 in_string = true;
             default:
-                sstream << fileinfo.next();
+                output.push_back(fileinfo.next());
             }
         }
     }
@@ -309,7 +298,7 @@ void sqf::parser::preprocessor::impl_default::instance::replace_skip(::sqf::runt
     std::cout << "\x1B[33m[PREPROCESSOR-RS]\033[0m" <<
         "        " <<
         "        " <<
-        "    " << "\x1B[36mreplace_skip(runtime, preprocessorfileinfo, stringstream)\033[0m: " << sstream.str().substr(___begin) << std::endl;
+        "    " << "\x1B[36mreplace_skip(runtime, preprocessorfileinfo, string)\033[0m: " << output.substr(___begin) << std::endl;
 #endif
 }
 std::string sqf::parser::preprocessor::impl_default::instance::replace(::sqf::runtime::runtime& runtime, preprocessorfileinfo& original_fileinfo, const ::sqf::runtime::parser::macro& m, std::vector<std::string>& params)
@@ -320,24 +309,44 @@ std::string sqf::parser::preprocessor::impl_default::instance::replace(::sqf::ru
         log(err::ArgCountMissmatch(m.diag_info()));
         return "";
     }
-    preprocessorfileinfo local_fileinfo(m.diag_info());
-    local_fileinfo.content = m.content();
-    local_fileinfo.line = m.diag_info().line;
     if (m.has_callback())
     {
+        m_callback_expansions++;
         return m(original_fileinfo, original_fileinfo, params, runtime);
     }
-
-    std::unordered_map<std::string, std::string> parammap;
-    for (size_t i = 0; i < params.size(); i++)
+    auto res = m_expansions.find(&m);
+    if (res == m_expansions.end())
+    {
+        res = m_expansions.emplace(&m, expansion{ tokenize_body(m) }).first;
+    }
+    // References into m_expansions stay valid while nested macros add their own.
+    auto& state = res->second;
+    if (params.empty() && state.memoized && state.macros_hash == m_macros_hash)
     {
-        parammap[m.args()[i]] = params[i];
+        return state.output;
     }
+    auto callback_expansions = m_callback_expansions;
+    auto logged = m_logged;
+
+    // Refers to the path of m without owning it, as m outlives local_fileinfo.
+    preprocessorfileinfo local_fileinfo(std::shared_ptr<const ::sqf::runtime::fileio::pathinfo>(
+        std::shared_ptr<const ::sqf::runtime::fileio::pathinfo>(), &m.diag_info().path));
+    local_fileinfo.content = m.content();
+    local_fileinfo.line = m.diag_info().line;
+
+    // Only required by nested macros, thus filled on demand.
+    std::unordered_map<std::string, std::string> parammap;
 
-    std::stringstream sstream;
+    std::string output;
+    output.reserve(m.content().length());
 
+    bool done = state.tokens.has_value() && replace_tokens(runtime, local_fileinfo, original_fileinfo, m, params, *state.tokens, output, parammap);
+    if (!done)
+    {
+        fill_param_map(m, params, parammap);
+    }
     char c;
-    while (true)
+    while (!done)
     {
 #ifdef DF__SQF_PREPROC__TRACE_MACRO_RESOLVE
         std::cout << "\x1B[33m[PREPROCESSOR-RS]\033[0m" <<
@@ -345,18 +354,18 @@ std::string sqf::parser::preprocessor::impl_default::instance::replace(::sqf::ru
             "        " <<
             "    " << "\x1B[36mreplace(...)\033[0m: Remaining: " << local_fileinfo.content.substr(local_fileinfo.off) << std::endl;
 #endif
-        replace_skip(runtime, local_fileinfo, sstream);
+        replace_skip(runtime, local_fileinfo, output);
         c = local_fileinfo.peek();
 
         if (c == '#')
         {
             local_fileinfo.next();
-            replace_stringify(runtime, local_fileinfo, original_fileinfo, m, params, sstream, parammap);
+            replace_stringify(runtime, local_fileinfo, original_fileinfo, m, params, output, parammap);
         }
         else if (c == '\n' || c == '\0')
         {
             local_fileinfo.next();
-            break;
+            done = true;
         }
         else
         {
@@ -370,7 +379,7 @@ std::string sqf::parser::preprocessor::impl_default::instance::replace(::sqf::ru
                     "        " <<
                     "    " << "\x1B[36mreplace(...)\033[0m: Appending end: " << local_fileinfo.next() << std::endl;
 #endif
-                sstream << local_fileinfo.next();
+                output.push_back(local_fileinfo.next());
             }
             else
             { // Receive next word
@@ -382,13 +391,7 @@ std::string sqf::parser::preprocessor::impl_default::instance::replace(::sqf::ru
                 }
 
                 // Check if word matches any parameter
-                auto param_res = std::find_if(
-                    m.args().begin(),
-                    m.args().end(),
-                    [word](std::string s) -> bool {
-                        return s.compare(word) == 0;
-                    }
-                );
+                auto param_res = std::find(m.args().begin(), m.args().end(), word);
                 if (param_res != m.args().end())
                 { // word matches a parameter, replacee
                     auto index = param_res - m.args().begin();
@@ -398,20 +401,20 @@ std::string sqf::parser::preprocessor::impl_default::instance::replace(::sqf::ru
                         "        " <<
                         "    " << "\x1B[36mreplace(...)\033[0m: Inserting parameter[" << index << "]: " << params[index] << std::endl;
 #endif
-                    sstream << params[index];
+                    output.append(params[index]);
                 }
                 else
                 { // Check if word matches any macro
                     auto macro_res = m_macros.find(word);
                     if (macro_res == m_macros.end())
-                    { // word matches no macro, append to sstream
+                    { // word matches no macro, append to output
 #ifdef DF__SQF_PREPROC__TRACE_MACRO_RESOLVE
                         std::cout << "\x1B[33m[PREPROCESSOR-RS]\033[0m" <<
                             "        " <<
                             "        " <<
                             "    " << "\x1B[36mreplace(...)\033[0m: Adding word: " << word << std::endl;
 #endif
-                        sstream << word;
+                        output.append(word);
                     }
                     else
                     { // word matches macro, handle it
@@ -422,7 +425,7 @@ std::string sqf::parser::preprocessor::impl_default::instance::replace(::sqf::ru
                             "        " <<
                             "    " << "\x1B[36mreplace(...)\033[0m: Adding macro result: " << res << std::endl;
 #endif
-                        sstream << res;
+                        output.append(res);
                     }
                 }
             }
@@ -449,9 +452,196 @@ std::string sqf::parser::preprocessor::impl_default::instance::replace(::sqf::ru
         std::cout << it;
     }
     std::cout << " }";
-    std::cout << ")\033[0m: " << sstream.str() << std::endl;
+    std::cout << ")\033[0m: " << output << std::endl;
 #endif
-    return sstream.str();
+    // Only results solely depending on the macros defined are kept.
+    if (params.empty() && !m_errflag && callback_expansions == m_callback_expansions && logged == m_logged)
+    {
+        state.memoized = true;
+        state.macros_hash = m_macros_hash;
+        state.output = output;
+    }
+    return output;
+}
+std::optional<std::vector<sqf::parser::preprocessor::impl_default::instance::body_token>> sqf::parser::preprocessor::impl_default::instance::tokenize_body(const ::sqf::runtime::parser::macro& m)
+{
+    auto content = m.content();
+    if (content.find_first_of("/\\\r\n"s + '\0') != std::string_view::npos)
+    {
+        return {};
+    }
+    std::vector<body_token> tokens;
+    size_t i = 0;
+    while (i < content.length())
+    {
+        // Same as replace_skip, copying strings as a whole.
+        size_t start = i;
+        while (i < content.length() && content[i] != '#' && !::sqf::parser::scan::identifier_chars::scalar(content[i]))
+        {
+            if (content[i] == '"')
+            {
+                i = content.find('"', i + 1);
+                if (i == std::string_view::npos)
+                {
+                    return {};
+                }
+            }
+            i++;
+        }
+        if (i != start)
+        {
+            tokens.push_back({ body_token::kind::text, start, i - start, std::string::npos });
+        }
+        if (i == content.length())
+        {
+            break;
+        }
+        if (content[i] == '#')
+        {
+            tokens.push_back({ body_token::kind::hash, i, 1, std::string::npos });
+            i++;
+            continue;
+        }
+        start = i;
+        i = static_cast<size_t>(::sqf::parser::scan::skip_identifier(content.data() + i, content.data() + content.length()) - content.data());
+        auto param = std::find(m.args().begin(), m.args().end(), content.substr(start, i - start));
+        tokens.push_back({ body_token::kind::word, start, i - start,
+            param == m.args().end() ? std::string::npos : static_cast<size_t>(param - m.args().begin()) });
+    }
+    return tokens;
+}
+void sqf::parser::preprocessor::impl_default::instance::fill_param_map(const ::sqf::runtime::parser::macro& m, const std::vector<std::string>& params, std::unordered_map<std::string, std::string>& param_map)
+{
+    for (size_t i = 0; i < params.size(); i++)
+    {
+        param_map[m.args()[i]] = params[i];
+    }
+}
+bool sqf::parser::preprocessor::impl_default::instance::replace_tokens(
+    ::sqf::runtime::runtime& runtime,
+    preprocessorfileinfo& local_fileinfo,
+    preprocessorfileinfo& original_fileinfo,
+    const ::sqf::runtime::parser::macro& m,
+    std::vector<std::string>& params,
+    const std::vector<body_token>& tokens,
+    std::string& output,
+    std::unordered_map<std::string, std::string>& param_map)
+{
+    auto content = m.content();
+    size_t index = 0;
+    // Characters of tokens[index] already consumed by a nested macro.
+    size_t consumed = 0;
+    auto at = [&](body_token::kind kind) { return index < tokens.size() && tokens[index].type == kind; };
+    auto offset = [&]() { return index < tokens.size() ? tokens[index].offset + consumed : content.length(); };
+    auto skip = [&]() {
+        if (at(body_token::kind::text))
+        {
+            output.append(content.substr(tokens[index].offset + consumed, tokens[index].length - consumed));
+            index++;
+            consumed = 0;
+        }
+    };
+    // Expands a nested macro, which may consume arguments following it.
+    auto expand = [&](const ::sqf::runtime::parser::macro& nested) -> bool {
+        auto end = offset();
+        local_fileinfo.off = end;
+        local_fileinfo.col = end;
+        if (param_map.empty())
+        {
+            fill_param_map(m, params, param_map);
+        }
+        output.append(handle_macro(runtime, local_fileinfo, original_fileinfo, nested, param_map));
+        if (local_fileinfo.off == end)
+        {
+            return true;
+        }
+        while (index < tokens.size() && tokens[index].offset + tokens[index].length <= local_fileinfo.off)
+        {
+            index++;
+        }
+        if (index < tokens.size() && tokens[index].offset < local_fileinfo.off)
+        {
+            // Arguments end with ')', which is part of a text token.
+            if (tokens[index].type != body_token::kind::text)
+            {
+                return false;
+            }
+            consumed = local_fileinfo.off - tokens[index].offset;
+        }
+        return true;
+    };
+    // Handles the (possibly empty) word following '#' or '##', matching replace_stringify and replace_concat.
+    auto operand = [&](bool quote) -> bool {
+        std::string word;
+        size_t param = std::string::npos;
+        if (at(body_token::kind::word))
+        {
+            word = content.substr(tokens[index].offset, tokens[index].length);
+            param = tokens[index].param;
+            index++;
+        }
+        if (quote) { output.push_back('"'); }
+        bool aligned = true;
+        if (param != std::string::npos)
+        {
+            output.append(params[param]);
+        }
+        else if (auto nested = find(word))
+        {
+            aligned = expand(*nested);
+        }
+        else
+        {
+            output.append(word);
+        }
+        if (quote) { output.push_back('"'); }
+        return aligned;
+    };
+
+    while (true)
+    {
+        skip();
+        if (index == tokens.size())
+        {
+            return true;
+        }
+        bool aligned = true;
+        auto& token = tokens[index++];
+        if (token.type == body_token::kind::hash)
+        {
+            skip();
+            if (at(body_token::kind::hash))
+            {
+                index++;
+                skip();
+                aligned = operand(false);
+            }
+            else
+            {
+                aligned = operand(true);
+            }
+        }
+        else if (token.param != std::string::npos)
+        {
+            output.append(params[token.param]);
+        }
+        else
+        {
+            std::string word(content.substr(token.offset, token.length));
+            if (auto nested = find(word))
+            {
+                aligned = expand(*nested);
+            }
+            else
+            {
+                output.append(word);
+            }
+        }
+        if (!aligned)
+        {
+            return false;
+        }
+    }
 }
 std::string sqf::parser::preprocessor::impl_default::instance::handle_arg(::sqf::runtime::runtime& runtime, preprocessorfileinfo& local_fileinfo, preprocessorfileinfo& original_fileinfo, size_t endindex, const std::unordered_map<std::string, std::string>& param_map)
 {
@@ -459,7 +649,8 @@ std::string sqf::parser::preprocessor::impl_default::instance::handle_arg(::sqf:
     bool inside_word = false;
     bool string_mode = false;
     bool part_of_word = false;
-    std::stringstream sstream;
+    std::string output;
+    output.reserve(endindex - local_fileinfo.off);
     char c;
     while (local_fileinfo.off != endindex && (c = local_fileinfo.next()) != '\0')
     {
@@ -469,14 +660,14 @@ std::string sqf::parser::preprocessor::impl_default::instance::handle_arg(::sqf:
             {
                 string_mode = false;
             }
-            sstream << c;
+            output.push_back(c);
             continue;
         }
         switch (c)
         {
         case '"':
             string_mode = true;
-            sstream << c;
+            output.push_back(c);
             break;
         case 'a': case 'b': case 'c': case 'd': case 'e':
         case 'f': case 'g': case 'h': case 'i': case 'j':
@@ -505,28 +696,28 @@ std::string sqf::parser::preprocessor::impl_default::instance::handle_arg(::sqf:
             if (inside_word)
             {
                 inside_word = false;
-                auto word = local_fileinfo.content.substr(word_start, local_fileinfo.off - word_start - (!part_of_word ? 1 : 0));
-                auto res = get_try(word);
-                if (res.has_value())
+                std::string word(local_fileinfo.content.substr(word_start, local_fileinfo.off - word_start - (!part_of_word ? 1 : 0)));
+                auto res = find(word);
+                if (res)
                 {
-                    if (res.value().is_callable())
+                    if (res->is_callable())
                     {
                         local_fileinfo.move_back();
                     }
-                    auto handled = handle_macro(runtime, local_fileinfo, original_fileinfo, res.value(), param_map);
+                    auto handled = handle_macro(runtime, local_fileinfo, original_fileinfo, *res, param_map);
                     if (m_errflag)
                     {
                         return "";
                     }
-                    sstream << handled;
-                    if (!res.value().is_callable() && !part_of_word)
+                    output.append(handled);
+                    if (!res->is_callable() && !part_of_word)
                     {
                         local_fileinfo.move_back();
                     }
                 }
                 else if (param_map.find(word) != param_map.end())
                 {
-                    sstream << param_map.at(word);
+                    output.append(param_map.at(word));
                     if (!part_of_word)
                     {
                         local_fileinfo.move_back();
@@ -534,7 +725,7 @@ std::string sqf::parser::preprocessor::impl_default::instance::handle_arg(::sqf:
                 }
                 else
                 {
-                    sstream << word;
+                    output.append(word);
                     if (!part_of_word)
                     {
                         local_fileinfo.move_back();
@@ -543,13 +734,13 @@ std::string sqf::parser::preprocessor::impl_default::instance::handle_arg(::sqf:
             }
             else
             {
-                sstream << c;
+                output.push_back(c);
             }
             part_of_word = false;
             break;
         }
     }
-    return sstream.str();
+    return output;
 }
 std::string sqf::parser::preprocessor::impl_default::instance::handle_macro(::sqf::runtime::runtime& runtime, preprocessorfileinfo& local_fileinfo, preprocessorfileinfo& original_fileinfo, const ::sqf::runtime::parser::macro& m, const std::unordered_map<std::string, std::string>& param_map)
 { // Needs to handle 'NAME(ARG1, ARG2, ARGN)' not more, not less!
@@ -703,42 +894,39 @@ std::string sqf::parser::preprocessor::impl_default::instance::parse_ppinstructi
         line.erase(endIter, line.end());
         try
         {
-            auto include_path_info = runtime.fileio().get_info(line, fileinfo);
+            auto include_path_info = runtime.fileio().get_info(line, fileinfo, get_logger());
             if (!include_path_info.has_value())
             {
                 m_errflag = true;
                 log(err::IncludeFailed(fileinfo.operator ::sqf::runtime::diagnostics::diag_info(), line, "FileIO returned no file."));
                 return "";
             }
-            const auto& physical = include_path_info->physical;
+            auto key = file_key(*include_path_info);
             auto res = std::find_if(m_file_scopes.begin(), m_file_scopes.end(),
-                [physical](file_scope& parent) -> bool { return parent.path.physical == physical; });
+                [&key](file_scope& parent) -> bool { return file_key(parent.path) == key; });
             if (res != m_file_scopes.end())
             {
                 m_errflag = true;
                 std::stringstream includeTree;
                 for (size_t i = 0; i < m_file_scopes.size(); i++)
                 {
-                    includeTree << i << ". " << m_file_scopes[i].path.physical << " [" << m_file_scopes[i].path.virtual_ << "]\n";
+                    includeTree << i << ". " << file_key(m_file_scopes[i].path) << " [" << m_file_scopes[i].path.virtual_ << "]\n";
                 }
                 log(err::RecursiveInclude(fileinfo.operator ::sqf::runtime::diagnostics::diag_info(), includeTree.str()));
                 return "";
             }
-            preprocessorfileinfo otherfinfo(*include_path_info);
-            otherfinfo.content = runtime.fileio().read_file(*include_path_info);
-
-
             std::string output;
             auto lineInfo = std::to_string(fileinfo.line - 1);
-            auto parsedFile = parse_file(runtime, otherfinfo);
+            auto current = file_key(*fileinfo.pathinf);
+            auto parsedFile = parse_include(runtime, *include_path_info);
             output.reserve(
-                ::sqf::runtime::util::strlen("#line 1 \"") + physical.size() + ::sqf::runtime::util::strlen("\"\n") +
+                ::sqf::runtime::util::strlen("#line 1 \"") + key.size() + ::sqf::runtime::util::strlen("\"\n") +
                 parsedFile.size() + ::sqf::runtime::util::strlen("\n") +
-                ::sqf::runtime::util::strlen("#line ") + lineInfo.size() + ::sqf::runtime::util::strlen(" \"") + fileinfo.pathinf.physical.size() + ::sqf::runtime::util::strlen("\"\n")
+                ::sqf::runtime::util::strlen("#line ") + lineInfo.size() + ::sqf::runtime::util::strlen(" \"") + current.size() + ::sqf::runtime::util::strlen("\"\n")
             );
-            output.append("#line 1 \""); output.append(physical); output.append("\"\n");
+            output.append("#line 1 \""); output.append(key); output.append("\"\n");
             output.append(parsedFile); output.append("\n");
-            output.append("#line "); output.append(lineInfo); output.append(" \""); output.append(fileinfo.pathinf.physical); output.append("\"\n");
+            output.append("#line "); output.append(lineInfo); output.append(" \""); output.append(current); output.append("\"\n");
             return output;
         }
         catch (const std::runtime_error& ex)
@@ -774,7 +962,7 @@ std::string sqf::parser::preprocessor::impl_default::instance::parse_ppinstructi
             {
                 log(err::MacroDefinedTwice(fileinfo.operator ::sqf::runtime::diagnostics::diag_info(), line));
             }
-            m_macros[line] = { fileinfo, line };
+            define(line, { fileinfo, line });
 #ifdef DF__SQF_PREPROC__TRACE_MACRO_PARSE
             std::cout << "\x1B[33m[PP-DEFINE-PARSE]\033[0m" <<
                 "        " <<
@@ -792,7 +980,7 @@ std::string sqf::parser::preprocessor::impl_default::instance::parse_ppinstructi
                     log(err::MacroDefinedTwice(fileinfo.operator ::sqf::runtime::diagnostics::diag_info(), name_tmp));
                 }
                 std::string content(trim(line.substr(line[spaceIndex] == ' ' ? spaceIndex + 1 : spaceIndex))); // Special magic for '#define macro\'
-                m_macros[name_tmp] = { fileinfo, name_tmp, content };
+                define(name_tmp, { fileinfo, name_tmp, content });
 #ifdef DF__SQF_PREPROC__TRACE_MACRO_PARSE
                 std::cout << "\x1B[33m[PP-DEFINE-PARSE]\033[0m" <<
                     "        " <<
@@ -841,7 +1029,7 @@ std::string sqf::parser::preprocessor::impl_default::instance::parse_ppinstructi
                     content = (trim(line.substr(line[bracketsEndIndex + 1] == ' ' ? bracketsEndIndex + 2 : bracketsEndIndex + 1)));
                 }
 
-                m_macros[name_tmp] = { fileinfo, name_tmp, args, content };
+                define(name_tmp, { fileinfo, name_tmp, args, content });
 #ifdef DF__SQF_PREPROC__TRACE_MACRO_PARSE
                 std::cout << "\x1B[33m[PP-DEFINE-PARSE]\033[0m" <<
                     "        " <<
@@ -866,7 +1054,7 @@ std::string sqf::parser::preprocessor::impl_default::instance::parse_ppinstructi
         }
         else
         {
-            m_macros.erase(res);
+            undefine(res);
         }
         return "\n";
     }
@@ -921,12 +1109,14 @@ std::string sqf::parser::preprocessor::impl_default::instance::parse_ppinstructi
 }
 std::string sqf::parser::preprocessor::impl_default::instance::parse_file(::sqf::runtime::runtime& runtime, preprocessorfileinfo& fileinfo)
 {
-    push_path(fileinfo.pathinf);
+    push_path(*fileinfo.pathinf);
     char c;
-    std::stringstream sstream;
-    std::stringstream wordstream;
+    std::string output;
+    std::string word;
     std::unordered_map<std::string, std::string> empty_parammap;
-    sstream << "#line 0 \"" << fileinfo.pathinf.physical << "\"\n";
+    auto key = file_key(*fileinfo.pathinf);
+    output.reserve(fileinfo.content.length() + key.length() + ::sqf::runtime::util::strlen("#line 0 \"\"\n"));
+    output.append("#line 0 \""); output.append(key); output.append("\"\n");
     bool was_new_line = true;
     bool is_in_string = false;
     while ((c = fileinfo.next()) != '\0')
@@ -937,8 +1127,12 @@ std::string sqf::parser::preprocessor::impl_default::instance::parse_file(::sqf:
             {
                 is_in_string = false;
             }
-            if (current_file_scope().conditions.empty() || current_file_scope().conditions.back().allow_write)
-                sstream << c;
+            auto run = is_in_string ? fileinfo.take_until<preprocessorfileinfo::plain_stop_chars>() : std::string_view{};
+            if (allow_write())
+            {
+                output.push_back(c);
+                output.append(run);
+            }
             continue;
         }
         switch (c)
@@ -946,10 +1140,12 @@ std::string sqf::parser::preprocessor::impl_default::instance::parse_file(::sqf:
         case '"':
         {
             is_in_string = true;
-            auto word = wordstream.str();
-            wordstream.str("");
-            if (current_file_scope().conditions.empty() || current_file_scope().conditions.back().allow_write)
-                sstream << word << c;
+            if (allow_write())
+            {
+                output.append(word);
+                output.push_back(c);
+            }
+            word.clear();
         } break;
         case '\n':
         {
@@ -965,7 +1161,7 @@ std::string sqf::parser::preprocessor::impl_default::instance::parse_file(::sqf:
                 {
                     return res;
                 }
-                sstream << res;
+                output.append(res);
                 break;
             }
         }
@@ -975,36 +1171,41 @@ std::string sqf::parser::preprocessor::impl_default::instance::parse_file(::sqf:
             {
                 was_new_line = false;
             }
-            if (current_file_scope().conditions.empty() || current_file_scope().conditions.back().allow_write)
+            if (allow_write())
             {
-                if (wordstream.rdbuf()->in_avail() > 0)
+                if (!word.empty())
                 {
-                    auto word = wordstream.str();
-                    wordstream.str("");
-                    auto m = get_try(word);
-                    if (m.has_value())
+                    auto m = find(word);
+                    if (m)
                     {
+                        word.clear();
                         fileinfo.move_back();
-                        auto res = handle_macro(runtime, fileinfo, fileinfo, m.value(), empty_parammap);
+                        auto res = handle_macro(runtime, fileinfo, fileinfo, *m, empty_parammap);
                         if (m_errflag)
                         {
                             return res;
                         }
-                        sstream << res;
-                    }
-                    else
-                    {
-                        sstream << word << c;
+                        output.append(res);
+                        break;
                     }
+                    output.append(word);
+                    word.clear();
                 }
-                else
-                {
-                    sstream << c;
-                }
+                output.push_back(c);
             }
             else if (c == '\n')
             {
-                sstream << c;
+                output.push_back(c);
+            }
+            // Copy everything up to the next character requiring special handling at once.
+            auto run = fileinfo.take_until<preprocessorfileinfo::plain_code_stop_chars>();
+            if (::sqf::parser::scan::skip_whitespace(run.data(), run.data() + run.length()) != run.data() + run.length())
+            {
+                was_new_line = false;
+            }
+            if (allow_write())
+            {
+                output.append(run);
             }
         } break;
         case 'a': case 'b': case 'c': case 'd': case 'e':
@@ -1021,34 +1222,37 @@ std::string sqf::parser::preprocessor::impl_default::instance::parse_file(::sqf:
         case '3': case '4': case '5': case '6': case '7':
         case '8': case '9': case '_':
         {
-            if (current_file_scope().conditions.empty() || current_file_scope().conditions.back().allow_write)
-                wordstream << c;
+            auto run = fileinfo.take_until<::sqf::parser::scan::identifier_chars, false>();
+            if (allow_write())
+            {
+                word.push_back(c);
+                word.append(run);
+            }
             was_new_line = false;
         } break;
         }
     }
 
-    auto word = wordstream.str();
     if (!word.empty())
     {
-        auto m = get_try(word);
-        if (m.has_value())
+        auto m = find(word);
+        if (m)
         {
             fileinfo.move_back();
-            auto res = handle_macro(runtime, fileinfo, fileinfo, m.value(), empty_parammap);
+            auto res = handle_macro(runtime, fileinfo, fileinfo, *m, empty_parammap);
             if (m_errflag)
             {
                 return res;
             }
-            sstream << res;
+            output.append(res);
         }
         else
         {
-            sstream << word;
+            output.append(word);
         }
     }
     pop_path(fileinfo);
-    return sstream.str();
+    return output;
 }
 
 std::string line_macro_callback(
@@ -1067,7 +1271,29 @@ std::string file_macro_callback(
     const std::vector<std::string>& params,
     ::sqf::runtime::runtime& runtime)
 {
-    return dinf.path.physical;
+    return file_key(dinf.path);
+}
+// Set while preprocess runs on the current thread, pointing to the counter of volatile
+// expansions of the preprocessor used (see impl_default::m_volatile_expansions).
+static thread_local std::atomic<size_t>* __volatile_expansions__ = nullptr;
+static void count_volatile_expansion()
+{
+    if (__volatile_expansions__)
+    {
+        (*__volatile_expansions__)++;
+    }
+}
+// Set while preprocess_isolated runs on the current thread.
+// Volatile macros flag the preprocessing as deferred instead of expanding.
+static thread_local bool* __isolated_deferred__ = nullptr;
+static bool defer_if_isolated()
+{
+    if (__isolated_deferred__)
+    {
+        *__isolated_deferred__ = true;
+        return true;
+    }
+    return false;
 }
 std::string eval_macro_callback(
     const ::sqf::runtime::parser::macro& m,
@@ -1076,6 +1302,11 @@ std::string eval_macro_callback(
     const std::vector<std::string>& params,
     ::sqf::runtime::runtime& runtime)
 {
+    if (defer_if_isolated())
+    {
+        return {};
+    }
+    count_volatile_expansion();
     if (params.empty())
     {
         return "";
@@ -1095,6 +1326,11 @@ std::string counter_macro_callback(
     const std::vector<std::string>& params,
     ::sqf::runtime::runtime& runtime)
 {
+    if (defer_if_isolated())
+    {
+        return {};
+    }
+    count_volatile_expansion();
     return std::to_string(__counter__++);
 }
 std::string counter_reset_macro_callback(
@@ -1104,15 +1340,196 @@ std::string counter_reset_macro_callback(
     const std::vector<std::string>& params,
     ::sqf::runtime::runtime& runtime)
 {
+    if (defer_if_isolated())
+    {
+        return {};
+    }
+    count_volatile_expansion();
     __counter__ = 0;
     return "";
 }
 
+static size_t macro_hash(const ::sqf::runtime::parser::macro& m)
+{
+    auto str_hash = std::hash<std::string_view>{};
+    auto hash = str_hash(m.name()) + (m.is_callable() ? 1 : 0);
+    hash ^= str_hash(m.content()) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    for (auto& arg : m.args())
+    {
+        hash ^= str_hash(arg) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    }
+    return hash;
+}
+static std::optional<std::filesystem::file_time_type> modification_time(const std::string& physical)
+{
+    std::error_code ec;
+    auto mtime = std::filesystem::last_write_time(physical, ec);
+    if (ec)
+    {
+        return {};
+    }
+    return mtime;
+}
+
+sqf::parser::preprocessor::impl_default::instance::instance(impl_default& owner, Logger& logger) :
+    CanLog(logger),
+    m_owner(owner),
+    m_macros_hash(owner.m_macros_hash),
+    m_macros(owner.m_macros)
+{
+}
+void sqf::parser::preprocessor::impl_default::instance::define(const std::string& name, ::sqf::runtime::parser::macro m)
+{
+    auto res = m_macros.find(name);
+    if (res == m_macros.end())
+    {
+        res = m_macros.emplace(name, std::move(m)).first;
+    }
+    else
+    {
+        m_macros_hash -= macro_hash(res->second);
+        m_expansions.erase(&res->second);
+        res->second = std::move(m);
+    }
+    m_macros_hash += macro_hash(res->second);
+    m_macros_journal.push_back(name);
+}
+void sqf::parser::preprocessor::impl_default::instance::undefine(std::unordered_map<std::string, ::sqf::runtime::parser::macro>::iterator it)
+{
+    m_macros_hash -= macro_hash(it->second);
+    m_expansions.erase(&it->second);
+    m_macros_journal.push_back(it->first);
+    m_macros.erase(it);
+}
+std::string sqf::parser::preprocessor::impl_default::instance::parse_include(::sqf::runtime::runtime& runtime, const ::sqf::runtime::fileio::pathinfo& pathinfo)
+{
+    auto key = file_key(pathinfo);
+    auto mtime = modification_time(pathinfo.physical);
+    if (mtime.has_value())
+    {
+        auto entry = m_owner.find_include(key, m_macros_hash);
+        // Files included by the cached file may be part of the current include chain now, which has to be reported.
+        bool valid = entry && std::all_of(entry->files.begin(), entry->files.end(), [&](const auto& file) {
+            return modification_time(file.physical) == file.mtime && std::none_of(m_file_scopes.begin(), m_file_scopes.end(),
+                [&](const file_scope& scope) { return file_key(scope.path) == file.key; });
+            });
+        if (valid)
+        {
+            for (auto& name : entry->undefined)
+            {
+                auto res = m_macros.find(name);
+                if (res != m_macros.end())
+                {
+                    undefine(res);
+                }
+            }
+            for (auto& m : entry->defined)
+            {
+                define(std::string(m.name()), m);
+            }
+            for (auto& file : entry->files)
+            {
+                m_visited.insert(file.key);
+                m_files_read.push_back(file);
+            }
+            return entry->output;
+        }
+    }
+
+    auto journal_start = m_macros_journal.size();
+    auto files_start = m_files_read.size();
+    auto logged = m_logged;
+    auto volatile_expansions = m_owner.m_volatile_expansions.load();
+    auto macros_hash = m_macros_hash;
+
+    auto file = m_owner.open_file_cached(runtime, pathinfo, mtime);
+    m_files_read.push_back({ key, pathinfo.physical, mtime });
+    preprocessorfileinfo fileinfo(pathinfo);
+    fileinfo.content = file->contents();
+    auto output = parse_file(runtime, fileinfo);
+
+    // Only results solely depending on the files and macros defined are cached.
+    if (m_errflag || m_logged != logged || volatile_expansions != m_owner.m_volatile_expansions.load() ||
+        (__isolated_deferred__ && *__isolated_deferred__))
+    {
+        return output;
+    }
+    auto entry = std::make_shared<include_entry>();
+    for (auto it = m_files_read.begin() + files_start; it != m_files_read.end(); ++it)
+    {
+        if (!it->mtime.has_value())
+        {
+            return output;
+        }
+        entry->files.push_back(*it);
+    }
+    std::unordered_set<std::string> touched;
+    for (auto it = m_macros_journal.begin() + journal_start; it != m_macros_journal.end(); ++it)
+    {
+        if (!touched.insert(*it).second)
+        {
+            continue;
+        }
+        auto res = m_macros.find(*it);
+        if (res == m_macros.end())
+        {
+            entry->undefined.push_back(*it);
+        }
+        else
+        {
+            entry->defined.push_back(res->second);
+        }
+    }
+    entry->output = output;
+    m_owner.store_include(key, macros_hash, std::move(entry));
+    return output;
+}
+
+std::shared_ptr<const sqf::runtime::fileio::file_handle> sqf::parser::preprocessor::impl_default::open_file_cached(::sqf::runtime::runtime& runtime, const ::sqf::runtime::fileio::pathinfo& pathinfo, std::optional<std::filesystem::file_time_type> mtime)
+{
+    if (!mtime.has_value())
+    {
+        return runtime.fileio().open_file(pathinfo);
+    }
+    {
+        std::lock_guard lock(m_cache_mutex);
+        auto res = m_file_cache.find(file_key(pathinfo));
+        if (res != m_file_cache.end() && res->second.mtime == *mtime)
+        {
+            return res->second.file;
+        }
+    }
+    auto file = runtime.fileio().open_file(pathinfo);
+    std::lock_guard lock(m_cache_mutex);
+    m_file_cache[file_key(pathinfo)] = { *mtime, file };
+    return file;
+}
+std::shared_ptr<const sqf::parser::preprocessor::impl_default::include_entry> sqf::parser::preprocessor::impl_default::find_include(const std::string& key, size_t macros_hash)
+{
+    std::lock_guard lock(m_cache_mutex);
+    auto file = m_include_cache.find(key);
+    if (file == m_include_cache.end())
+    {
+        return {};
+    }
+    auto res = file->second.find(macros_hash);
+    return res == file->second.end() ? nullptr : res->second;
+}
+void sqf::parser::preprocessor::impl_default::store_include(const std::string& key, size_t macros_hash, std::shared_ptr<const include_entry> entry)
+{
+    std::lock_guard lock(m_cache_mutex);
+    auto& file = m_include_cache[key];
+    if (file.size() >= include_cache_entries_per_file)
+    {
+        file.clear();
+    }
+    file[macros_hash] = std::move(entry);
+}
 
 void sqf::parser::preprocessor::impl_default::instance::push_path(const::sqf::runtime::fileio::pathinfo pathinfo)
 {
     m_file_scopes.push_back({ pathinfo, {} });
-    m_visited.insert(pathinfo.physical);
+    m_visited.insert(file_key(pathinfo));
 }
 
 void sqf::parser::preprocessor::impl_default::instance::pop_path(preprocessorfileinfo& preprocessorfileinfo)
@@ -1124,7 +1541,10 @@ void sqf::parser::preprocessor::impl_default::instance::pop_path(preprocessorfil
     }
     m_file_scopes.pop_back();
 }
-sqf::parser::preprocessor::impl_default::impl_default(Logger& logger) : CanLog(logger)
+sqf::parser::preprocessor::impl_default::impl_default(Logger& logger) :
+    CanLog(logger),
+    m_macros_hash(0),
+    m_volatile_expansions(0)
 {
     // m_macros["__DATE_ARR__"s] = { "__DATE_ARR__"s, counter_macro_callback }; // 2020,10,28,15,17,42
     // m_macros["__DATE_STR__"s] = { "__DATE_STR__"s, counter_macro_callback }; // "2020/10/28, 15:17:42"
@@ -1157,17 +1577,47 @@ sqf::parser::preprocessor::impl_default::impl_default(Logger& logger) : CanLog(l
     m_macros["_SQFVM_DEBUG"s] = { "_DEBUG"s };
 #endif
 
+    for (auto& it : m_macros)
+    {
+        // Combined using addition to not depend on the iteration order.
+        m_macros_hash += macro_hash(it.second);
+    }
+}
+void sqf::parser::preprocessor::impl_default::push_back(::sqf::runtime::parser::macro m)
+{
+    auto res = m_macros.find(std::string(m.name()));
+    if (res == m_macros.end())
+    {
+        res = m_macros.emplace(std::string(m.name()), std::move(m)).first;
+    }
+    else
+    {
+        m_macros_hash -= macro_hash(res->second);
+        res->second = std::move(m);
+    }
+    m_macros_hash += macro_hash(res->second);
+}
+size_t sqf::parser::preprocessor::impl_default::fingerprint() const
+{
+    return std::hash<size_t>{}(m_volatile_expansions.load()) + m_macros_hash;
 }
 std::optional<std::string> sqf::parser::preprocessor::impl_default::preprocess(
     ::sqf::runtime::runtime& runtime,
     std::string_view view,
     ::sqf::runtime::fileio::pathinfo pathinfo,
     std::vector<std::string>* out_included,
-    std::vector<::sqf::runtime::parser::macro>* out_macros)
+    std::vector<::sqf::runtime::parser::macro>* out_macros,
+    std::vector<std::string>* out_physical)
 {
+    struct volatile_scope
+    {
+        std::atomic<size_t>* previous;
+        volatile_scope(std::atomic<size_t>& counter) : previous(__volatile_expansions__) { __volatile_expansions__ = &counter; }
+        ~volatile_scope() { __volatile_expansions__ = previous; }
+    } scope(m_volatile_expansions);
     preprocessorfileinfo fileinfo(pathinfo);
     fileinfo.content = view;
-    instance i(get_logger(), m_macros);
+    instance i(*this, get_logger());
     auto res = i.parse_file(runtime, fileinfo);
     if (out_included)
     {
@@ -1176,6 +1626,17 @@ std::optional<std::string> sqf::parser::preprocessor::impl_default::preprocess(
             out_included->push_back(entry);
         }
     }
+    if (out_physical)
+    {
+        std::unordered_set<std::string> reported(out_physical->begin(), out_physical->end());
+        for (auto& entry : i.files_read())
+        {
+            if (reported.insert(entry.physical).second)
+            {
+                out_physical->push_back(entry.physical);
+            }
+        }
+    }
     if (out_macros)
     {
         for (auto entry : i.m_macros)
@@ -1189,3 +1650,25 @@ std::optional<std::string> sqf::parser::preprocessor::impl_default::preprocess(
     }
     return res;
 }
+std::optional<std::string> sqf::parser::preprocessor::impl_default::preprocess_isolated(
+    ::sqf::runtime::runtime& runtime,
+    Logger& logger,
+    std::string_view view,
+    ::sqf::runtime::fileio::pathinfo pathinfo,
+    bool& deferred)
+{
+    struct isolation_scope
+    {
+        isolation_scope(bool& deferred) { deferred = false; __isolated_deferred__ = &deferred; }
+        ~isolation_scope() { __isolated_deferred__ = nullptr; }
+    } scope(deferred);
+    preprocessorfileinfo fileinfo(pathinfo);
+    fileinfo.content = view;
+    instance i(*this, logger);
+    auto res = i.parse_file(runtime, fileinfo);
+    if (deferred || i.errflag())
+    {
+        return {};
+    }
+    return res;
+}
@@ -3,8 +3,14 @@
 #include "../../runtime/logging.h"
 #include "../../runtime/diagnostics/diag_info.h"
 #include "../../runtime/fileio.h"
+#include "../scan.h"
 
+#include <atomic>
+#include <filesystem>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <unordered_map>
 #include <unordered_set>
@@ -16,8 +22,18 @@ namespace sqf::parser::preprocessor
     class impl_default : public ::sqf::runtime::parser::preprocessor, public CanLog
     {
     public:
+        /// <summary>
+        /// Read-only cursor over the contents of a file or macro.
+        /// Contents are not owned, thus have to outlive the cursor.
+        /// Copying is cheap, as neither contents nor path are copied.
+        /// </summary>
         class preprocessorfileinfo
         {
+        public:
+            // Characters that may be consumed by take_until without breaking the progression of next(),
+            // as next() would have returned them unchanged too.
+            using plain_stop_chars = ::sqf::parser::scan::any_of<'"', '/', '\\', '\r', '\n', '\0'>;
+            using plain_code_stop_chars = ::sqf::parser::scan::union_of<::sqf::parser::scan::identifier_chars, ::sqf::parser::scan::any_of<'"', '#', '/', '\\', '\r', '\n', '\0'>>;
         private:
             size_t last_col;
             bool is_in_string;
@@ -46,24 +62,24 @@ namespace sqf::parser::preprocessor
             }
         public:
             preprocessorfileinfo(::sqf::runtime::fileio::pathinfo pinf)
-                : pathinf(pinf)
+                : pathinf(std::make_shared<const ::sqf::runtime::fileio::pathinfo>(std::move(pinf)))
             {
                 last_col = 0;
                 is_in_string = false;
                 is_in_block_comment = false;
             }
-            preprocessorfileinfo(::sqf::runtime::diagnostics::diag_info dinf)
-                : pathinf(dinf.path)
+            preprocessorfileinfo(std::shared_ptr<const ::sqf::runtime::fileio::pathinfo> pinf)
+                : pathinf(std::move(pinf))
             {
                 last_col = 0;
                 is_in_string = false;
                 is_in_block_comment = false;
             }
-            std::string content;
+            std::string_view content;
             size_t off = 0;
             size_t line = 1;
             size_t col = 0;
-            ::sqf::runtime::fileio::pathinfo pathinf;
+            std::shared_ptr<const ::sqf::runtime::fileio::pathinfo> pathinf;
             // Returns the next character.
             // Will not take into account to skip eg. comments or simmilar things!
             char peek(size_t len = 0)
@@ -137,6 +153,23 @@ namespace sqf::parser::preprocessor
                 return c;
             }
 
+            // Consumes the characters up to the first one (not) part of TSet, which has to contain all characters
+            // next() does not return unchanged (see plain_stop_chars). Consumes nothing inside of block comments.
+            template<typename TSet, bool TMatch = true>
+            std::string_view take_until()
+            {
+                if (is_in_block_comment || off >= content.length())
+                {
+                    return {};
+                }
+                auto start = content.data() + off;
+                auto end = ::sqf::parser::scan::find_if<TSet, TMatch>(start, content.data() + content.length());
+                auto length = static_cast<size_t>(end - start);
+                off += length;
+                col += length;
+                return { start, length };
+            }
+
             std::string get_word()
             {
                 char c;
@@ -153,7 +186,7 @@ namespace sqf::parser::preprocessor
                     off_end = off;
                 }
                 move_back();
-                return content.substr(off_start, off_end - off_start);
+                return std::string(content.substr(off_start, off_end - off_start));
             }
 
             std::string get_line(bool catchEscapedNewLine)
@@ -197,7 +230,7 @@ namespace sqf::parser::preprocessor
                 {
                     while ((c = next()) != '\0' && c != '\n') {}
                 }
-                return content.substr(off_start, off - off_start);
+                return std::string(content.substr(off_start, off - off_start));
             }
             // Moves one character backwards and updates
             // porgression of line, col and off according
@@ -225,11 +258,55 @@ namespace sqf::parser::preprocessor
                 }
             }
 
-            operator ::sqf::runtime::diagnostics::diag_info() const { return { line, col, off, pathinf, {} }; }
-            operator ::sqf::runtime::fileio::pathinfo() const { return pathinf; }
+            operator ::sqf::runtime::diagnostics::diag_info() const { return { line, col, off, *pathinf, {} }; }
+            operator ::sqf::runtime::fileio::pathinfo() const { return *pathinf; }
         };
     private:
         std::unordered_map<std::string, ::sqf::runtime::parser::macro> m_macros;
+        // Sum of the hashes of all macros in m_macros, kept up to date by push_back.
+        size_t m_macros_hash;
+        // Incremented whenever a macro got expanded whose output is not solely determined
+        // by the macro set and the input (eg. __COUNTER__). Part of the fingerprint.
+        // Read by concurrent preprocess_isolated calls, thus atomic.
+        std::atomic<size_t> m_volatile_expansions;
+
+        // A file opened, together with its modification time when opened.
+        struct file_entry
+        {
+            std::filesystem::file_time_type mtime;
+            std::shared_ptr<const ::sqf::runtime::fileio::file_handle> file;
+        };
+        // A file read while preprocessing, identified by its physical path and the entry inside of it (see file_key).
+        struct file_read
+        {
+            std::string key;
+            std::string physical;
+            std::optional<std::filesystem::file_time_type> mtime;
+        };
+        // The result of preprocessing an included file, being valid as long as
+        // none of the files it consists of (itself and everything it includes) got modified.
+        struct include_entry
+        {
+            std::string output;
+            // Macros (re)defined by the file, with their final definition.
+            std::vector<::sqf::runtime::parser::macro> defined;
+            // Macros removed by the file.
+            std::vector<std::string> undefined;
+            std::vector<file_read> files;
+        };
+        // Maximum amount of include entries kept per file, preventing unbounded growth when a file
+        // gets included with always different macros (eg. __COUNTER__ based defines).
+        static constexpr size_t include_cache_entries_per_file = 64;
+        // Shared between all preprocess calls, thus guarded by m_cache_mutex (see preprocess_isolated).
+        std::mutex m_cache_mutex;
+        std::unordered_map<std::string, file_entry> m_file_cache;
+        // File key -> hash of the macros defined when including -> result.
+        std::unordered_map<std::string, std::unordered_map<size_t, std::shared_ptr<const include_entry>>> m_include_cache;
+
+        std::shared_ptr<const ::sqf::runtime::fileio::file_handle> open_file_cached(::sqf::runtime::runtime& runtime, const ::sqf::runtime::fileio::pathinfo& pathinfo, std::optional<std::filesystem::file_time_type> mtime);
+        std::shared_ptr<const include_entry> find_include(const std::string& key, size_t macros_hash);
+        void store_include(const std::string& key, size_t macros_hash, std::shared_ptr<const include_entry> entry);
+
         struct condition_scope
         {
             bool allow_write;
@@ -243,20 +320,74 @@ namespace sqf::parser::preprocessor
         };
         class instance : public CanLog
         {
+            impl_default& m_owner;
+            // Sum of the hashes of all macros in m_macros, identifying the macros defined.
+            size_t m_macros_hash;
+            // Names of the macros (re)defined or removed, in order.
+            std::vector<std::string> m_macros_journal;
+            // Files read, in order. Files without a modification time cannot be cached.
+            std::vector<file_read> m_files_read;
+            // Amount of messages logged, as files reporting any are not cached.
+            size_t m_logged = 0;
+            // Amount of macros with a callback (eg. __LINE__ or __COUNTER__) expanded, as their output depends on more than the macros defined.
+            size_t m_callback_expansions = 0;
+
+            // Part of a macro body, split the same way replace walks it character by character.
+            struct body_token
+            {
+                enum class kind { text, hash, word };
+                kind type;
+                size_t offset;
+                size_t length;
+                // Index of the macro argument a word refers to, npos otherwise.
+                size_t param;
+            };
+            // Per-definition state of a macro, dropped once it gets redefined or removed.
+            struct expansion
+            {
+                // The tokenized body. Empty if it contains characters next() treats specially (comments, escaped newlines).
+                std::optional<std::vector<body_token>> tokens;
+                // Output of the last expansion without arguments, valid as long as m_macros_hash equals macros_hash.
+                bool memoized = false;
+                size_t macros_hash = 0;
+                std::string output;
+            };
+            std::unordered_map<const ::sqf::runtime::parser::macro*, expansion> m_expansions;
+
+            static std::optional<std::vector<body_token>> tokenize_body(const ::sqf::runtime::parser::macro& m);
+            static void fill_param_map(const ::sqf::runtime::parser::macro& m, const std::vector<std::string>& params, std::unordered_map<std::string, std::string>& param_map);
+
+            // Expands the tokenized body of m. Returns false if a nested macro left the cursor inside of a token,
+            // in which case local_fileinfo points to where the character-wise replace has to continue.
+            bool replace_tokens(
+                ::sqf::runtime::runtime& runtime,
+                preprocessorfileinfo& local_fileinfo,
+                preprocessorfileinfo& original_fileinfo,
+                const ::sqf::runtime::parser::macro& m,
+                std::vector<std::string>& params,
+                const std::vector<body_token>& tokens,
+                std::string& output,
+                std::unordered_map<std::string, std::string>& param_map);
         public:
-            instance(Logger& logger, std::unordered_map<std::string, ::sqf::runtime::parser::macro> macros) : CanLog(logger), m_macros(macros) {};
+            instance(impl_default& owner, Logger& logger);
+            const std::vector<file_read>& files_read() const { return m_files_read; }
             std::vector<file_scope> m_file_scopes;
             std::unordered_set<std::string> m_visited;
             bool m_errflag = false;
             std::unordered_map<std::string, ::sqf::runtime::parser::macro> m_macros;
 
+            void log(LogMessageBase&& message) { m_logged++; CanLog::log(std::move(message)); }
+            void define(const std::string& name, ::sqf::runtime::parser::macro m);
+            void undefine(std::unordered_map<std::string, ::sqf::runtime::parser::macro>::iterator it);
+            std::string parse_include(::sqf::runtime::runtime& runtime, const ::sqf::runtime::fileio::pathinfo& pathinfo);
+
             void replace_stringify(
                 ::sqf::runtime::runtime& runtime,
                 preprocessorfileinfo& local_fileinfo,
                 preprocessorfileinfo& original_fileinfo,
                 const ::sqf::runtime::parser::macro& m,
                 std::vector<std::string>& params,
-                std::stringstream& sstream,
+                std::string& output,
                 const std::unordered_map<std::string, std::string>& param_map);
 
             void replace_concat(
@@ -265,7 +396,7 @@ namespace sqf::parser::preprocessor
                 preprocessorfileinfo& original_fileinfo,
                 const ::sqf::runtime::parser::macro& m,
                 std::vector<std::string>& params,
-                std::stringstream& sstream,
+                std::string& output,
                 const std::unordered_map<std::string, std::string>& param_map);
 
             std::string handle_macro(
@@ -294,7 +425,7 @@ namespace sqf::parser::preprocessor
 
             size_t replace_find_wordend(::sqf::runtime::runtime& runtime, preprocessorfileinfo fileinfo);
 
-            void replace_skip(::sqf::runtime::runtime& runtime, preprocessorfileinfo& fileinfo, std::stringstream& sstream);
+            void replace_skip(::sqf::runtime::runtime& runtime, preprocessorfileinfo& fileinfo, std::string& output);
 
             bool allow_write() const { return m_file_scopes.back().conditions.empty() || m_file_scopes.back().conditions.back().allow_write; }
             bool errflag() { return m_errflag; }
@@ -311,21 +442,37 @@ namespace sqf::parser::preprocessor
                 }
                 return res->second;
             }
+            // Same as get_try, without copying the macro. Valid until the macro gets undefined.
+            const ::sqf::runtime::parser::macro* find(const std::string& macro_name) const
+            {
+                auto res = m_macros.find(macro_name);
+                return res == m_macros.end() ? nullptr : &res->second;
+            }
         };
     public:
         impl_default(Logger& logger);
 
+        /// <summary>
+        /// Preprocesses the provided contents, optionally reporting the files it consists of and the macros defined afterwards.
+        /// </summary>
+        /// <param name="out_included">Receives the keys of all files visited, including the one preprocessed.</param>
+        /// <param name="out_macros">Receives the macros defined once done.</param>
+        /// <param name="out_physical">Receives the physical paths of all files included, without duplicates.
+        /// Archives are reported instead of the entries read from them.</param>
         std::optional<std::string> preprocess(
             ::sqf::runtime::runtime& runtime,
             std::string_view view,
             ::sqf::runtime::fileio::pathinfo pathinfo,
             std::vector<std::string>* out_included,
-            std::vector<::sqf::runtime::parser::macro>* out_macros);
+            std::vector<::sqf::runtime::parser::macro>* out_macros,
+            std::vector<std::string>* out_physical = nullptr);
 
-        virtual void push_back(::sqf::runtime::parser::macro m) override { m_macros[std::string(m.name())] = m; };
+        virtual void push_back(::sqf::runtime::parser::macro m) override;
+        virtual size_t fingerprint() const override;
         virtual ~impl_default() override { }
         virtual std::optional<std::string> preprocess(::sqf::runtime::runtime& runtime, std::string_view view, ::sqf::runtime::fileio::pathinfo pathinfo) override
         { return preprocess(runtime, view, pathinfo, nullptr, nullptr); }
+        virtual std::optional<std::string> preprocess_isolated(::sqf::runtime::runtime& runtime, Logger& logger, std::string_view view, ::sqf::runtime::fileio::pathinfo pathinfo, bool& deferred) override;
 
         std::optional<::sqf::runtime::parser::macro> get_try(const std::string macro_name) const
         {
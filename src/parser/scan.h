@@ -0,0 +1,234 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+#if !defined(DF__SQF_PARSER__SCALAR_SCAN)
+#if defined(__AVX2__)
+#define SQF_PARSER_SCAN_AVX2
+#define SQF_PARSER_SCAN_SSE2
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SQF_PARSER_SCAN_SSE2
+#include <emmintrin.h>
+#endif
+#endif // !defined(DF__SQF_PARSER__SCALAR_SCAN)
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+/// <summary>
+/// Character scanning kernels shared by the SQF and SQC tokenizers and the config parser.
+/// Every kernel operates on the half-open range [it, end) and processes 32 (AVX2) or
+/// 16 (SSE2) bytes at once where available, falling back to a plain loop for the tail
+/// and on other platforms.
+/// </summary>
+/// <remarks>
+/// The instruction set is picked at compile time. Define DF__SQF_PARSER__SCALAR_SCAN
+/// to force the scalar implementation (eg. to compare results).
+/// </remarks>
+namespace sqf::parser::scan
+{
+    namespace detail
+    {
+        inline unsigned first_bit(uint32_t mask)
+        {
+#if defined(_MSC_VER) && !defined(__clang__)
+            unsigned long index;
+            _BitScanForward(&index, mask);
+            return static_cast<unsigned>(index);
+#else
+            return static_cast<unsigned>(__builtin_ctz(mask));
+#endif
+        }
+        inline unsigned bit_count(uint32_t mask)
+        {
+#if defined(_MSC_VER) && !defined(__clang__)
+            mask = mask - ((mask >> 1) & 0x55555555u);
+            mask = (mask & 0x33333333u) + ((mask >> 2) & 0x33333333u);
+            return (((mask + (mask >> 4)) & 0x0F0F0F0Fu) * 0x01010101u) >> 24;
+#else
+            return static_cast<unsigned>(__builtin_popcount(mask));
+#endif
+        }
+    }
+
+    /// <summary>
+    /// Character set consisting of the provided characters.
+    /// </summary>
+    template<char ... TArgs>
+    struct any_of
+    {
+        static bool scalar(char c) { return ((c == TArgs) || ...); }
+#ifdef SQF_PARSER_SCAN_SSE2
+        static __m128i sse2(__m128i v)
+        {
+            __m128i m = _mm_setzero_si128();
+            ((m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8(TArgs)))), ...);
+            return m;
+        }
+#endif
+#ifdef SQF_PARSER_SCAN_AVX2
+        static __m256i avx2(__m256i v)
+        {
+            __m256i m = _mm256_setzero_si256();
+            ((m = _mm256_or_si256(m, _mm256_cmpeq_epi8(v, _mm256_set1_epi8(TArgs)))), ...);
+            return m;
+        }
+#endif
+    };
+
+    /// <summary>
+    /// Character set [a-zA-Z0-9_].
+    /// </summary>
+    struct identifier_chars
+    {
+        static bool scalar(char c)
+        {
+            return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+        }
+#ifdef SQF_PARSER_SCAN_SSE2
+        static __m128i sse2(__m128i v)
+        {
+            // Signed compares are fine here, as all non-ASCII bytes are negative and thus never in range.
+            __m128i lower = _mm_or_si128(v, _mm_set1_epi8(0x20));
+            __m128i alpha = _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(lower, _mm_set1_epi8('z' + 1)));
+            __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(v, _mm_set1_epi8('9' + 1)));
+            __m128i underscore = _mm_cmpeq_epi8(v, _mm_set1_epi8('_'));
+            return _mm_or_si128(_mm_or_si128(alpha, digit), underscore);
+        }
+#endif
+#ifdef SQF_PARSER_SCAN_AVX2
+        static __m256i avx2(__m256i v)
+        {
+            __m256i lower = _mm256_or_si256(v, _mm256_set1_epi8(0x20));
+            __m256i alpha = _mm256_and_si256(_mm256_cmpgt_epi8(lower, _mm256_set1_epi8('a' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('z' + 1), lower));
+            __m256i digit = _mm256_and_si256(_mm256_cmpgt_epi8(v, _mm256_set1_epi8('0' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), v));
+            __m256i underscore = _mm256_cmpeq_epi8(v, _mm256_set1_epi8('_'));
+            return _mm256_or_si256(_mm256_or_si256(alpha, digit), underscore);
+        }
+#endif
+    };
+
+    /// <summary>
+    /// Character set consisting of the characters of all provided sets.
+    /// </summary>
+    template<typename ... TSets>
+    struct union_of
+    {
+        static bool scalar(char c) { return (TSets::scalar(c) || ...); }
+#ifdef SQF_PARSER_SCAN_SSE2
+        static __m128i sse2(__m128i v)
+        {
+            __m128i m = _mm_setzero_si128();
+            ((m = _mm_or_si128(m, TSets::sse2(v))), ...);
+            return m;
+        }
+#endif
+#ifdef SQF_PARSER_SCAN_AVX2
+        static __m256i avx2(__m256i v)
+        {
+            __m256i m = _mm256_setzero_si256();
+            ((m = _mm256_or_si256(m, TSets::avx2(v))), ...);
+            return m;
+        }
+#endif
+    };
+
+    using whitespace_chars = any_of<' ', '\t', '\r', '\n'>;
+
+    /// <summary>
+    /// Finds the first character that is (TMatch = true) or is not (TMatch = false) part of TSet.
+    /// </summary>
+    /// <returns>Pointer to the character found or end.</returns>
+    template<typename TSet, bool TMatch = true>
+    const char* find_if(const char* it, const char* end)
+    {
+#ifdef SQF_PARSER_SCAN_AVX2
+        for (; end - it >= 32; it += 32)
+        {
+            auto mask = static_cast<uint32_t>(_mm256_movemask_epi8(TSet::avx2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(it)))));
+            if (!TMatch) { mask = ~mask; }
+            if (mask != 0) { return it + detail::first_bit(mask); }
+        }
+#endif
+#ifdef SQF_PARSER_SCAN_SSE2
+        for (; end - it >= 16; it += 16)
+        {
+            auto mask = static_cast<uint32_t>(_mm_movemask_epi8(TSet::sse2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(it)))));
+            if (!TMatch) { mask = ~mask & 0xFFFF; }
+            if (mask != 0) { return it + detail::first_bit(mask); }
+        }
+#endif
+        for (; it < end && TSet::scalar(*it) != TMatch; ++it) {}
+        return it;
+    }
+
+    /// <summary>
+    /// Counts the characters in [it, end) that are part of TSet.
+    /// </summary>
+    template<typename TSet>
+    size_t count_if(const char* it, const char* end)
+    {
+        size_t count = 0;
+#ifdef SQF_PARSER_SCAN_AVX2
+        for (; end - it >= 32; it += 32)
+        {
+            count += detail::bit_count(static_cast<uint32_t>(_mm256_movemask_epi8(TSet::avx2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(it))))));
+        }
+#endif
+#ifdef SQF_PARSER_SCAN_SSE2
+        for (; end - it >= 16; it += 16)
+        {
+            count += detail::bit_count(static_cast<uint32_t>(_mm_movemask_epi8(TSet::sse2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(it))))));
+        }
+#endif
+        for (; it < end; ++it)
+        {
+            if (TSet::scalar(*it)) { ++count; }
+        }
+        return count;
+    }
+
+    /// <summary>
+    /// Finds the first occurence of any of the provided characters.
+    /// </summary>
+    /// <returns>Pointer to the character found or end.</returns>
+    template<char ... TArgs>
+    const char* find_first_of(const char* it, const char* end) { return find_if<any_of<TArgs...>, true>(it, end); }
+
+    /// <summary>
+    /// Skips a run of whitespace (' ', '\t', '\r' and '\n').
+    /// </summary>
+    /// <returns>Pointer to the first non-whitespace character or end.</returns>
+    inline const char* skip_whitespace(const char* it, const char* end) { return find_if<whitespace_chars, false>(it, end); }
+
+    /// <summary>
+    /// Skips a run of identifier characters ([a-zA-Z0-9_]).
+    /// </summary>
+    /// <returns>Pointer to the first non-identifier character or end.</returns>
+    inline const char* skip_identifier(const char* it, const char* end) { return find_if<identifier_chars, false>(it, end); }
+
+    /// <summary>
+    /// Counts the '\n' characters in [it, end).
+    /// </summary>
+    inline size_t count_newlines(const char* it, const char* end) { return count_if<any_of<'\n'>>(it, end); }
+
+    /// <summary>
+    /// Updates line and column as if every character in [it, end) got consumed one by one,
+    /// with '\n' starting a new line at column 0 and any other character advancing the column by one.
+    /// </summary>
+    inline void advance(const char* it, const char* end, size_t& line, size_t& column)
+    {
+        auto newlines = count_newlines(it, end);
+        if (newlines == 0)
+        {
+            column += static_cast<size_t>(end - it);
+            return;
+        }
+        line += newlines;
+        auto last = end;
+        while (*--last != '\n') {}
+        column = static_cast<size_t>(end - last - 1);
+    }
+}
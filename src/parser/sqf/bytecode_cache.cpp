@@ -0,0 +1,231 @@
+#include "bytecode_cache.hpp"
+#include "../../opcodes/bytecode.h"
+#include "../../runtime/git_sha1.h"
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <typeinfo>
+#include <thread>
+
+namespace
+{
+    // Entry layout (native endianness):
+    //   char[8] magic, uint32 bytecode version, string revision, uint64 contents hash, uint64 contents length,
+    //   string physical, string virtual, uint32 message count, message[count], bytecode (see sqf::opcodes::bytecode)
+    //   string: uint32 length, char[length]
+    //   message: uint32 level, uint64 error code, string formatted message
+    const char entry_magic[8] = { 'S', 'Q', 'F', 'V', 'M', 'B', 'C', 'C' };
+
+    // FNV-1a, as std::hash is not guaranteed to be stable between builds.
+    uint64_t hash(std::string_view str, uint64_t seed = 14695981039346656037ULL)
+    {
+        for (auto c : str)
+        {
+            seed ^= static_cast<uint8_t>(c);
+            seed *= 1099511628211ULL;
+        }
+        return seed;
+    }
+
+    template<typename T>
+    void write_raw(std::ostream& out, T t) { out.write(reinterpret_cast<const char*>(&t), sizeof(T)); }
+    template<typename T>
+    bool read_raw(std::istream& in, T& t) { in.read(reinterpret_cast<char*>(&t), sizeof(T)); return in.good(); }
+    void write_string(std::ostream& out, std::string_view str)
+    {
+        write_raw<uint32_t>(out, static_cast<uint32_t>(str.length()));
+        out.write(str.data(), str.length());
+    }
+    void report(Logger& logger, LogMessageBase&& message)
+    {
+        if (logger.isEnabled(message.getLevel()))
+        {
+            logger.log(message);
+        }
+    }
+    bool read_string(std::istream& in, std::string& str)
+    {
+        uint32_t length;
+        if (!read_raw(in, length)) { return false; }
+        str.resize(length);
+        in.read(str.data(), length);
+        return in.good();
+    }
+    // Entries are shared between runs with different log levels, thus every message gets recorded.
+    void enable_all(Logger& logger)
+    {
+        for (auto level : { loglevel::fatal, loglevel::error, loglevel::warning, loglevel::info, loglevel::verbose, loglevel::trace })
+        {
+            logger.setEnabled(level, true);
+        }
+    }
+}
+
+std::filesystem::path sqf::parser::sqf::bytecode_cache::entry_path(std::string_view contents, const ::sqf::runtime::fileio::pathinfo& file) const
+{
+    // The type of the inner parser is part of the key, as eg. SQC and SQF parsers produce different results for the same contents.
+    auto key = hash(contents, hash(file.virtual_, hash(file.physical, hash(typeid(*m_inner).name()))));
+    std::stringstream sstream;
+    sstream << std::hex << std::setw(16) << std::setfill('0') << key << ".sqfbc";
+    return m_directory / sstream.str();
+}
+
+std::optional<sqf::runtime::instruction_set> sqf::parser::sqf::bytecode_cache::load(Logger& logger, const std::filesystem::path& entry, std::string_view contents, const ::sqf::runtime::fileio::pathinfo& file, BufferedLogger& messages)
+{
+    std::ifstream in(entry, std::ios_base::binary);
+    if (!in.good())
+    {
+        return {};
+    }
+    char magic[sizeof(entry_magic)];
+    uint32_t version;
+    std::string revision;
+    in.read(magic, sizeof(magic));
+    if (!in.good() || std::memcmp(magic, entry_magic, sizeof(magic)) != 0 || !read_raw(in, version) || !read_string(in, revision))
+    {
+        m_stale++;
+        report(logger, logmessage::fileio::BytecodeCacheEntryStale(file.physical, "unknown format"));
+        return {};
+    }
+    if (version != ::sqf::opcodes::bytecode::version || revision != g_GIT_SHA1)
+    {
+        m_stale++;
+        report(logger, logmessage::fileio::BytecodeCacheEntryStale(file.physical, "created by revision " + revision));
+        return {};
+    }
+    uint64_t contents_hash, contents_length;
+    std::string physical, virtual_;
+    if (!read_raw(in, contents_hash) || !read_raw(in, contents_length) || !read_string(in, physical) || !read_string(in, virtual_))
+    {
+        m_stale++;
+        report(logger, logmessage::fileio::BytecodeCacheEntryStale(file.physical, "truncated"));
+        return {};
+    }
+    if (contents_hash != hash(contents) || contents_length != contents.length() || physical != file.physical || virtual_ != file.virtual_)
+    {
+        // Different source sharing the same entry name.
+        return {};
+    }
+    uint32_t message_count;
+    if (!read_raw(in, message_count))
+    {
+        m_stale++;
+        report(logger, logmessage::fileio::BytecodeCacheEntryStale(file.physical, "truncated"));
+        return {};
+    }
+    for (uint32_t i = 0; i < message_count; i++)
+    {
+        uint32_t level;
+        uint64_t code;
+        std::string message;
+        if (!read_raw(in, level) || !read_raw(in, code) || !read_string(in, message) || level > static_cast<uint32_t>(loglevel::trace))
+        {
+            m_stale++;
+            report(logger, logmessage::fileio::BytecodeCacheEntryStale(file.physical, "truncated"));
+            return {};
+        }
+        messages.log(BufferedLogger::BufferedMessage(static_cast<loglevel>(level), static_cast<size_t>(code), std::move(message)));
+    }
+    auto set = ::sqf::opcodes::bytecode::read(in);
+    if (!set.has_value())
+    {
+        m_stale++;
+        report(logger, logmessage::fileio::BytecodeCacheEntryStale(file.physical, "corrupted"));
+    }
+    return set;
+}
+
+void sqf::parser::sqf::bytecode_cache::store(Logger& logger, const std::filesystem::path& entry, std::string_view contents, const ::sqf::runtime::fileio::pathinfo& file, const ::sqf::runtime::instruction_set& set, const BufferedLogger& messages)
+{
+    std::error_code err;
+    std::filesystem::create_directories(m_directory, err);
+
+    // Written to a temporary file first, so that concurrent runs never observe partial entries.
+    // The thread is part of the name, as the same entry may be stored by multiple threads at once.
+    std::stringstream tmp_suffix;
+    tmp_suffix << '.' << std::this_thread::get_id() << ".tmp";
+    auto tmp = entry;
+    tmp += tmp_suffix.str();
+    {
+        std::ofstream out(tmp, std::ios_base::binary | std::ios_base::trunc);
+        if (out.good())
+        {
+            out.write(entry_magic, sizeof(entry_magic));
+            write_raw<uint32_t>(out, ::sqf::opcodes::bytecode::version);
+            write_string(out, g_GIT_SHA1);
+            write_raw<uint64_t>(out, hash(contents));
+            write_raw<uint64_t>(out, contents.length());
+            write_string(out, file.physical);
+            write_string(out, file.virtual_);
+            write_raw<uint32_t>(out, static_cast<uint32_t>(messages.messages().size()));
+            for (auto& message : messages.messages())
+            {
+                write_raw<uint32_t>(out, static_cast<uint32_t>(message.getLevel()));
+                write_raw<uint64_t>(out, message.getErrorCode());
+                write_string(out, message.formatMessage());
+            }
+            if (::sqf::opcodes::bytecode::write(out, set))
+            {
+                out.close();
+                std::filesystem::rename(tmp, entry, err);
+                if (!err)
+                {
+                    return;
+                }
+            }
+        }
+    }
+    std::filesystem::remove(tmp, err);
+    report(logger, logmessage::fileio::BytecodeCacheWriteFailed(file.physical, entry.string()));
+}
+
+bool sqf::parser::sqf::bytecode_cache::check_syntax(const context& context, std::string contents, ::sqf::runtime::fileio::pathinfo file)
+{
+    if (contents.length() >= m_minimum_length)
+    {
+        auto& logger = context.logger ? *context.logger : get_logger();
+        auto entry = entry_path(contents, file);
+        BufferedLogger messages(logger);
+        enable_all(messages);
+        if (load(logger, entry, contents, file, messages).has_value())
+        {
+            m_hits++;
+            messages.flush(logger);
+            return true;
+        }
+    }
+    return m_inner->check_syntax(context, contents, file);
+}
+
+std::optional<sqf::runtime::instruction_set> sqf::parser::sqf::bytecode_cache::parse(const context& context, std::string contents, ::sqf::runtime::fileio::pathinfo file)
+{
+    if (contents.length() < m_minimum_length)
+    {
+        return m_inner->parse(context, contents, file);
+    }
+    auto& logger = context.logger ? *context.logger : get_logger();
+    auto entry = entry_path(contents, file);
+    BufferedLogger messages(logger);
+    enable_all(messages);
+    auto cached = load(logger, entry, contents, file, messages);
+    if (cached.has_value())
+    {
+        m_hits++;
+        messages.flush(logger);
+        return cached;
+    }
+    m_misses++;
+    // Discards whatever got read from an entry that failed to load.
+    BufferedLogger parse_messages(logger);
+    enable_all(parse_messages);
+    auto set = m_inner->parse({ context.operators, &parse_messages }, contents, file);
+    if (set.has_value())
+    {
+        store(logger, entry, contents, file, *set, parse_messages);
+    }
+    parse_messages.flush(logger);
+    return set;
+}
@@ -0,0 +1,75 @@
+#pragma once
+#include "../../runtime/parser/sqf.h"
+#include "../../runtime/logging.h"
+#include "../../runtime/fileio.h"
+#include "../../runtime/instruction_set.h"
+
+#include <string>
+#include <memory>
+#include <filesystem>
+#include <atomic>
+
+namespace sqf::parser::sqf
+{
+    /// <summary>
+    /// SQF parser that persists the instruction sets created by another parser on disk,
+    /// allowing subsequent runs to skip tokenizing, parsing and assembly generation.
+    /// </summary>
+    /// <remarks>
+    /// Entries are keyed by a hash of the (preprocessed) contents and the path they got parsed with.
+    /// Each entry additionally records the SQF-VM revision that created it, making entries
+    /// of other revisions stale. Stale entries are reported and replaced on the next parse.
+    /// Messages logged while parsing (eg. warnings) are stored with the entry and logged again when it gets loaded.
+    /// Entries of sources that changed are never touched again and may be deleted at any time.
+    /// Safe to be used from multiple threads at once, as long as each passes its own logger via the context.
+    /// </remarks>
+    class bytecode_cache : public ::sqf::runtime::parser::sqf, public CanLog
+    {
+    public:
+        struct statistics
+        {
+            size_t hits;
+            size_t misses;
+            size_t stale;
+        };
+    private:
+        std::unique_ptr<::sqf::runtime::parser::sqf> m_inner;
+        std::filesystem::path m_directory;
+        size_t m_minimum_length;
+        std::atomic<size_t> m_hits;
+        std::atomic<size_t> m_misses;
+        std::atomic<size_t> m_stale;
+
+        std::filesystem::path entry_path(std::string_view contents, const ::sqf::runtime::fileio::pathinfo& file) const;
+        std::optional<::sqf::runtime::instruction_set> load(Logger& logger, const std::filesystem::path& entry, std::string_view contents, const ::sqf::runtime::fileio::pathinfo& file, BufferedLogger& messages);
+        void store(Logger& logger, const std::filesystem::path& entry, std::string_view contents, const ::sqf::runtime::fileio::pathinfo& file, const ::sqf::runtime::instruction_set& set, const BufferedLogger& messages);
+    public:
+        /// <summary>
+        /// Creates a new bytecode_cache.
+        /// </summary>
+        /// <param name="logger">The logger to report stale entries and write failures to.</param>
+        /// <param name="directory">The directory to keep the entries in. Will be created if missing.</param>
+        /// <param name="inner">The parser to use for contents that are not cached yet.</param>
+        /// <param name="minimum_length">Contents shorter than this are passed to the inner parser directly,
+        /// as they are cheaper to parse than to load from disk.</param>
+        bytecode_cache(Logger& logger, std::filesystem::path directory, std::unique_ptr<::sqf::runtime::parser::sqf> inner, size_t minimum_length = 512) :
+            CanLog(logger),
+            m_inner(std::move(inner)),
+            m_directory(std::move(directory)),
+            m_minimum_length(minimum_length),
+            m_hits(0),
+            m_misses(0),
+            m_stale(0)
+        {
+        }
+        using ::sqf::runtime::parser::sqf::check_syntax;
+        using ::sqf::runtime::parser::sqf::parse;
+        virtual ~bytecode_cache() override { };
+        virtual bool check_syntax(const context& context, std::string contents, ::sqf::runtime::fileio::pathinfo file) override;
+        virtual std::optional<::sqf::runtime::instruction_set> parse(const context& context, std::string contents, ::sqf::runtime::fileio::pathinfo file) override;
+
+        ::sqf::runtime::parser::sqf& inner() { return *m_inner; }
+        const std::filesystem::path& directory() const { return m_directory; }
+        statistics stats() const { return { m_hits, m_misses, m_stale }; }
+    };
+}
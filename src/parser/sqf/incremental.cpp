@@ -0,0 +1,271 @@
+#include "incremental.hpp"
+
+#include "../../opcodes/push.h"
+#include "../../runtime/d_code.h"
+
+#include <algorithm>
+
+namespace
+{
+    // Moves instructions of the statements following an edit to their new position and source.
+    // Columns only change on the line the first of them starts at, as everything following is unchanged.
+    // Lines only change up to the next #line directive (boundary), as it sets the line explicitly.
+    struct relocation
+    {
+        ptrdiff_t offset;
+        ptrdiff_t line;
+        ptrdiff_t column;
+        size_t column_line;
+        size_t boundary;
+        const ::sqf::parser::sqf::parser::source_resolver& sources;
+
+        std::shared_ptr<const ::sqf::runtime::diagnostics::source_file> source(const std::shared_ptr<const ::sqf::runtime::diagnostics::source_file>& previous) const
+        {
+            return previous ? sources(previous->path().physical) : previous;
+        }
+
+        template<typename T>
+        void apply(T& offset_ref, T& line_ref, T& column_ref) const
+        {
+            if (offset_ref < boundary)
+            {
+                if (line_ref == column_line)
+                {
+                    column_ref = static_cast<T>(static_cast<ptrdiff_t>(column_ref) + column);
+                }
+                line_ref = static_cast<T>(static_cast<ptrdiff_t>(line_ref) + line);
+            }
+            offset_ref = static_cast<T>(static_cast<ptrdiff_t>(offset_ref) + offset);
+        }
+        void apply(::sqf::runtime::instruction& inst) const
+        {
+            auto location = inst.location();
+            apply(location.offset, location.line, location.column);
+            location.source = source(location.source);
+            inst.location(std::move(location));
+
+            if (auto push = dynamic_cast<const ::sqf::opcodes::push*>(&inst))
+            {
+                auto& value = push->value();
+                if (value.is<::sqf::runtime::t_code>())
+                {
+                    apply(value.data<::sqf::types::d_code>()->value());
+                }
+            }
+        }
+        void apply(const ::sqf::runtime::instruction_set& set) const
+        {
+            for (auto& inst : set)
+            {
+                apply(*inst);
+            }
+        }
+        void apply(::sqf::parser::sqf::parser::statement& statement) const
+        {
+            apply(statement.start.offset, statement.start.line, statement.start.column);
+            statement.start.source = source(statement.start.source);
+            for (auto& inst : statement.instructions)
+            {
+                apply(*inst);
+            }
+            if (statement.separator)
+            {
+                apply(*statement.separator);
+            }
+        }
+    };
+
+    // Finds the first #line directive at or after offset. The preprocessor places them at the start of a line.
+    size_t find_line_directive(std::string_view contents, size_t offset)
+    {
+        for (auto pos = contents.find("#line", offset); pos != std::string_view::npos; pos = contents.find("#line", pos + 1))
+        {
+            if (pos == 0 || contents[pos - 1] == '\n')
+            {
+                return pos;
+            }
+        }
+        return contents.length();
+    }
+}
+
+std::shared_ptr<const sqf::runtime::diagnostics::source_file> sqf::parser::sqf::incremental::source(const std::string& path)
+{
+    auto& res = m_sources[path];
+    if (!res)
+    {
+        res = std::make_shared<::sqf::runtime::diagnostics::source_file>(
+            path == m_file.physical ? m_file : ::sqf::runtime::fileio::pathinfo{ path, {} }, m_contents);
+    }
+    return res;
+}
+
+std::optional<sqf::runtime::instruction_set> sqf::parser::sqf::incremental::link() const
+{
+    size_t size = 0;
+    for (auto& statement : m_statements)
+    {
+        size += statement.instructions.size() + 1;
+    }
+    std::vector<::sqf::runtime::instruction::sptr> set;
+    set.reserve(size);
+    for (auto& statement : m_statements)
+    {
+        set.insert(set.end(), statement.instructions.begin(), statement.instructions.end());
+        if (statement.separator)
+        {
+            set.push_back(statement.separator);
+        }
+    }
+    return set;
+}
+
+std::optional<sqf::runtime::instruction_set> sqf::parser::sqf::incremental::parse_all(const ::sqf::runtime::parser::sqf::context& context)
+{
+    // New sources, as instruction sets returned earlier are not updated anymore.
+    m_sources.clear();
+    m_statements.clear();
+    m_last = { 0, 0 };
+
+    parser::source_resolver sources = [this](const std::string& path) { return source(path); };
+    m_valid = m_parser.parse_statements(context, m_contents, { 0, 0, 0, source(m_file.physical) }, sources,
+        [&](parser::statement&& current, const parser::position&) -> bool {
+            m_statements.push_back(std::move(current));
+            return true;
+        });
+    m_last.statements_parsed = m_statements.size();
+    if (!m_valid)
+    {
+        m_statements.clear();
+        return {};
+    }
+    return link();
+}
+
+std::optional<sqf::runtime::instruction_set> sqf::parser::sqf::incremental::parse(const ::sqf::runtime::parser::sqf::context& context, std::string contents)
+{
+    m_contents = std::make_shared<const std::string>(std::move(contents));
+    return parse_all(context);
+}
+
+std::optional<sqf::runtime::instruction_set> sqf::parser::sqf::incremental::update(const ::sqf::runtime::parser::sqf::context& context, size_t offset, size_t length, std::string_view replacement)
+{
+    auto previous = m_contents;
+    offset = std::min(offset, previous->length());
+    length = std::min(length, previous->length() - offset);
+
+    std::string contents;
+    contents.reserve(previous->length() - length + replacement.length());
+    contents.append(*previous, 0, offset);
+    contents.append(replacement);
+    contents.append(*previous, offset + length, std::string::npos);
+    m_contents = std::make_shared<const std::string>(std::move(contents));
+
+    if (!m_valid)
+    {
+        return parse_all(context);
+    }
+
+    // The statement containing the edit may merge with the one before it (eg. when removing a separator),
+    // thus parsing starts one statement earlier.
+    auto containing = std::upper_bound(m_statements.begin(), m_statements.end(), offset,
+        [](size_t value, const parser::statement& statement) { return value < statement.start.offset; });
+    size_t start = static_cast<size_t>(containing - m_statements.begin());
+    start = start < 2 ? 0 : start - 2;
+
+    auto edit_end = offset + replacement.length();
+    auto previous_edit_end = offset + length;
+    auto delta = static_cast<ptrdiff_t>(replacement.length()) - static_cast<ptrdiff_t>(length);
+
+    // Instruction sets returned earlier may still be referenced (eg. by a context), including the instructions
+    // of the statements parsed again. Their sources thus keep the previous contents, while everything parsed
+    // or moved now refers to new sources.
+    m_sources.clear();
+    parser::source_resolver sources = [this](const std::string& path) { return source(path); };
+    relocation move{ delta, 0, 0, 0, 0, sources };
+    parser::position position = { 0, 0, 0, source(m_file.physical) };
+    if (start > 0)
+    {
+        position = m_statements[start].start;
+        position.source = move.source(position.source);
+    }
+
+    std::vector<parser::statement> fresh;
+    size_t reuse = m_statements.size();
+    auto success = m_parser.parse_statements(context, m_contents, position, sources,
+        [&](parser::statement&& current, const parser::position& next) -> bool {
+            fresh.push_back(std::move(current));
+            if (next.offset < edit_end || next.offset == m_contents->length())
+            {
+                return true;
+            }
+            // Once a statement starts at the same text as a statement after the edit did before,
+            // with the same path, everything following parses exactly the same.
+            auto previous_offset = static_cast<size_t>(static_cast<ptrdiff_t>(next.offset) - delta);
+            if (previous_offset < previous_edit_end)
+            {
+                return true;
+            }
+            auto it = std::lower_bound(m_statements.begin() + start, m_statements.end(), previous_offset,
+                [](const parser::statement& statement, size_t value) { return statement.start.offset < value; });
+            if (it == m_statements.end() || it->start.offset != previous_offset || move.source(it->start.source) != next.source)
+            {
+                return true;
+            }
+            reuse = static_cast<size_t>(it - m_statements.begin());
+            move.line = static_cast<ptrdiff_t>(next.line) - static_cast<ptrdiff_t>(it->start.line);
+            move.column = static_cast<ptrdiff_t>(next.column) - static_cast<ptrdiff_t>(it->start.column);
+            move.column_line = it->start.line;
+            move.boundary = find_line_directive(*previous, previous_offset);
+            return false;
+        });
+    if (!success)
+    {
+        m_valid = false;
+        m_statements.clear();
+        m_last = { fresh.size(), 0 };
+        return {};
+    }
+
+    m_last = { fresh.size(), start + (m_statements.size() - reuse) };
+    // Statements before the edit keep their position, but refer to the new sources as well.
+    relocation keep{ 0, 0, 0, 0, 0, sources };
+    for (auto it = m_statements.begin(); it != m_statements.begin() + start; ++it)
+    {
+        keep.apply(*it);
+    }
+    for (auto it = m_statements.begin() + reuse; it != m_statements.end(); ++it)
+    {
+        move.apply(*it);
+    }
+    fresh.insert(fresh.begin(), std::make_move_iterator(m_statements.begin()), std::make_move_iterator(m_statements.begin() + start));
+    fresh.insert(fresh.end(), std::make_move_iterator(m_statements.begin() + reuse), std::make_move_iterator(m_statements.end()));
+    m_statements = std::move(fresh);
+    return link();
+}
+
+std::optional<sqf::runtime::instruction_set> sqf::parser::sqf::incremental::update(const ::sqf::runtime::parser::sqf::context& context, std::string_view contents)
+{
+    if (!m_valid)
+    {
+        return parse(context, std::string(contents));
+    }
+    std::string_view previous = *m_contents;
+    if (previous == contents)
+    {
+        m_last = { 0, m_statements.size() };
+        return link();
+    }
+    auto max = std::min(previous.length(), contents.length());
+    size_t prefix = 0;
+    while (prefix < max && previous[prefix] == contents[prefix])
+    {
+        prefix++;
+    }
+    size_t suffix = 0;
+    while (suffix < max - prefix && previous[previous.length() - 1 - suffix] == contents[contents.length() - 1 - suffix])
+    {
+        suffix++;
+    }
+    return update(context, prefix, previous.length() - prefix - suffix, contents.substr(prefix, contents.length() - prefix - suffix));
+}
@@ -0,0 +1,81 @@
+#pragma once
+#include "sqf_parser.hpp"
+#include "../../runtime/diagnostics/source_file.h"
+#include "../../runtime/fileio.h"
+#include "../../runtime/instruction_set.h"
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace sqf::parser::sqf
+{
+    /// <summary>
+    /// Keeps the parsed top-level statements of a single file, so that an edit
+    /// only requires the statements it touches to be parsed again.
+    /// Statements following the edit are reused and moved to their new position.
+    /// </summary>
+    /// <remarks>
+    /// Operates on preprocessed contents. Reused instructions are updated in place,
+    /// thus instruction sets returned earlier report positions in the latest contents for them.
+    /// Instructions replaced by an update keep referring to the contents they got parsed from.
+    /// Lines following a #line directive are not moved, as they do not depend on anything before it.
+    /// </remarks>
+    class incremental
+    {
+    public:
+        struct statistics
+        {
+            size_t statements_parsed;
+            size_t statements_reused;
+        };
+    private:
+        parser& m_parser;
+        ::sqf::runtime::fileio::pathinfo m_file;
+        std::shared_ptr<const std::string> m_contents;
+        // One source per path instructions got attributed to, all of them referring to m_contents.
+        // Recreated for every update, as sources handed out earlier have to keep their contents.
+        std::unordered_map<std::string, std::shared_ptr<::sqf::runtime::diagnostics::source_file>> m_sources;
+        std::vector<parser::statement> m_statements;
+        // Whether m_statements got created from m_contents. Not the case after a syntax error.
+        bool m_valid;
+        statistics m_last;
+
+        std::shared_ptr<const ::sqf::runtime::diagnostics::source_file> source(const std::string& path);
+        std::optional<::sqf::runtime::instruction_set> link() const;
+        std::optional<::sqf::runtime::instruction_set> parse_all(const ::sqf::runtime::parser::sqf::context& context);
+    public:
+        incremental(parser& parser, ::sqf::runtime::fileio::pathinfo file) :
+            m_parser(parser),
+            m_file(std::move(file)),
+            m_contents(std::make_shared<const std::string>()),
+            m_valid(false),
+            m_last{ 0, 0 }
+        {
+        }
+
+        /// <summary>
+        /// Replaces the contents of the file and parses them as a whole.
+        /// </summary>
+        std::optional<::sqf::runtime::instruction_set> parse(const ::sqf::runtime::parser::sqf::context& context, std::string contents);
+        /// <summary>
+        /// Replaces length characters at offset with replacement and parses the statements affected.
+        /// </summary>
+        std::optional<::sqf::runtime::instruction_set> update(const ::sqf::runtime::parser::sqf::context& context, size_t offset, size_t length, std::string_view replacement);
+        /// <summary>
+        /// Replaces the contents of the file, parsing only the range that differs from the current contents.
+        /// </summary>
+        std::optional<::sqf::runtime::instruction_set> update(const ::sqf::runtime::parser::sqf::context& context, std::string_view contents);
+
+        parser& owner() const { return m_parser; }
+        std::string_view contents() const { return *m_contents; }
+        const ::sqf::runtime::fileio::pathinfo& file() const { return m_file; }
+        /// <summary>
+        /// Amount of statements parsed and reused by the last parse or update.
+        /// </summary>
+        statistics last() const { return m_last; }
+    };
+}
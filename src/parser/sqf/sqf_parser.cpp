@@ -1,7 +1,6 @@
 #include "sqf_parser.hpp"
 #include "sqf_parser.hpp"
 #include "tokenizer.hpp"
-#include "parser.tab.hh"
 
 #include "../../opcodes/common.h"
 #include "../../runtime/d_array.h"
@@ -9,9 +8,11 @@
 #include "../../runtime/d_scalar.h"
 #include "../../runtime/d_boolean.h"
 #include "../../runtime/d_code.h"
+#include "../../runtime/runtime.h"
 #include <algorithm>
 #include <charconv>
 #include <sstream>
+#include <deque>
 
 using namespace std::string_literals;
 using namespace std::string_view_literals;
@@ -40,224 +41,775 @@ namespace sqf::parser::sqf::util
     }
 }
 
-void ::sqf::parser::sqf::parser::to_assembly(std::string_view contents, const ::sqf::parser::sqf::bison::astnode& node, std::vector<::sqf::runtime::instruction::sptr>& set)
+namespace
 {
+    // Token kinds as seen by the parser. Identifiers and operators get classified
+    // using the operators currently registered in the runtime.
+    enum class lexeme_kind
+    {
+        end_of_file,
+        invalid,
+        t_false,
+        t_true,
+        t_private,
+        curlyo,
+        curlyc,
+        roundo,
+        roundc,
+        edgeo,
+        edgec,
+        semicolon,
+        comma,
+        equal,
+        binary,
+        binary_unary,
+        binary_nular,
+        binary_unary_nular,
+        unary,
+        nular,
+        unary_nular,
+        ident,
+        number,
+        hexnumber,
+        string
+    };
+    struct lexeme
+    {
+        ::sqf::parser::sqf::tokenizer::token token;
+        lexeme_kind kind;
+        short precedence;
+    };
 
-    switch (node.kind)
+    // Summary of a parsed expression, providing what is needed to emit the surrounding instructions.
+    struct node
     {
-    case bison::astkind::EXP0:
-    case bison::astkind::EXP1:
-    case bison::astkind::EXP2:
-    case bison::astkind::EXP3:
-    case bison::astkind::EXP4:
-    case bison::astkind::EXP5:
-    case bison::astkind::EXP6:
-    case bison::astkind::EXP7:
-    case bison::astkind::EXP8:
-    case bison::astkind::EXP9:
+        ::sqf::parser::sqf::tokenizer::token token;
+        bool is_number;
+    };
+
+    std::string lowercase(std::string_view view)
     {
-        to_assembly(contents, node.children[0], set);
-        to_assembly(contents, node.children[1], set);
-        auto s = std::string(node.token.contents);
+        std::string s(view);
         std::transform(s.begin(), s.end(), s.begin(), [](char& c) { return (char)std::tolower((int)c); });
-        auto inst = std::make_shared<::sqf::opcodes::call_binary>(s, (short)(((short)node.kind - (short)bison::astkind::EXP0) + 1));
-        inst->diag_info({ node.token.line, node.token.column, node.token.offset, { *node.token.path, {} }, create_code_segment(contents, node.token.offset, node.token.contents.length()) });
-        set.push_back(inst);
+        return s;
     }
-    break;
-    case bison::astkind::EXPU:
+
+    // Names of the lexeme kinds as reported in diagnostics.
+    // Kept identical to the token names of the former bison grammar.
+    std::string to_string(const lexeme& l)
     {
-        auto s = std::string(node.token.contents);
-        to_assembly(contents, node.children[0], set);
-        if (node.children[0].kind == bison::astkind::NUMBER && (s == "+" || s == "-"))
+        switch (l.kind)
         {
-            if (s == "-")
-            {
-                auto child = std::static_pointer_cast<::sqf::opcodes::push>(set.back());
-                auto scalar = child->value().data<::sqf::types::d_scalar>();
-                scalar->value(-scalar->value());
-            }
+        case lexeme_kind::end_of_file: return "END_OF_FILE";
+        case lexeme_kind::invalid: return "INVALID";
+        case lexeme_kind::t_false: return "false";
+        case lexeme_kind::t_true: return "true";
+        case lexeme_kind::t_private: return "private";
+        case lexeme_kind::curlyo: return "{";
+        case lexeme_kind::curlyc: return "}";
+        case lexeme_kind::roundo: return "(";
+        case lexeme_kind::roundc: return ")";
+        case lexeme_kind::edgeo: return "[";
+        case lexeme_kind::edgec: return "]";
+        case lexeme_kind::semicolon: return ";";
+        case lexeme_kind::comma: return "\",\"";
+        case lexeme_kind::equal: return "=";
+        case lexeme_kind::binary: return "OPERATOR_B_" + std::to_string(l.precedence - 1);
+        case lexeme_kind::binary_unary: return "OPERATOR_BU_" + std::to_string(l.precedence - 1);
+        case lexeme_kind::binary_nular: return "OPERATOR_BN_" + std::to_string(l.precedence - 1);
+        case lexeme_kind::binary_unary_nular: return "OPERATOR_BUN_" + std::to_string(l.precedence - 1);
+        case lexeme_kind::unary: return "OPERATOR_U";
+        case lexeme_kind::nular: return "OPERATOR_N";
+        case lexeme_kind::unary_nular: return "OPERATOR_UN";
+        case lexeme_kind::ident: return "IDENT";
+        case lexeme_kind::number: return "NUMBER";
+        case lexeme_kind::hexnumber: return "HEXNUMBER";
+        case lexeme_kind::string: return "STRING";
+        default: return "INVALID";
         }
-        else
+    }
+
+    bool is_binary(lexeme_kind kind)
+    {
+        switch (kind)
         {
-            std::transform(s.begin(), s.end(), s.begin(), [](char& c) { return (char)std::tolower((int)c); });
-            auto inst = std::make_shared<::sqf::opcodes::call_unary>(s);
-            inst->diag_info({ node.token.line, node.token.column, node.token.offset, { *node.token.path, {} }, create_code_segment(contents, node.token.offset, node.token.contents.length()) });
-            set.push_back(inst);
+        case lexeme_kind::binary:
+        case lexeme_kind::binary_unary:
+        case lexeme_kind::binary_nular:
+        case lexeme_kind::binary_unary_nular:
+            return true;
+        default:
+            return false;
         }
     }
-    break;
-    case bison::astkind::EXPN:
+
+    bool is_operand_start(lexeme_kind kind)
     {
-        auto s = std::string(node.token.contents);
-        std::transform(s.begin(), s.end(), s.begin(), [](char& c) { return (char)std::tolower((int)c); });
-        auto inst = std::make_shared<::sqf::opcodes::call_nular>(s);
-        inst->diag_info({ node.token.line, node.token.column, node.token.offset, { *node.token.path, {} }, create_code_segment(contents, node.token.offset, node.token.contents.length()) });
-        set.push_back(inst);
+        switch (kind)
+        {
+        case lexeme_kind::t_private:
+        case lexeme_kind::unary:
+        case lexeme_kind::unary_nular:
+        case lexeme_kind::binary_unary:
+        case lexeme_kind::binary_unary_nular:
+        case lexeme_kind::roundo:
+        case lexeme_kind::string:
+        case lexeme_kind::nular:
+        case lexeme_kind::binary_nular:
+        case lexeme_kind::ident:
+        case lexeme_kind::number:
+        case lexeme_kind::hexnumber:
+        case lexeme_kind::t_true:
+        case lexeme_kind::t_false:
+        case lexeme_kind::curlyo:
+        case lexeme_kind::edgeo:
+            return true;
+        default:
+            return false;
+        }
     }
-    break;
-    case bison::astkind::HEXNUMBER:
+
+    // Precedence climbing parser, reading the tokenizer directly and emitting instructions
+    // while parsing. Binary operators with precedence 1 bind the weakest, unary operators
+    // always bind to the next operand only.
+    //
+    // Grammar (lowest to highest binding):
+    //   start      := END_OF_FILE | statement { separators statement } [ separators ]
+    //   statement  := [ "private" ] IDENT "=" expression | expression
+    //   expression := operand { BINARY operand }     (left associative, grouped by precedence 1 to 10)
+    //   operand    := UNARY operand | "(" expression ")" | value
+    //   value      := literal | NULAR | IDENT | "{" [ separators ] [ statement { separators statement } [ separators ] ] "}"
+    //               | "[" [ expression { "," expression } ] "]"
+    //
+    // Operators that may be used both as unary and nular operator are used as unary operator
+    // whenever the next token is able to start an operand.
+    //
+    // Without emitting, nothing besides the lookahead gets allocated. Instead of stopping at the
+    // first syntax error, the parser then skips to the next statement to report all of them.
+    class pratt_parser
     {
-        try
+        ::sqf::parser::sqf::tokenizer& m_tokenizer;
+        const ::sqf::parser::sqf::parser& m_owner;
+        std::shared_ptr<const std::string> m_contents;
+        bool m_emit;
+        bool m_failed;
+        std::deque<lexeme> m_lookahead;
+        std::shared_ptr<const ::sqf::runtime::sqfop_names> m_operators;
+        std::shared_ptr<const ::sqf::runtime::diagnostics::source_file> m_source;
+        const std::string* m_source_path;
+        const ::sqf::parser::sqf::parser::source_resolver* m_sources;
+
+        const std::shared_ptr<const ::sqf::runtime::diagnostics::source_file>& source(const std::string* path)
         {
-            auto str = std::string(node.token.contents);
-            if (str[0] == '$') { str = "0x"s.append(str.substr(1)); }
-            auto hexnum = (int64_t)std::stol(str, nullptr, 16);
-            auto inst = std::make_shared<::sqf::opcodes::push>(
-                ::sqf::runtime::value(
-                    std::make_shared<::sqf::types::d_scalar>(
-                        hexnum)));
-            inst->diag_info({ node.token.line, node.token.column, node.token.offset, { *node.token.path, {} }, create_code_segment(contents, node.token.offset, node.token.contents.length()) });
-            set.push_back(inst);
+            // Paths only change using #line, thus checking the last source is enough to share it between instructions.
+            if (!m_source || m_source_path != path)
+            {
+                m_source_path = path;
+                m_source = m_sources ? (*m_sources)(*path) :
+                    std::make_shared<::sqf::runtime::diagnostics::source_file>(::sqf::runtime::fileio::pathinfo{ *path, {} }, m_contents);
+            }
+            return m_source;
         }
-        catch (std::out_of_range&)
+        ::sqf::runtime::diagnostics::source_location location(const ::sqf::parser::sqf::tokenizer::token& token, size_t column_offset = 0)
         {
-            auto inst = std::make_shared<::sqf::opcodes::push>(::sqf::runtime::value(std::make_shared<::sqf::types::d_scalar>(std::nanf(""))));
-            inst->diag_info({ node.token.line, node.token.column, node.token.offset, { *node.token.path, {} }, create_code_segment(contents, node.token.offset, node.token.contents.length()) });
-            __log(logmessage::assembly::NumberOutOfRange(inst->diag_info()));
-            set.push_back(inst);
+            return { source(token.path), token.line, token.column + column_offset, token.offset, token.contents.length() };
         }
-    }
-    break;
-    case bison::astkind::NUMBER:
-    {
-        try
+
+        std::pair<lexeme_kind, short> classify(std::string_view contents) const
         {
-            auto inst = std::make_shared<::sqf::opcodes::push>(::sqf::runtime::value(std::make_shared<::sqf::types::d_scalar>((double)std::stod(std::string(node.token.contents)))));
-            inst->diag_info({ node.token.line, node.token.column, node.token.offset, { *node.token.path, {} }, create_code_segment(contents, node.token.offset, node.token.contents.length()) });
-            set.push_back(inst);
+            auto entry = m_operators->find(contents);
+            if (!entry)
+            {
+                return { lexeme_kind::ident, 0 };
+            }
+            bool binary = entry->is_binary();
+            bool unary = entry->is_unary();
+            bool nular = entry->is_nular();
+            if (binary && (entry->precedence < 1 || entry->precedence > 10))
+            {
+                // Binary operators outside of the supported precedence range cannot be used at all.
+                return { lexeme_kind::ident, 0 };
+            }
+            lexeme_kind kind =
+                binary && unary && nular ? lexeme_kind::binary_unary_nular :
+                binary && unary ? lexeme_kind::binary_unary :
+                binary && nular ? lexeme_kind::binary_nular :
+                binary ? lexeme_kind::binary :
+                unary && nular ? lexeme_kind::unary_nular :
+                unary ? lexeme_kind::unary :
+                lexeme_kind::nular;
+            return { kind, entry->precedence };
         }
-        catch (std::out_of_range&)
+
+        lexeme lex()
         {
-            auto inst = std::make_shared<::sqf::opcodes::push>(::sqf::runtime::value(std::make_shared<::sqf::types::d_scalar>(std::nanf(""))));
-            inst->diag_info({ node.token.line, node.token.column, node.token.offset, { *node.token.path, {} }, create_code_segment(contents, node.token.offset, node.token.contents.length()) });
-            __log(logmessage::assembly::NumberOutOfRange(inst->diag_info()));
-            set.push_back(inst);
+            using etoken = ::sqf::parser::sqf::tokenizer::etoken;
+            while (true)
+            {
+                auto token = m_tokenizer.next();
+                switch (token.type)
+                {
+                case etoken::m_line:
+                case etoken::i_comment_line:
+                case etoken::i_comment_block:
+                case etoken::i_whitespace:
+                    continue;
+                case etoken::eof: return { token, lexeme_kind::end_of_file, 0 };
+                case etoken::t_false: return { token, lexeme_kind::t_false, 0 };
+                case etoken::t_true: return { token, lexeme_kind::t_true, 0 };
+                case etoken::t_private: return { token, lexeme_kind::t_private, 0 };
+                case etoken::s_curlyo: return { token, lexeme_kind::curlyo, 0 };
+                case etoken::s_curlyc: return { token, lexeme_kind::curlyc, 0 };
+                case etoken::s_roundo: return { token, lexeme_kind::roundo, 0 };
+                case etoken::s_roundc: return { token, lexeme_kind::roundc, 0 };
+                case etoken::s_edgeo: return { token, lexeme_kind::edgeo, 0 };
+                case etoken::s_edgec: return { token, lexeme_kind::edgec, 0 };
+                case etoken::s_semicolon: return { token, lexeme_kind::semicolon, 0 };
+                case etoken::s_comma: return { token, lexeme_kind::comma, 0 };
+                case etoken::s_equal: return { token, lexeme_kind::equal, 0 };
+                case etoken::t_string_double:
+                case etoken::t_string_single: return { token, lexeme_kind::string, 0 };
+                case etoken::t_number: return { token, lexeme_kind::number, 0 };
+                case etoken::t_hexadecimal: return { token, lexeme_kind::hexnumber, 0 };
+                case etoken::t_ident:
+                case etoken::t_operator:
+                {
+                    auto classification = classify(token.contents);
+                    if (classification.first == lexeme_kind::ident && token.type == etoken::t_operator)
+                    {
+                        return { token, lexeme_kind::invalid, 0 };
+                    }
+                    return { token, classification.first, classification.second };
+                }
+                default: return { token, lexeme_kind::invalid, 0 };
+                }
+            }
         }
-    }
-    break;
-    case bison::astkind::STRING:
-    {
-        auto inst = std::make_shared<::sqf::opcodes::push>(::sqf::runtime::value(std::make_shared<::sqf::types::d_string>(::sqf::types::d_string::from_sqf(node.token.contents))));
-        inst->diag_info({ node.token.line, node.token.column, node.token.offset, { *node.token.path, {} }, create_code_segment(contents, node.token.offset, node.token.contents.length()) });
-        set.push_back(inst);
-    }
-    break;
-    case bison::astkind::BOOLEAN_TRUE:
-    {
-        auto inst = std::make_shared<::sqf::opcodes::push>(::sqf::runtime::value(true));
-        inst->diag_info({ node.token.line, node.token.column, node.token.offset, { *node.token.path, {} }, create_code_segment(contents, node.token.offset, node.token.contents.length()) });
-        set.push_back(inst);
-    }
-    break;
-    case bison::astkind::BOOLEAN_FALSE:
-    {
-        auto inst = std::make_shared<::sqf::opcodes::push>(::sqf::runtime::value(false));
-        inst->diag_info({ node.token.line, node.token.column, node.token.offset, { *node.token.path, {} }, create_code_segment(contents, node.token.offset, node.token.contents.length()) });
-        set.push_back(inst);
-    }
-    break;
-    case bison::astkind::CODE:
-    {
-        std::vector<::sqf::runtime::instruction::sptr> tmp_set;
-        bison::astnode previous_node;
-        for (size_t i = 0; i < node.children.size(); i++)
+        const lexeme& peek(size_t index = 0)
         {
-            if (i != 0)
+            while (m_lookahead.size() <= index)
             {
-                auto inst = std::make_shared<::sqf::opcodes::end_statement>();
-                inst->diag_info({ previous_node.token.line, previous_node.token.column + previous_node.token.contents.length(), previous_node.token.offset, { *previous_node.token.path, {} }, create_code_segment(contents, previous_node.token.offset, previous_node.token.contents.length()) });
-                tmp_set.push_back(inst);
+                m_lookahead.push_back(lex());
             }
-            previous_node = node.children[i];
-            to_assembly(contents, previous_node, tmp_set);
+            return m_lookahead[index];
         }
-        auto inst_set = ::sqf::runtime::instruction_set(tmp_set);
-        auto inst = std::make_shared<::sqf::opcodes::push>(::sqf::runtime::value(std::make_shared<::sqf::types::d_code>(inst_set)));
-        inst->diag_info({ node.token.line, node.token.column, node.token.offset, { *node.token.path, {} }, create_code_segment(contents, node.token.offset, node.token.contents.length()) });
-        set.push_back(inst);
-    }
-    break;
-    case bison::astkind::ARRAY:
-    {
-        for (auto& subnode : node.children)
+        lexeme take()
         {
-            to_assembly(contents, subnode, set);
+            auto l = peek();
+            m_lookahead.pop_front();
+            return l;
         }
-        auto inst = std::make_shared<::sqf::opcodes::make_array>(node.children.size());
-        inst->diag_info({ node.token.line, node.token.column, node.token.offset, { *node.token.path, {} }, create_code_segment(contents, node.token.offset, node.token.contents.length()) });
-        set.push_back(inst);
-    }
-    break;
-    case bison::astkind::ASSIGNMENT:
-    {
-        to_assembly(contents, node.children[0], set);
-        auto inst = std::make_shared<::sqf::opcodes::assign_to>(node.token.contents);
-        inst->diag_info({ node.token.line, node.token.column, node.token.offset, { *node.token.path, {} }, create_code_segment(contents, node.token.offset, node.token.contents.length()) });
-        set.push_back(inst);
-    }
-    break;
-    case bison::astkind::ASSIGNMENT_LOCAL:
-    {
-        to_assembly(contents, node.children[0], set);
-        auto inst = std::make_shared<::sqf::opcodes::assign_to_local>(node.token.contents);
-        inst->diag_info({ node.token.line, node.token.column, node.token.offset, { *node.token.path, {} }, create_code_segment(contents, node.token.offset, node.token.contents.length()) });
-        set.push_back(inst);
-    }
-    break;
-    case bison::astkind::IDENT:
-    {
-        auto inst = std::make_shared<::sqf::opcodes::get_variable>(node.token.contents);
-        inst->diag_info({ node.token.line, node.token.column, node.token.offset, { *node.token.path, {} }, create_code_segment(contents, node.token.offset, node.token.contents.length()) });
-        set.push_back(inst);
-    }
-    break;
-    default:
-    {
-        bison::astnode previous_node;
-        for (size_t i = 0; i < node.children.size(); i++)
+        bool is_separator(lexeme_kind kind) { return kind == lexeme_kind::semicolon || kind == lexeme_kind::comma; }
+
+        void fail(const lexeme& unexpected, std::string_view expecting)
         {
-            if (i != 0)
+            auto msg = "syntax error, unexpected "s + to_string(unexpected);
+            if (!expecting.empty())
             {
-                auto inst = std::make_shared<::sqf::opcodes::end_statement>();
-                inst->diag_info({ previous_node.token.line, previous_node.token.column + previous_node.token.contents.length(), previous_node.token.offset, { *previous_node.token.path, {} }, create_code_segment(contents, previous_node.token.offset, previous_node.token.contents.length()) });
-                set.push_back(inst);
+                msg.append(", expecting "sv);
+                msg.append(expecting);
             }
-            previous_node = node.children[i];
-            to_assembly(contents, previous_node, set);
+            m_owner.__log(logmessage::sqf::ParseError({ *unexpected.token.path, unexpected.token.line, unexpected.token.column }, msg));
         }
-    }
-    }
-}
 
-bool sqf::parser::sqf::parser::get_tree(::sqf::runtime::runtime& runtime, ::sqf::parser::sqf::tokenizer& t, ::sqf::parser::sqf::bison::astnode* out)
-{
-    ::sqf::parser::sqf::bison::parser p(t, *out, *this, runtime);
-    bool success = p.parse() == 0;
-    return success;
+        // Skips the remains of a statement that failed to parse, up to and including the next separator
+        // or up to the terminator, ignoring everything enclosed by brackets.
+        // Returns false if the terminator cannot be reached anymore.
+        bool recover(lexeme_kind terminator)
+        {
+            m_failed = true;
+            size_t depth = 0;
+            while (true)
+            {
+                auto kind = peek().kind;
+                if (kind == lexeme_kind::end_of_file)
+                {
+                    return terminator == lexeme_kind::end_of_file;
+                }
+                if (kind == lexeme_kind::invalid)
+                {
+                    // The tokenizer does not move past invalid input.
+                    return false;
+                }
+                if (depth == 0 && kind == terminator)
+                {
+                    return true;
+                }
+                take();
+                switch (kind)
+                {
+                case lexeme_kind::curlyo:
+                case lexeme_kind::roundo:
+                case lexeme_kind::edgeo:
+                    depth++;
+                    break;
+                case lexeme_kind::curlyc:
+                case lexeme_kind::roundc:
+                case lexeme_kind::edgec:
+                    if (depth > 0) { depth--; }
+                    break;
+                case lexeme_kind::semicolon:
+                case lexeme_kind::comma:
+                    if (depth == 0)
+                    {
+                        while (is_separator(peek().kind))
+                        {
+                            take();
+                        }
+                        return true;
+                    }
+                    break;
+                default:
+                    break;
+                }
+            }
+        }
+
+        // Parses statements until the terminator is encountered, leaving the terminator in place.
+        bool statements(std::vector<::sqf::runtime::instruction::sptr>& set, lexeme_kind terminator, std::string_view expecting)
+        {
+            while (peek().kind != terminator)
+            {
+                auto current = statement(set);
+                if (!current.has_value())
+                {
+                    if (m_emit || !recover(terminator))
+                    {
+                        return false;
+                    }
+                    continue;
+                }
+                if (!is_separator(peek().kind))
+                {
+                    if (peek().kind == terminator)
+                    {
+                        return true;
+                    }
+                    fail(peek(), expecting);
+                    if (m_emit || !recover(terminator))
+                    {
+                        return false;
+                    }
+                    continue;
+                }
+                while (is_separator(peek().kind))
+                {
+                    take();
+                }
+                if (peek().kind != terminator && !is_operand_start(peek().kind))
+                {
+                    fail(peek(), expecting);
+                    if (m_emit || !recover(terminator))
+                    {
+                        return false;
+                    }
+                    continue;
+                }
+                if (m_emit && peek().kind != terminator)
+                {
+                    auto inst = std::make_shared<::sqf::opcodes::end_statement>();
+                    inst->location(location(current->token, current->token.contents.length()));
+                    set.push_back(inst);
+                }
+            }
+            return true;
+        }
+        std::optional<node> statement(std::vector<::sqf::runtime::instruction::sptr>& set)
+        {
+            if (peek().kind == lexeme_kind::ident && peek(1).kind == lexeme_kind::equal)
+            {
+                auto ident = take();
+                take();
+                if (!expression(set, 1).has_value())
+                {
+                    return {};
+                }
+                if (m_emit)
+                {
+                    auto inst = std::make_shared<::sqf::opcodes::assign_to>(ident.token.contents);
+                    inst->location(location(ident.token));
+                    set.push_back(inst);
+                }
+                return node{ ident.token, false };
+            }
+            if (peek().kind == lexeme_kind::t_private && peek(1).kind == lexeme_kind::ident && peek(2).kind == lexeme_kind::equal)
+            {
+                take();
+                auto ident = take();
+                take();
+                if (!expression(set, 1).has_value())
+                {
+                    return {};
+                }
+                if (m_emit)
+                {
+                    auto inst = std::make_shared<::sqf::opcodes::assign_to_local>(ident.token.contents);
+                    inst->location(location(ident.token));
+                    set.push_back(inst);
+                }
+                return node{ ident.token, false };
+            }
+            return expression(set, 1);
+        }
+        std::optional<node> expression(std::vector<::sqf::runtime::instruction::sptr>& set, short minimum_precedence)
+        {
+            auto left = operand(set);
+            if (!left.has_value())
+            {
+                return {};
+            }
+            while (is_binary(peek().kind) && peek().precedence >= minimum_precedence)
+            {
+                auto op = take();
+                if (!expression(set, op.precedence + 1).has_value())
+                {
+                    return {};
+                }
+                if (m_emit)
+                {
+                    auto inst = std::make_shared<::sqf::opcodes::call_binary>(lowercase(op.token.contents), op.precedence);
+                    inst->location(location(op.token));
+                    set.push_back(inst);
+                }
+                left = node{ op.token, false };
+            }
+            return left;
+        }
+        std::optional<node> operand(std::vector<::sqf::runtime::instruction::sptr>& set)
+        {
+            switch (peek().kind)
+            {
+            case lexeme_kind::unary_nular:
+            case lexeme_kind::binary_unary_nular:
+                if (!is_operand_start(peek(1).kind))
+                {
+                    return value(set);
+                }
+                [[fallthrough]];
+            case lexeme_kind::t_private:
+            case lexeme_kind::unary:
+            case lexeme_kind::binary_unary:
+            {
+                auto op = take();
+                auto right = operand(set);
+                if (!right.has_value())
+                {
+                    return {};
+                }
+                auto s = lowercase(op.token.contents);
+                if (right->is_number && (s == "+" || s == "-"))
+                {
+                    if (m_emit && s == "-")
+                    {
+                        auto child = std::static_pointer_cast<::sqf::opcodes::push>(set.back());
+                        auto scalar = child->value().data<::sqf::types::d_scalar>();
+                        scalar->value(-scalar->value());
+                    }
+                }
+                else if (m_emit)
+                {
+                    auto inst = std::make_shared<::sqf::opcodes::call_unary>(s);
+                    inst->location(location(op.token));
+                    set.push_back(inst);
+                }
+                return node{ op.token, false };
+            }
+            case lexeme_kind::roundo:
+            {
+                take();
+                auto inner = expression(set, 1);
+                if (!inner.has_value())
+                {
+                    return {};
+                }
+                if (peek().kind != lexeme_kind::roundc)
+                {
+                    fail(peek(), ")");
+                    return {};
+                }
+                take();
+                return inner;
+            }
+            default:
+                return value(set);
+            }
+        }
+        std::optional<node> value(std::vector<::sqf::runtime::instruction::sptr>& set)
+        {
+            switch (peek().kind)
+            {
+            case lexeme_kind::string:
+            {
+                auto l = take();
+                if (m_emit)
+                {
+                    auto inst = std::make_shared<::sqf::opcodes::push>(::sqf::runtime::value(std::make_shared<::sqf::types::d_string>(::sqf::types::d_string::from_sqf(l.token.contents))));
+                    inst->location(location(l.token));
+                    set.push_back(inst);
+                }
+                return node{ l.token, false };
+            }
+            case lexeme_kind::nular:
+            case lexeme_kind::unary_nular:
+            case lexeme_kind::binary_nular:
+            case lexeme_kind::binary_unary_nular:
+            {
+                auto l = take();
+                if (m_emit)
+                {
+                    auto inst = std::make_shared<::sqf::opcodes::call_nular>(lowercase(l.token.contents));
+                    inst->location(location(l.token));
+                    set.push_back(inst);
+                }
+                return node{ l.token, false };
+            }
+            case lexeme_kind::ident:
+            {
+                auto l = take();
+                if (m_emit)
+                {
+                    auto inst = std::make_shared<::sqf::opcodes::get_variable>(l.token.contents);
+                    inst->location(location(l.token));
+                    set.push_back(inst);
+                }
+                return node{ l.token, false };
+            }
+            case lexeme_kind::number:
+            {
+                auto l = take();
+                if (m_emit)
+                {
+                    try
+                    {
+                        auto inst = std::make_shared<::sqf::opcodes::push>(::sqf::runtime::value(std::make_shared<::sqf::types::d_scalar>((double)std::stod(std::string(l.token.contents)))));
+                        inst->location(location(l.token));
+                        set.push_back(inst);
+                    }
+                    catch (std::out_of_range&)
+                    {
+                        auto inst = std::make_shared<::sqf::opcodes::push>(::sqf::runtime::value(std::make_shared<::sqf::types::d_scalar>(std::nanf(""))));
+                        inst->location(location(l.token));
+                        m_owner.__log(logmessage::assembly::NumberOutOfRange(inst->diag_info()));
+                        set.push_back(inst);
+                    }
+                }
+                return node{ l.token, true };
+            }
+            case lexeme_kind::hexnumber:
+            {
+                auto l = take();
+                if (m_emit)
+                {
+                    try
+                    {
+                        auto str = std::string(l.token.contents);
+                        if (str[0] == '$') { str = "0x"s.append(str.substr(1)); }
+                        auto hexnum = (int64_t)std::stol(str, nullptr, 16);
+                        auto inst = std::make_shared<::sqf::opcodes::push>(::sqf::runtime::value(std::make_shared<::sqf::types::d_scalar>(hexnum)));
+                        inst->location(location(l.token));
+                        set.push_back(inst);
+                    }
+                    catch (std::out_of_range&)
+                    {
+                        auto inst = std::make_shared<::sqf::opcodes::push>(::sqf::runtime::value(std::make_shared<::sqf::types::d_scalar>(std::nanf(""))));
+                        inst->location(location(l.token));
+                        m_owner.__log(logmessage::assembly::NumberOutOfRange(inst->diag_info()));
+                        set.push_back(inst);
+                    }
+                }
+                return node{ l.token, false };
+            }
+            case lexeme_kind::t_true:
+            case lexeme_kind::t_false:
+            {
+                auto l = take();
+                if (m_emit)
+                {
+                    auto inst = std::make_shared<::sqf::opcodes::push>(::sqf::runtime::value(l.kind == lexeme_kind::t_true));
+                    inst->location(location(l.token));
+                    set.push_back(inst);
+                }
+                return node{ l.token, false };
+            }
+            case lexeme_kind::curlyo:
+            {
+                auto l = take();
+                std::vector<::sqf::runtime::instruction::sptr> code_set;
+                while (is_separator(peek().kind))
+                {
+                    take();
+                }
+                if (!statements(code_set, lexeme_kind::curlyc, "} or ; or \",\""sv))
+                {
+                    return {};
+                }
+                take();
+                if (m_emit)
+                {
+                    auto inst = std::make_shared<::sqf::opcodes::push>(::sqf::runtime::value(std::make_shared<::sqf::types::d_code>(::sqf::runtime::instruction_set(code_set))));
+                    inst->location(location(l.token));
+                    set.push_back(inst);
+                }
+                return node{ l.token, false };
+            }
+            case lexeme_kind::edgeo:
+            {
+                auto l = take();
+                size_t size = 0;
+                if (peek().kind != lexeme_kind::edgec)
+                {
+                    while (true)
+                    {
+                        if (!expression(set, 1).has_value())
+                        {
+                            return {};
+                        }
+                        size++;
+                        if (peek().kind == lexeme_kind::edgec)
+                        {
+                            break;
+                        }
+                        if (peek().kind != lexeme_kind::comma)
+                        {
+                            fail(peek(), "] or \",\""sv);
+                            return {};
+                        }
+                        take();
+                    }
+                }
+                take();
+                if (m_emit)
+                {
+                    auto inst = std::make_shared<::sqf::opcodes::make_array>(size);
+                    inst->location(location(l.token));
+                    set.push_back(inst);
+                }
+                return node{ l.token, false };
+            }
+            default:
+                fail(peek(), {});
+                return {};
+            }
+        }
+    public:
+        pratt_parser(std::shared_ptr<const ::sqf::runtime::sqfop_names> operators, ::sqf::parser::sqf::tokenizer& tokenizer, const ::sqf::parser::sqf::parser& owner, std::shared_ptr<const std::string> contents, bool emit) :
+            m_tokenizer(tokenizer),
+            m_owner(owner),
+            m_contents(std::move(contents)),
+            m_emit(emit),
+            m_failed(false),
+            m_operators(std::move(operators)),
+            m_source_path(nullptr),
+            m_sources(nullptr)
+        {
+        }
+
+        bool parse(std::vector<::sqf::runtime::instruction::sptr>& set)
+        {
+            // Other than code blocks, files may not start with separators,
+            // which is reported by the first statement.
+            return statements(set, lexeme_kind::end_of_file, "END_OF_FILE"sv) && !m_failed;
+        }
+
+        // Takes the sources instructions refer to from sources, rather than creating them.
+        void sources(const ::sqf::parser::sqf::parser::source_resolver& sources)
+        {
+            m_sources = &sources;
+        }
+
+        // Same as statements(set, END_OF_FILE, ...) when emitting, but passing each statement on
+        // once its separators got consumed, rather than collecting all of them in a single set.
+        template<typename TFunc>
+        bool top_level(TFunc on_statement)
+        {
+            while (peek().kind != lexeme_kind::end_of_file)
+            {
+                auto& first = peek().token;
+                ::sqf::parser::sqf::parser::statement current{ { first.offset, first.line, first.column, source(first.path) }, {}, {} };
+                auto result = statement(current.instructions);
+                if (!result.has_value())
+                {
+                    return false;
+                }
+                if (!is_separator(peek().kind))
+                {
+                    if (peek().kind != lexeme_kind::end_of_file)
+                    {
+                        fail(peek(), "END_OF_FILE"sv);
+                        return false;
+                    }
+                }
+                while (is_separator(peek().kind))
+                {
+                    take();
+                }
+                auto& next = peek().token;
+                if (next.type != ::sqf::parser::sqf::tokenizer::etoken::eof)
+                {
+                    if (!is_operand_start(peek().kind))
+                    {
+                        fail(peek(), "END_OF_FILE"sv);
+                        return false;
+                    }
+                    current.separator = std::make_shared<::sqf::opcodes::end_statement>();
+                    current.separator->location(location(result->token, result->token.contents.length()));
+                }
+                if (!on_statement(std::move(current), { next.offset, next.line, next.column, source(next.path) }))
+                {
+                    break;
+                }
+            }
+            return true;
+        }
+    };
 }
 
-std::optional<sqf::runtime::instruction_set> sqf::parser::sqf::parser::parse(::sqf::runtime::runtime& runtime, std::string contents, ::sqf::runtime::fileio::pathinfo file)
+std::optional<sqf::runtime::instruction_set> sqf::parser::sqf::parser::parse(const context& context, std::string contents, ::sqf::runtime::fileio::pathinfo file)
 {
-    tokenizer t(contents.begin(), contents.end(), file.physical);
-    ::sqf::parser::sqf::bison::astnode res;
-    ::sqf::parser::sqf::bison::parser p(t, res, *this, runtime);
-    // p.set_debug_level(1);
-    bool success = p.parse() == 0;
-    if (!success)
+    if (context.logger && context.logger != &get_logger())
     {
-        return {};
+        // The parser holds no state besides its logger, thus a temporary one reports to the requested logger.
+        parser local(*context.logger);
+        return local.parse({ context.operators, nullptr }, std::move(contents), std::move(file));
     }
+    // The contents are kept alive by the instructions for creating code segments on demand.
+    auto shared = std::make_shared<const std::string>(std::move(contents));
+    tokenizer t(shared->begin(), shared->end(), file.physical);
+    pratt_parser p(context.operators, t, *this, shared, true);
     std::vector<::sqf::runtime::instruction::sptr> vec;
-    to_assembly(contents, res, vec);
+    if (!p.parse(vec))
+    {
+        return {};
+    }
     return vec;
 }
 
-bool ::sqf::parser::sqf::parser::check_syntax(::sqf::runtime::runtime& runtime, std::string contents, ::sqf::runtime::fileio::pathinfo file)
+bool sqf::parser::sqf::parser::parse_statements(const context& context, std::shared_ptr<const std::string> contents, const position& start,
+    const source_resolver& sources,
+    const std::function<bool(statement&& current, const position& next)>& on_statement)
 {
+    if (context.logger && context.logger != &get_logger())
+    {
+        parser local(*context.logger);
+        return local.parse_statements({ context.operators, nullptr }, std::move(contents), start, sources, on_statement);
+    }
+    tokenizer t(contents->begin(), contents->end(), start.source->path().physical);
+    t.seek(start.offset, start.line, start.column);
+    pratt_parser p(context.operators, t, *this, contents, true);
+    p.sources(sources);
+    return p.top_level(on_statement);
+}
+
+bool ::sqf::parser::sqf::parser::check_syntax(const context& context, std::string contents, ::sqf::runtime::fileio::pathinfo file)
+{
+    if (context.logger && context.logger != &get_logger())
+    {
+        parser local(*context.logger);
+        return local.check_syntax({ context.operators, nullptr }, std::move(contents), std::move(file));
+    }
+    // Nothing refers to the contents once done, thus they are neither copied nor shared.
     tokenizer t(contents.begin(), contents.end(), file.physical);
-    ::sqf::parser::sqf::bison::astnode res;
-    ::sqf::parser::sqf::bison::parser p(t, res, *this, runtime);
-    bool success = p.parse() == 0;
-    return success;
+    pratt_parser p(context.operators, t, *this, {}, false);
+    std::vector<::sqf::runtime::instruction::sptr> vec;
+    return p.parse(vec);
 }
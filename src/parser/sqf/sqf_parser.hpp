@@ -2,6 +2,7 @@
 #include "../../runtime/parser/sqf.h"
 #include "../../runtime/logging.h"
 #include "../../runtime/diagnostics/diag_info.h"
+#include "../../runtime/diagnostics/source_file.h"
 #include "../../runtime/fileio.h"
 #include "../../runtime/util.h"
 #include "../../runtime/instruction_set.h"
@@ -10,19 +11,19 @@
 #include <string>
 #include <string_view>
 #include <vector>
+#include <functional>
+#include <memory>
 
 
 
-namespace sqf::parser::sqf::bison
-{
-    struct astnode;
-}
 namespace sqf::parser::sqf
 {
+    /// <summary>
+    /// Hand-written SQF parser, emitting the instructions directly while parsing
+    /// using precedence climbing over the runtime's operators.
+    /// </summary>
     class parser : public ::sqf::runtime::parser::sqf, public CanLog
     {
-    private:
-        void to_assembly(std::string_view contents, const ::sqf::parser::sqf::bison::astnode& node, std::vector<::sqf::runtime::instruction::sptr>& set);
     public:
         parser(Logger& logger) : CanLog(logger)
         {
@@ -31,9 +32,55 @@ namespace sqf::parser::sqf
         {
             log(msg);
         }
-        bool get_tree(::sqf::runtime::runtime& runtime, tokenizer& t, bison::astnode* out);
+        using ::sqf::runtime::parser::sqf::check_syntax;
+        using ::sqf::runtime::parser::sqf::parse;
         virtual ~parser() override { };
-        virtual bool check_syntax(::sqf::runtime::runtime& runtime, std::string contents, ::sqf::runtime::fileio::pathinfo file) override;
-        virtual std::optional<::sqf::runtime::instruction_set> parse(::sqf::runtime::runtime& runtime, std::string contents, ::sqf::runtime::fileio::pathinfo file) override;
+        virtual bool check_syntax(const context& context, std::string contents, ::sqf::runtime::fileio::pathinfo file) override;
+        virtual std::optional<::sqf::runtime::instruction_set> parse(const context& context, std::string contents, ::sqf::runtime::fileio::pathinfo file) override;
+
+        /// <summary>
+        /// Position of a token, together with the source it is attributed to (which changes with #line).
+        /// </summary>
+        struct position
+        {
+            size_t offset;
+            size_t line;
+            size_t column;
+            std::shared_ptr<const ::sqf::runtime::diagnostics::source_file> source;
+        };
+        /// <summary>
+        /// A single top-level statement, as reported by parse_statements.
+        /// </summary>
+        struct statement
+        {
+            /// <summary>
+            /// Position of the first token of the statement.
+            /// </summary>
+            position start;
+            std::vector<::sqf::runtime::instruction::sptr> instructions;
+            /// <summary>
+            /// The end_statement instruction separating this statement from the next one.
+            /// nullptr for the last statement.
+            /// </summary>
+            ::sqf::runtime::instruction::sptr separator;
+        };
+        /// <summary>
+        /// Resolves the source instructions attributed to the provided path refer to.
+        /// </summary>
+        using source_resolver = std::function<std::shared_ptr<const ::sqf::runtime::diagnostics::source_file>(const std::string& path)>;
+        /// <summary>
+        /// Parses the top-level statements of contents, starting with the statement at start.
+        /// Each statement is passed to on_statement together with the position of the next token,
+        /// which is the end of the contents for the last statement.
+        /// Parsing stops early once on_statement returns false.
+        /// </summary>
+        /// <remarks>
+        /// Concatenating the instructions and separators of all statements yields the result of parse,
+        /// except for sources being taken from sources rather than being created.
+        /// </remarks>
+        /// <returns>false if a syntax error got reported.</returns>
+        bool parse_statements(const context& context, std::shared_ptr<const std::string> contents, const position& start,
+            const source_resolver& sources,
+            const std::function<bool(statement&& current, const position& next)>& on_statement);
     };
 }
@@ -1,5 +1,6 @@
 #pragma once
 #include "../../runtime/util.h"
+#include "../scan.h"
 #include <array>
 #include <string>
 #include <string_view>
@@ -54,17 +55,23 @@ namespace sqf::parser::sqf
             std::string_view contents;
             std::string* path;
         };
-        using iterator = std::string::iterator;
+        using iterator = std::string::const_iterator;
     private:
         std::vector<std::string*> m_strings;
         iterator m_start;
         iterator m_current;
         iterator m_end;
+        // Raw pointers matching m_start and m_end, used for the scan kernels.
+        const char* m_data;
+        const char* m_data_end;
         emode m_mode;
 
         size_t m_line;
         size_t m_column;
 
+        const char* ptr(iterator it) const { return m_data + (it - m_start); }
+        iterator iter(const char* p) const { return m_start + (p - m_data); }
+
         template<typename = void>
         inline bool is_match(char value) { return false; }
         template<char TArg, char ... TArgs>
@@ -97,7 +104,12 @@ namespace sqf::parser::sqf
         {
             auto it = start;
             auto len = ::sqf::runtime::util::strlen(against);
-            for (size_t i = 0; i < len && it < m_end; i++, ++it)
+            if (static_cast<size_t>(m_end - start) < len)
+            {
+                // A prefix at the very end of the input is no match.
+                return 0;
+            }
+            for (size_t i = 0; i < len; i++, ++it)
             {
                 if ((char)std::tolower(*it) != against[i]) { return 0; }
             }
@@ -107,7 +119,12 @@ namespace sqf::parser::sqf
         {
             auto it = start;
             auto len = ::sqf::runtime::util::strlen(against);
-            for (size_t i = 0; i < len && it < m_end; i++, ++it)
+            if (static_cast<size_t>(m_end - start) < len)
+            {
+                // A prefix at the very end of the input is no match.
+                return 0;
+            }
+            for (size_t i = 0; i < len; i++, ++it)
             {
                 if ((char)std::tolower(*it) != against[i]) { return 0; }
             }
@@ -118,6 +135,33 @@ namespace sqf::parser::sqf
             return it - start;
         }
 
+        // Skips the contents of a string up to and including its closing TQuote, updating the position info.
+        // Doubled quotes are part of the string. Unterminated strings end at m_end.
+        template<char TQuote>
+        iterator skip_string(iterator iter)
+        {
+            auto it = ptr(iter);
+            while (true)
+            {
+                auto quote = ::sqf::parser::scan::find_first_of<TQuote>(it, m_data_end);
+                ::sqf::parser::scan::advance(it, quote, m_line, m_column);
+                if (quote == m_data_end)
+                {
+                    m_column++;
+                    return m_end;
+                }
+                m_column++;
+                if (quote + 1 < m_data_end && quote[1] == TQuote)
+                {
+                    it = quote + 2;
+                }
+                else
+                {
+                    return this->iter(quote + 1);
+                }
+            }
+        }
+
         token try_match(std::initializer_list<etoken> tokens)
         {
             token t = create_token();
@@ -163,7 +207,7 @@ namespace sqf::parser::sqf
                     if (is_match_repeated<2, '/'>(iter))
                     {
                         // find line comment end
-                        while (!is_match<'\n'>(++iter));
+                        iter = this->iter(::sqf::parser::scan::find_first_of<'\n'>(ptr(iter + 1), m_data_end));
 
                         // update position info
                         m_line++;
@@ -180,20 +224,15 @@ namespace sqf::parser::sqf
                         ++iter;
                         ++iter;
                         // find block comment end
-                        while (!(is_match<'*'>(iter) && is_match<'/'>(iter + 1)))
+                        auto start = ptr(iter);
+                        auto it = start;
+                        while ((it = ::sqf::parser::scan::find_first_of<'*'>(it, m_data_end)) != m_data_end && !(it + 1 < m_data_end && it[1] == '/'))
                         {
-                            // update position info
-                            if (!is_match<'\n'>(iter))
-                            {
-                                m_column++;
-                            }
-                            else
-                            {
-                                m_line++;
-                                m_column = 0;
-                            }
-                            ++iter;
+                            ++it;
                         }
+                        // update position info
+                        ::sqf::parser::scan::advance(start, it, m_line, m_column);
+                        iter = this->iter(it);
 
                         // EOF check
                         if (is_match<'/'>(iter) && is_match<'/'>(iter + 1))
@@ -206,20 +245,11 @@ namespace sqf::parser::sqf
                     }
                 } break;
                 case etoken::i_whitespace: {
-                    while (is_match<' ', '\n', '\r', '\t'>(iter))
-                    {
-                        // update position info
-                        if (!is_match<'\n'>(iter))
-                        {
-                            m_column++;
-                        }
-                        else
-                        {
-                            m_line++;
-                            m_column = 0;
-                        }
-                        ++iter;
-                    }
+                    auto start = ptr(iter);
+                    auto it = ::sqf::parser::scan::skip_whitespace(start, m_data_end);
+                    // update position info
+                    ::sqf::parser::scan::advance(start, it, m_line, m_column);
+                    iter = this->iter(it);
                     // set length
                     len = iter - m_current;
                 } break;
@@ -264,77 +294,19 @@ namespace sqf::parser::sqf
                 case etoken::t_string_single: {
                     ++iter;
                     m_column++;
-                    // find string end
-                    while (true)
-                    {
-                        if (is_match<'\''>(iter) && is_match<'\''>(iter + 1))
-                        {
-                            ++iter;
-                        }
-                        else if (is_match<'\''>(iter))
-                        {
-                            ++iter;
-                            m_column++;
-                            break;
-                        }
-                        // update position info
-                        if (!is_match<'\n'>(iter))
-                        {
-                            m_column++;
-                        }
-                        else
-                        {
-                            m_line++;
-                            m_column = 0;
-                        }
-                        ++iter;
-                    }
+                    iter = skip_string<'\''>(iter);
                     // set length
                     len = iter - m_current;
                 } break;
                 case etoken::t_string_double: {
                     ++iter;
                     m_column++;
-                    // find string end
-                    while (true)
-                    {
-                        if (is_match<'"'>(iter) && is_match<'"'>(iter + 1))
-                        {
-                            ++iter;
-                        }
-                        else if (is_match<'"'>(iter))
-                        {
-                            ++iter;
-                            m_column++;
-                            break;
-                        }
-                        // update position info
-                        if (!is_match<'\n'>(iter))
-                        {
-                            m_column++;
-                        }
-                        else
-                        {
-                            m_line++;
-                            m_column = 0;
-                        }
-                        if (iter == m_end)
-                        {
-                            break;
-                        }
-                        else
-                        {
-                            iter++;
-                        }
-                    }
+                    iter = skip_string<'"'>(iter);
                     // set length
                     len = iter - m_current;
                 } break;
                 case etoken::t_ident: {
-                    len = len_match<
-                        'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o', 'p', 'q', 'r', 's', 't', 'u', 'v', 'w', 'x', 'y', 'z',
-                        'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P', 'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z',
-                        '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '_'>(iter);
+                    len = ::sqf::parser::scan::skip_identifier(ptr(iter), m_data_end) - ptr(iter);
                 } break;
                 case etoken::t_hexadecimal: {
                     if (*iter == '$')
@@ -413,6 +385,8 @@ namespace sqf::parser::sqf
             m_start(start),
             m_current(start),
             m_end(end),
+            m_data(start == end ? nullptr : &*start),
+            m_data_end(m_data + (end - start)),
             m_line(0),
             m_column(0),
             m_mode(emode::normal)
@@ -426,6 +400,20 @@ namespace sqf::parser::sqf
                 delete ptr;
             }
         }
+        /// <summary>
+        /// Continues tokenizing at the provided offset, which has to be the start of a token.
+        /// Line and column are taken as is, as they depend on everything before the offset.
+        /// </summary>
+        void seek(size_t offset, size_t line, size_t column)
+        {
+            m_current = m_start + offset;
+            m_line = line;
+            m_column = column;
+        }
+        /// <summary>
+        /// The path tokens are currently attributed to.
+        /// </summary>
+        const std::string* path() const { return m_strings.back(); }
         token next()
         {
             if (m_current == m_end) { return create_token(etoken::eof); };
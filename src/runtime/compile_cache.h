@@ -0,0 +1,235 @@
+#pragma once
+#include "instruction_set.h"
+#include "fileio.h"
+
+#include <string>
+#include <cstdint>
+#include <string_view>
+#include <optional>
+#include <list>
+#include <unordered_map>
+#include <functional>
+
+namespace sqf::runtime
+{
+    /// <summary>
+    /// Cache for the results of the preprocessor, the sqf parser and decoded precompiled modules,
+    /// allowing operators like compile or execVM to skip the work for contents already seen.
+    /// Entries are keyed by a 64 bit hash and the length of their contents plus the path
+    /// they were processed with and evicted in least-recently-used order once the capacity is reached.
+    /// </summary>
+    /// <remarks>
+    /// Only successful results are stored, so that errors get reported on every call.
+    /// The contents themselves are not kept, lookups never copy them.
+    /// </remarks>
+    class compile_cache
+    {
+    public:
+        struct statistics
+        {
+            size_t hits;
+            size_t misses;
+            size_t evictions;
+            size_t size;
+            size_t capacity;
+        };
+        /// <summary>
+        /// Identifies a cache entry. Created once per request via key_of and reused
+        /// for storing the result, so the contents only get hashed once.
+        /// </summary>
+        struct key
+        {
+            uint64_t contents_hash;
+            size_t contents_length;
+            std::string path;
+            size_t fingerprint;
+
+            bool operator==(const key& other) const
+            {
+                return contents_hash == other.contents_hash && contents_length == other.contents_length &&
+                    fingerprint == other.fingerprint && path == other.path;
+            }
+        };
+
+        /// <summary>
+        /// Creates the key for the provided contents, hashing them straight from the view.
+        /// </summary>
+        /// <param name="contents">The contents that get processed.</param>
+        /// <param name="pathinfo">The path the contents get processed with.</param>
+        /// <param name="fingerprint">Fingerprint of the preprocessor state, 0 for sqf code.</param>
+        static key key_of(std::string_view contents, const sqf::runtime::fileio::pathinfo& pathinfo, size_t fingerprint = 0)
+        {
+            // FNV-1a over the contents.
+            uint64_t hash = 14695981039346656037ULL;
+            for (auto c : contents)
+            {
+                hash ^= static_cast<uint8_t>(c);
+                hash *= 1099511628211ULL;
+            }
+            return { hash, contents.length(), pathinfo.physical + '\n' + pathinfo.virtual_, fingerprint };
+        }
+        /// <summary>
+        /// Creates the key for a precompiled module file, which changes whenever the file gets replaced.
+        /// </summary>
+        /// <param name="pathinfo">The path of the module file.</param>
+        /// <param name="write_time">The last write time of the module file, 0 if it cannot change (eg. inside of a PBO).</param>
+        /// <param name="size">The size of the module file.</param>
+        static key module_key(const sqf::runtime::fileio::pathinfo& pathinfo, int64_t write_time, size_t size)
+        {
+            return { static_cast<uint64_t>(write_time), size, pathinfo.physical + '\n' + pathinfo.virtual_, 0 };
+        }
+    private:
+        struct key_hash
+        {
+            size_t operator()(const key& k) const
+            {
+                auto hash = static_cast<size_t>(k.contents_hash ^ (k.contents_hash >> 32));
+                hash ^= std::hash<std::string>{}(k.path) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+                hash ^= k.fingerprint + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+                return hash;
+            }
+        };
+        template<typename TValue>
+        class lru
+        {
+            struct node
+            {
+                TValue value;
+                typename std::list<const key*>::iterator order;
+            };
+            // Most recently used key in front. Keys are owned by m_lookup, whose nodes never move.
+            std::list<const key*> m_order;
+            std::unordered_map<key, node, key_hash> m_lookup;
+        public:
+            size_t size() const { return m_lookup.size(); }
+            void clear() { m_lookup.clear(); m_order.clear(); }
+            const TValue* find(const key& k)
+            {
+                auto res = m_lookup.find(k);
+                if (res == m_lookup.end())
+                {
+                    return nullptr;
+                }
+                m_order.splice(m_order.begin(), m_order, res->second.order);
+                return &res->second.value;
+            }
+            void insert(key k, TValue value)
+            {
+                auto res = m_lookup.find(k);
+                if (res != m_lookup.end())
+                {
+                    res->second.value = std::move(value);
+                    m_order.splice(m_order.begin(), m_order, res->second.order);
+                    return;
+                }
+                auto inserted = m_lookup.emplace(std::move(k), node{ std::move(value), {} }).first;
+                m_order.push_front(&inserted->first);
+                inserted->second.order = m_order.begin();
+            }
+            void pop_back()
+            {
+                auto res = m_lookup.find(*m_order.back());
+                m_order.pop_back();
+                m_lookup.erase(res);
+            }
+        };
+
+        lru<sqf::runtime::instruction_set> m_code;
+        lru<std::string> m_preprocessed;
+        lru<sqf::runtime::instruction_set> m_modules;
+        size_t m_capacity;
+        size_t m_hits;
+        size_t m_misses;
+        size_t m_evictions;
+
+        template<typename TValue>
+        std::optional<TValue> lookup(lru<TValue>& cache, const key& k)
+        {
+            auto res = cache.find(k);
+            if (res)
+            {
+                m_hits++;
+                return *res;
+            }
+            m_misses++;
+            return {};
+        }
+        template<typename TValue>
+        void store(lru<TValue>& cache, key k, TValue value)
+        {
+            if (m_capacity == 0)
+            {
+                return;
+            }
+            cache.insert(std::move(k), std::move(value));
+            while (cache.size() > m_capacity)
+            {
+                cache.pop_back();
+                m_evictions++;
+            }
+        }
+    public:
+        compile_cache(size_t capacity) : m_capacity(capacity), m_hits(0), m_misses(0), m_evictions(0) {}
+
+        /// <summary>
+        /// Receives the instruction_set previously stored for the provided sqf contents.
+        /// </summary>
+        /// <param name="k">Key of the sqf contents that got parsed, created via key_of.</param>
+        std::optional<sqf::runtime::instruction_set> code(const key& k)
+        {
+            if (m_capacity == 0) { return {}; }
+            return lookup(m_code, k);
+        }
+        void code(key k, sqf::runtime::instruction_set set)
+        {
+            store(m_code, std::move(k), std::move(set));
+        }
+
+        /// <summary>
+        /// Receives the preprocessor output previously stored for the provided file contents.
+        /// </summary>
+        /// <remarks>
+        /// Files included by the contents are not part of the key and thus expected to not change
+        /// during the lifetime of the runtime.
+        /// </remarks>
+        /// <param name="k">Key of the raw file contents, created via key_of with the fingerprint of the macros known to the preprocessor.</param>
+        std::optional<std::string> preprocessed(const key& k)
+        {
+            if (m_capacity == 0) { return {}; }
+            return lookup(m_preprocessed, k);
+        }
+        void preprocessed(key k, std::string output)
+        {
+            store(m_preprocessed, std::move(k), std::move(output));
+        }
+
+        /// <summary>
+        /// Receives the instruction_set previously decoded from the provided precompiled module.
+        /// </summary>
+        /// <param name="k">Key of the module file, created via module_key.</param>
+        std::optional<sqf::runtime::instruction_set> module(const key& k)
+        {
+            if (m_capacity == 0) { return {}; }
+            return lookup(m_modules, k);
+        }
+        void module(key k, sqf::runtime::instruction_set set)
+        {
+            store(m_modules, std::move(k), std::move(set));
+        }
+
+        /// <summary>
+        /// Sets the maximum number of entries kept per kind of result. 0 disables the cache.
+        /// </summary>
+        void capacity(size_t value)
+        {
+            m_capacity = value;
+            while (m_code.size() > m_capacity) { m_code.pop_back(); m_evictions++; }
+            while (m_preprocessed.size() > m_capacity) { m_preprocessed.pop_back(); m_evictions++; }
+            while (m_modules.size() > m_capacity) { m_modules.pop_back(); m_evictions++; }
+        }
+        size_t capacity() const { return m_capacity; }
+
+        void clear() { m_code.clear(); m_preprocessed.clear(); m_modules.clear(); }
+        statistics stats() const { return { m_hits, m_misses, m_evictions, m_code.size() + m_preprocessed.size() + m_modules.size(), m_capacity }; }
+    };
+}
@@ -0,0 +1,599 @@
+#include "confighost.h"
+#include "d_array.h"
+#include "d_string.h"
+#include "d_scalar.h"
+#include "d_boolean.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_set>
+
+namespace
+{
+    // Image layout (native endianness), all offsets being relative to the start of the section they point into:
+    //   header:     char[8] magic, uint32 version, uint32 containers, uint32 children, uint32 values length, uint32 strings length
+    //   containers: containers * { uint32 name offset, uint32 name length, uint32 parent_logical, uint32 parent_inherited,
+    //                              uint32 value offset, uint32 first child, uint32 children, uint32 reserved }
+    //   children:   children * { uint32 key offset, uint32 key length, uint32 id }
+    //   values:     uint8 tag, payload depending on tag (see value_tag), strings being stored in place
+    //   strings:    names and keys, deduplicated and not terminated
+    // Ids not referring to any container (eg. deleted children) are stored as image_invalid_id.
+    const char image_magic[8] = { 'S', 'Q', 'F', 'V', 'M', 'C', 'F', 'G' };
+    const uint32_t image_version = 1;
+    const uint32_t image_invalid_id = ~((uint32_t)0);
+    // Nesting of arrays accepted when reading, preventing corrupted images from exhausting the stack.
+    const size_t image_max_depth = 512;
+
+    enum class value_tag : uint8_t
+    {
+        nil,
+        scalar,
+        boolean,
+        string,
+        array
+    };
+
+    struct image_header
+    {
+        char magic[8];
+        uint32_t version;
+        uint32_t containers;
+        uint32_t children;
+        uint32_t values_length;
+        uint32_t strings_length;
+    };
+    struct image_container
+    {
+        uint32_t name_offset;
+        uint32_t name_length;
+        uint32_t parent_logical;
+        uint32_t parent_inherited;
+        uint32_t value_offset;
+        uint32_t first_child;
+        uint32_t children;
+        uint32_t reserved;
+    };
+    struct image_child
+    {
+        uint32_t key_offset;
+        uint32_t key_length;
+        uint32_t id;
+    };
+
+    template<typename T>
+    void append_raw(std::string& out, T t) { out.append(reinterpret_cast<const char*>(&t), sizeof(T)); }
+
+    // Images may be located at any address, thus fields are copied out instead of being accessed in place.
+    template<typename T>
+    bool read_raw(std::string_view in, size_t& pos, T& t)
+    {
+        if (pos > in.length() || in.length() - pos < sizeof(T)) { return false; }
+        std::memcpy(&t, in.data() + pos, sizeof(T));
+        pos += sizeof(T);
+        return true;
+    }
+
+    class string_pool
+    {
+        std::string m_data;
+        std::unordered_map<std::string_view, uint32_t> m_offsets;
+    public:
+        // The view has to stay valid until the pool is no longer used.
+        uint32_t add(std::string_view str)
+        {
+            auto res = m_offsets.find(str);
+            if (res != m_offsets.end())
+            {
+                return res->second;
+            }
+            auto offset = static_cast<uint32_t>(m_data.length());
+            m_data.append(str);
+            m_offsets.emplace(str, offset);
+            return offset;
+        }
+        const std::string& data() const { return m_data; }
+    };
+
+    void write_value(std::string& out, const sqf::runtime::value& val)
+    {
+        if (val.is<sqf::runtime::t_scalar>())
+        {
+            append_raw(out, value_tag::scalar);
+            append_raw<float>(out, val.data<sqf::types::d_scalar, float>());
+        }
+        else if (val.is<sqf::runtime::t_boolean>())
+        {
+            append_raw(out, value_tag::boolean);
+            append_raw<uint8_t>(out, val.data<sqf::types::d_boolean, bool>() ? 1 : 0);
+        }
+        else if (val.is<sqf::runtime::t_string>())
+        {
+            auto str = val.data<sqf::types::d_string, std::string>();
+            append_raw(out, value_tag::string);
+            append_raw<uint32_t>(out, static_cast<uint32_t>(str.length()));
+            out.append(str);
+        }
+        else if (val.is<sqf::runtime::t_array>())
+        {
+            auto arr = val.data<sqf::types::d_array>();
+            append_raw(out, value_tag::array);
+            append_raw<uint32_t>(out, static_cast<uint32_t>(arr->size()));
+            for (auto& it : *arr)
+            {
+                write_value(out, it);
+            }
+        }
+        else
+        {
+            append_raw(out, value_tag::nil);
+        }
+    }
+    bool read_value(std::string_view in, size_t& pos, sqf::runtime::value& val, size_t depth)
+    {
+        value_tag tag;
+        if (depth > image_max_depth || !read_raw(in, pos, tag)) { return false; }
+        switch (tag)
+        {
+        case value_tag::nil:
+            val = {};
+            return true;
+        case value_tag::scalar:
+        {
+            float f;
+            if (!read_raw(in, pos, f)) { return false; }
+            val = f;
+            return true;
+        }
+        case value_tag::boolean:
+        {
+            uint8_t flag;
+            if (!read_raw(in, pos, flag)) { return false; }
+            val = flag != 0;
+            return true;
+        }
+        case value_tag::string:
+        {
+            uint32_t length;
+            if (!read_raw(in, pos, length) || in.length() - pos < length) { return false; }
+            val = std::string(in.substr(pos, length));
+            pos += length;
+            return true;
+        }
+        case value_tag::array:
+        {
+            uint32_t size;
+            if (!read_raw(in, pos, size)) { return false; }
+            // Each element takes at least one byte, rejecting sizes that cannot be satisfied before allocating.
+            if (in.length() - pos < size) { return false; }
+            std::vector<sqf::runtime::value> arr;
+            arr.reserve(size);
+            for (uint32_t i = 0; i < size; i++)
+            {
+                if (!read_value(in, pos, arr.emplace_back(), depth + 1)) { return false; }
+            }
+            val = arr;
+            return true;
+        }
+        default:
+            return false;
+        }
+    }
+}
+
+namespace
+{
+    struct symbol_table
+    {
+        std::shared_mutex mutex;
+        // Deque, as its elements never move and thus views into them stay valid.
+        std::deque<std::string> names;
+        std::unordered_map<std::string_view, sqf::runtime::configsymbols::symbol> symbols;
+    };
+    // Never destroyed, as containers of static runtimes may still refer to it on exit.
+    symbol_table& get_symbol_table()
+    {
+        static auto table = new symbol_table();
+        return *table;
+    }
+}
+
+sqf::runtime::configsymbols::symbol sqf::runtime::configsymbols::intern(std::string_view name)
+{
+    auto& table = get_symbol_table();
+    {
+        std::shared_lock lock(table.mutex);
+        auto res = table.symbols.find(name);
+        if (res != table.symbols.end())
+        {
+            return res->second;
+        }
+    }
+    std::unique_lock lock(table.mutex);
+    auto res = table.symbols.find(name);
+    if (res != table.symbols.end())
+    {
+        return res->second;
+    }
+    auto sym = static_cast<symbol>(table.names.size());
+    auto& stored = table.names.emplace_back(name);
+    table.symbols.emplace(stored, sym);
+    return sym;
+}
+
+sqf::runtime::configsymbols::symbol sqf::runtime::configsymbols::find(std::string_view name)
+{
+    auto& table = get_symbol_table();
+    std::shared_lock lock(table.mutex);
+    auto res = table.symbols.find(name);
+    return res == table.symbols.end() ? invalid_symbol : res->second;
+}
+
+std::string_view sqf::runtime::configsymbols::name(symbol sym)
+{
+    auto& table = get_symbol_table();
+    std::shared_lock lock(table.mutex);
+    return sym < table.names.size() ? std::string_view(table.names[sym]) : std::string_view{};
+}
+
+std::string sqf::runtime::confighost::write_image() const
+{
+    auto& containers = *m_containers;
+    std::vector<image_container> container_records;
+    std::vector<image_child> child_records;
+    std::string values;
+    string_pool strings;
+    container_records.reserve(containers.size());
+
+    auto to_image_id = [](size_t id) { return id == config::invalid_id ? image_invalid_id : static_cast<uint32_t>(id); };
+    for (auto& container : containers)
+    {
+        auto& record = container_records.emplace_back();
+        record.name_offset = strings.add(container.name);
+        record.name_length = static_cast<uint32_t>(container.name.length());
+        record.parent_logical = to_image_id(container.id_parent_logical);
+        record.parent_inherited = to_image_id(container.id_parent_inherited);
+        record.value_offset = static_cast<uint32_t>(values.length());
+        record.first_child = static_cast<uint32_t>(child_records.size());
+        record.children = static_cast<uint32_t>(container.size());
+        record.reserved = 0;
+        write_value(values, container.value);
+
+        for (auto& child : container)
+        {
+            auto key = child.name();
+            child_records.push_back({ strings.add(key), static_cast<uint32_t>(key.length()), to_image_id(child.id) });
+        }
+    }
+
+    image_header header;
+    std::memcpy(header.magic, image_magic, sizeof(image_magic));
+    header.version = image_version;
+    header.containers = static_cast<uint32_t>(container_records.size());
+    header.children = static_cast<uint32_t>(child_records.size());
+    header.values_length = static_cast<uint32_t>(values.length());
+    header.strings_length = static_cast<uint32_t>(strings.data().length());
+
+    std::string image;
+    image.reserve(sizeof(header) +
+        container_records.size() * sizeof(image_container) +
+        child_records.size() * sizeof(image_child) +
+        values.length() +
+        strings.data().length());
+    image.append(reinterpret_cast<const char*>(&header), sizeof(header));
+    image.append(reinterpret_cast<const char*>(container_records.data()), container_records.size() * sizeof(image_container));
+    image.append(reinterpret_cast<const char*>(child_records.data()), child_records.size() * sizeof(image_child));
+    image.append(values);
+    image.append(strings.data());
+    return image;
+}
+
+std::optional<sqf::runtime::confighost> sqf::runtime::confighost::read_image(std::string_view image)
+{
+    try
+    {
+        size_t pos = 0;
+        image_header header;
+        if (!read_raw(image, pos, header) || std::memcmp(header.magic, image_magic, sizeof(image_magic)) != 0 || header.version != image_version)
+        {
+            return {};
+        }
+        // Sections are validated up front, so that records only need to be checked against their section.
+        uint64_t expected = sizeof(header) +
+            uint64_t(header.containers) * sizeof(image_container) +
+            uint64_t(header.children) * sizeof(image_child) +
+            header.values_length +
+            header.strings_length;
+        if (header.containers == 0 || expected != image.length())
+        {
+            return {};
+        }
+        auto containers_offset = sizeof(header);
+        auto children_offset = containers_offset + size_t(header.containers) * sizeof(image_container);
+        auto values = image.substr(children_offset + size_t(header.children) * sizeof(image_child), header.values_length);
+        auto strings = image.substr(image.length() - header.strings_length);
+
+        auto is_valid_id = [&](uint32_t id) { return id == image_invalid_id || id < header.containers; };
+        auto from_image_id = [](uint32_t id) { return id == image_invalid_id ? config::invalid_id : size_t(id); };
+        auto get_string = [&](uint32_t offset, uint32_t length, std::string_view& out) {
+            if (offset > strings.length() || strings.length() - offset < length) { return false; }
+            out = strings.substr(offset, length);
+            return true;
+        };
+
+        std::vector<config::container> containers;
+        containers.reserve(header.containers);
+        for (uint32_t i = 0; i < header.containers; i++)
+        {
+            image_container record;
+            std::string_view name;
+            if (!read_raw(image, containers_offset, record) ||
+                !get_string(record.name_offset, record.name_length, name) ||
+                !is_valid_id(record.parent_logical) ||
+                !is_valid_id(record.parent_inherited) ||
+                record.first_child > header.children ||
+                header.children - record.first_child < record.children)
+            {
+                return {};
+            }
+            auto& container = containers.emplace_back(i, std::string(name));
+            container.id_parent_logical = from_image_id(record.parent_logical);
+            container.id_parent_inherited = from_image_id(record.parent_inherited);
+            size_t value_pos = record.value_offset;
+            if (!read_value(values, value_pos, container.value, 0))
+            {
+                return {};
+            }
+            auto child_pos = children_offset + size_t(record.first_child) * sizeof(image_child);
+            for (uint32_t j = 0; j < record.children; j++)
+            {
+                image_child child;
+                std::string_view key;
+                if (!read_raw(image, child_pos, child) || !get_string(child.key_offset, child.key_length, key) || !is_valid_id(child.id))
+                {
+                    return {};
+                }
+                container.push_back(key, from_image_id(child.id));
+            }
+        }
+        return confighost(std::move(containers));
+    }
+    catch (const std::exception&)
+    {
+        // Allocation failures caused by corrupted images.
+        return {};
+    }
+}
+
+struct sqf::runtime::confighost::ancestry
+{
+    static constexpr uint32_t none = ~((uint32_t)0);
+    // Position of each container in a depth-first walk of the inheritance forest, when entered and once left.
+    // A container inherits from another if it got entered while the other one was not left yet.
+    // Containers not reachable from any root (inheriting in a cycle) are never entered.
+    std::vector<uint32_t> enter;
+    std::vector<uint32_t> leave;
+    // Nearest container inherited from, having the same name.
+    std::vector<uint32_t> same_name_parent;
+    // Containers of each name, ordered by enter.
+    std::unordered_map<sqf::runtime::configsymbols::symbol, std::vector<uint32_t>> by_name;
+};
+
+const sqf::runtime::confighost::ancestry& sqf::runtime::confighost::ancestry_index() const
+{
+    if (m_ancestry)
+    {
+        return *m_ancestry;
+    }
+    auto& containers = *m_containers;
+    auto size = static_cast<uint32_t>(containers.size());
+    auto index = std::make_shared<ancestry>();
+    index->enter.resize(size, ancestry::none);
+    index->leave.resize(size, ancestry::none);
+    index->same_name_parent.resize(size, ancestry::none);
+
+    // Containers inheriting from each container, as linked lists in id order.
+    std::vector<uint32_t> first_child(size, ancestry::none);
+    std::vector<uint32_t> next_sibling(size, ancestry::none);
+    for (auto id = size; id-- > 0;)
+    {
+        auto parent = containers[id].id_parent_inherited;
+        if (parent < size && parent != id)
+        {
+            next_sibling[id] = first_child[parent];
+            first_child[parent] = id;
+        }
+    }
+
+    // Iterative, as inheritance chains may be deeper than the stack allows to recurse.
+    uint32_t counter = 0;
+    std::vector<uint32_t> stack;
+    std::unordered_map<configsymbols::symbol, uint32_t> deepest;
+    auto enter = [&](uint32_t id) {
+        auto symbol = containers[id].symbol;
+        auto res = deepest.find(symbol);
+        index->same_name_parent[id] = res == deepest.end() ? ancestry::none : res->second;
+        deepest[symbol] = id;
+        index->enter[id] = counter++;
+        index->by_name[symbol].push_back(id);
+        stack.push_back(id);
+    };
+    for (uint32_t root = 0; root < size; root++)
+    {
+        auto parent = containers[root].id_parent_inherited;
+        if (parent < size && parent != root)
+        {
+            continue;
+        }
+        enter(root);
+        while (!stack.empty())
+        {
+            auto id = stack.back();
+            // first_child doubles as cursor, as each list is walked exactly once.
+            auto child = first_child[id];
+            if (child != ancestry::none)
+            {
+                first_child[id] = next_sibling[child];
+                enter(child);
+                continue;
+            }
+            stack.pop_back();
+            index->leave[id] = counter;
+            auto symbol = containers[id].symbol;
+            if (index->same_name_parent[id] == ancestry::none)
+            {
+                deepest.erase(symbol);
+            }
+            else
+            {
+                deepest[symbol] = index->same_name_parent[id];
+            }
+        }
+    }
+    m_ancestry = std::move(index);
+    return *m_ancestry;
+}
+
+bool sqf::runtime::confighost::inherits_from(size_t id, configsymbols::symbol key) const
+{
+    auto& containers = *m_containers;
+    if (id >= containers.size())
+    {
+        return false;
+    }
+    auto& index = ancestry_index();
+    auto position = index.enter[id];
+    if (position == ancestry::none)
+    {
+        // Inheriting in a cycle, thus walked up to the point it repeats.
+        for (size_t steps = 0; id != config::invalid_id && id < containers.size() && steps <= containers.size(); steps++)
+        {
+            if (containers[id].symbol == key)
+            {
+                return true;
+            }
+            id = containers[id].id_parent_inherited;
+        }
+        return false;
+    }
+    auto res = index.by_name.find(key);
+    if (res == index.by_name.end())
+    {
+        return false;
+    }
+    // The last container of that name entered up to the container checked is either one of its ancestors
+    // or inherited by the same ancestors of that name the container checked inherits from (if any).
+    auto& candidates = res->second;
+    auto it = std::upper_bound(candidates.begin(), candidates.end(), position,
+        [&index](uint32_t position, uint32_t candidate) { return position < index.enter[candidate]; });
+    if (it == candidates.begin())
+    {
+        return false;
+    }
+    for (auto candidate = *(it - 1); candidate != ancestry::none; candidate = index.same_name_parent[candidate])
+    {
+        if (position < index.leave[candidate])
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+struct sqf::runtime::confighost::resolution
+{
+    // Entries kept at most per map, as scripts may look up arbitrary many names.
+    static constexpr size_t capacity = 1 << 20;
+    // Container (upper 32 bits) and symbol looked up (lower 32 bits), mapped to the child found.
+    std::unordered_map<uint64_t, size_t> inherited;
+    // Container (shifted left by one) and whether inherited children are included (lowest bit), mapped to the children.
+    std::unordered_map<size_t, std::shared_ptr<const std::vector<config>>> members;
+};
+
+sqf::runtime::confighost::resolution& sqf::runtime::confighost::resolution_cache() const
+{
+    if (!m_resolution)
+    {
+        m_resolution = std::make_shared<resolution>();
+    }
+    return *m_resolution;
+}
+
+size_t sqf::runtime::confighost::resolve_inherited(size_t id, configsymbols::symbol key) const
+{
+    auto& cache = resolution_cache();
+    auto cache_key = [key](size_t id) { return (static_cast<uint64_t>(id) << 32) | key; };
+    auto& containers = *m_containers;
+    std::vector<size_t> walked;
+    size_t found = config::invalid_id;
+    for (auto index = id; index != config::invalid_id;)
+    {
+        auto res = cache.inherited.find(cache_key(index));
+        if (res != cache.inherited.end())
+        {
+            found = res->second;
+            break;
+        }
+        auto& container = containers.at(index);
+        walked.push_back(index);
+        auto child = container.find(key);
+        if (child)
+        {
+            found = child->id;
+            break;
+        }
+        index = container.id_parent_inherited;
+    }
+
+    // Every container walked resolves to the same child, sparing the walk for lookups on its ancestors.
+    if (cache.inherited.size() + walked.size() > resolution::capacity)
+    {
+        cache.inherited.clear();
+    }
+    for (auto index : walked)
+    {
+        cache.inherited.emplace(cache_key(index), found);
+    }
+    return found;
+}
+
+std::shared_ptr<const std::vector<sqf::runtime::config>> sqf::runtime::confighost::members(size_t id, bool inherited) const
+{
+    auto& cache = resolution_cache();
+    auto cache_key = (id << 1) | (inherited ? 1 : 0);
+    auto res = cache.members.find(cache_key);
+    if (res != cache.members.end())
+    {
+        return res->second;
+    }
+
+    auto& containers = *m_containers;
+    auto list = std::make_shared<std::vector<config>>();
+    std::unordered_set<configsymbols::symbol> seen;
+    // Bounded, as containers may inherit in a cycle.
+    for (size_t index = id, steps = 0; index < containers.size() && steps < containers.size(); index = containers[index].id_parent_inherited, steps++)
+    {
+        for (auto& child : containers[index])
+        {
+            // Deleted children hide the inherited ones of the same name as well.
+            if ((!inherited || seen.insert(child.key).second) && child.id != config::invalid_id)
+            {
+                list->push_back(config(containers.at(child.id)));
+            }
+        }
+        if (!inherited)
+        {
+            break;
+        }
+    }
+
+    if (cache.members.size() >= resolution::capacity)
+    {
+        cache.members.clear();
+    }
+    cache.members.emplace(cache_key, list);
+    return list;
+}
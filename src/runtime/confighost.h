@@ -1,6 +1,8 @@
 #pragma once
 #include "value.h"
 
+#include <algorithm>
+#include <cstdint>
 #include <vector>
 #include <string>
 #include <string_view>
@@ -13,6 +15,38 @@ namespace sqf::runtime
     class confighost;
     class confignav;
 
+    /// <summary>
+    /// Process-wide table of the names used by configs (classes and properties).
+    /// Each distinct name is stored once and identified by its symbol, allowing containers
+    /// to compare names by number and to refer to them without owning a copy.
+    /// </summary>
+    /// <remarks>
+    /// Names are never removed, thus views returned stay valid until the process exits.
+    /// Names are case-sensitive. Safe to be used from multiple threads at once.
+    /// </remarks>
+    class configsymbols
+    {
+    public:
+        using symbol = uint32_t;
+        static const symbol invalid_symbol = ~((symbol)0);
+
+        /// <summary>
+        /// Returns the symbol of the provided name, adding it to the table if missing.
+        /// </summary>
+        static symbol intern(std::string_view name);
+
+        /// <summary>
+        /// Returns the symbol of the provided name without adding it.
+        /// </summary>
+        /// <returns>The symbol or invalid_symbol if no config uses the name.</returns>
+        static symbol find(std::string_view name);
+
+        /// <summary>
+        /// Returns the name of the provided symbol.
+        /// </summary>
+        static std::string_view name(symbol sym);
+    };
+
     class config
     {
         friend class confighost;
@@ -21,60 +55,99 @@ namespace sqf::runtime
         static const size_t invalid_id = ~((size_t)0);
         struct container
         {
+            struct child
+            {
+                configsymbols::symbol key;
+                // invalid_id for deleted children.
+                size_t id;
+                std::string_view name() const { return configsymbols::name(key); }
+            };
+            using const_iterator = std::vector<child>::const_iterator;
         private:
-            std::vector<size_t> m_children_vec;
-            std::unordered_map<std::string, size_t> m_children;
+            // Children in definition order.
+            std::vector<child> m_children;
+            // Indices into m_children, sorted by key.
+            std::vector<uint32_t> m_sorted;
+
+            std::vector<uint32_t>::const_iterator lower_bound(configsymbols::symbol key) const
+            {
+                return std::lower_bound(m_sorted.begin(), m_sorted.end(), key,
+                    [this](uint32_t index, configsymbols::symbol key) { return m_children[index].key < key; });
+            }
         public:
-            using iterator = std::unordered_map<std::string, size_t>::iterator;
             sqf::runtime::value value;
             size_t id;
             size_t id_parent_logical;
             size_t id_parent_inherited;
-            std::string name;
+            configsymbols::symbol symbol;
+            /// <summary>
+            /// The name of this container, referring into the configsymbols table.
+            /// </summary>
+            std::string_view name;
 
-            container(size_t id, std::string name) noexcept : m_children_vec(), m_children(), id(id), id_parent_logical(invalid_id), id_parent_inherited(invalid_id), name(name) {}
-            container() noexcept : m_children_vec(), m_children(), id(invalid_id), id_parent_logical(invalid_id), id_parent_inherited(invalid_id), name({}) {}
+            container(size_t id, std::string_view name) : container()
+            {
+                this->id = id;
+                symbol = configsymbols::intern(name);
+                this->name = configsymbols::name(symbol);
+            }
+            container() noexcept : m_children(), m_sorted(), id(invalid_id), id_parent_logical(invalid_id), id_parent_inherited(invalid_id), symbol(configsymbols::invalid_symbol), name() {}
             container(const container& copy) = delete;
-            container(container&& move) noexcept :
-                m_children_vec(std::move(move.m_children_vec)),
-                m_children(std::move(move.m_children)),
-                value(std::move(move.value)),
-                id(move.id),
-                id_parent_logical(move.id_parent_logical),
-                id_parent_inherited(move.id_parent_inherited),
-                name(std::move(move.name)) {}
-
-            size_t size() const { return m_children_vec.size(); }
-            size_t operator[] (std::string index) { return m_children[index]; }
-            size_t operator[] (std::string index) const { return m_children.at(index); }
-            size_t operator[] (size_t index) { return m_children_vec[index]; }
-            size_t operator[] (size_t index) const { return m_children_vec[index]; }
-            iterator begin() noexcept { return m_children.begin(); }
-            iterator end() noexcept { return m_children.end(); }
-            iterator find(std::string index) { return m_children.find(index); }
-            void push_back(std::string key, size_t target_id)
+            container(container&& move) noexcept = default;
+
+            /// <summary>
+            /// Creates a member-wise copy of this container.
+            /// Copying is explicit to prevent accidental copies of whole config trees.
+            /// </summary>
+            container clone() const
             {
-                auto res = m_children.find(key);
-                if (res == m_children.end())
-                {
-                    m_children_vec.push_back(target_id);
-                }
-                else if (res->second == target_id)
+                container copy;
+                copy.m_children = m_children;
+                copy.m_sorted = m_sorted;
+                copy.value = value;
+                copy.id = id;
+                copy.id_parent_logical = id_parent_logical;
+                copy.id_parent_inherited = id_parent_inherited;
+                copy.symbol = symbol;
+                copy.name = name;
+                return copy;
+            }
+
+            size_t size() const { return m_children.size(); }
+            size_t operator[] (size_t index) const { return m_children[index].id; }
+            const_iterator begin() const noexcept { return m_children.begin(); }
+            const_iterator end() const noexcept { return m_children.end(); }
+
+            /// <summary>
+            /// Finds a child by its key.
+            /// </summary>
+            /// <returns>The child (with an id of invalid_id if deleted) or nullptr if there is no such child.</returns>
+            const child* find(configsymbols::symbol key) const
+            {
+                auto res = lower_bound(key);
+                return res != m_sorted.end() && m_children[*res].key == key ? &m_children[*res] : nullptr;
+            }
+            const child* find(std::string_view key) const
+            {
+                auto sym = configsymbols::find(key);
+                return sym == configsymbols::invalid_symbol ? nullptr : find(sym);
+            }
+
+            /// <summary>
+            /// Adds a child or replaces the id of an existing child with the same key, keeping its position.
+            /// </summary>
+            void push_back(configsymbols::symbol key, size_t target_id)
+            {
+                auto res = lower_bound(key);
+                if (res != m_sorted.end() && m_children[*res].key == key)
                 {
+                    m_children[*res].id = target_id;
                     return;
                 }
-                else
-                {
-                    for (auto& it : m_children_vec)
-                    {
-                        if (it == res->second)
-                        {
-                            it = target_id;
-                        }
-                    }
-                }
-                m_children[key] = target_id;
+                m_sorted.insert(res, static_cast<uint32_t>(m_children.size()));
+                m_children.push_back({ key, target_id });
             }
+            void push_back(std::string_view key, size_t target_id) { push_back(configsymbols::intern(key), target_id); }
         };
 
     private:
@@ -107,15 +180,128 @@ namespace sqf::runtime
     public:
         using config_iterator = std::vector<config>::iterator;
     private:
-        std::vector<config::container> m_containers;
+        // Inheritance ancestry of all containers, see inherits_from.
+        struct ancestry;
+        // Memoized lookups, see resolve_inherited and members.
+        struct resolution;
+
+        std::shared_ptr<std::vector<config::container>> m_containers;
+        // Built on first use and dropped once the containers get modified.
+        // Shared with forked confighosts, as long as neither got modified.
+        mutable std::shared_ptr<const ancestry> m_ancestry;
+        // Built on first use and dropped once the containers get modified.
+        // Never shared with forked confighosts, as it keeps growing while being queried.
+        mutable std::shared_ptr<resolution> m_resolution;
+
+        confighost(std::shared_ptr<std::vector<config::container>> containers, std::shared_ptr<const ancestry> ancestry = {}) :
+            m_containers(std::move(containers)), m_ancestry(std::move(ancestry)) {}
 
+        const ancestry& ancestry_index() const;
+        resolution& resolution_cache() const;
+
+        /// <summary>
+        /// Returns the containers for modification.
+        /// If the containers are shared with a forked confighost,
+        /// they get copied first (copy-on-write).
+        /// </summary>
+        std::vector<config::container>& containers_mutable()
+        {
+            if (m_ancestry)
+            {
+                m_ancestry.reset();
+            }
+            if (m_resolution)
+            {
+                m_resolution.reset();
+            }
+            if (m_containers.use_count() > 1)
+            {
+                auto copy = std::make_shared<std::vector<config::container>>();
+                copy->reserve(m_containers->size());
+                for (auto& it : *m_containers)
+                {
+                    copy->push_back(it.clone());
+                }
+                m_containers = copy;
+            }
+            return *m_containers;
+        }
     public:
         confignav root();
         confighost(const confighost& copy) = delete;
-        confighost()
+        confighost(confighost&& move) noexcept = default;
+        confighost& operator=(confighost&& move) noexcept = default;
+        confighost() : m_containers(std::make_shared<std::vector<config::container>>())
         {
-            m_containers.emplace_back(0, "config/bin");
+            m_containers->emplace_back(0, "config/bin");
         }
+        /// <summary>
+        /// Creates a confighost from a previously exported set of containers.
+        /// The first container is expected to be the root.
+        /// </summary>
+        confighost(std::vector<config::container> containers) : m_containers(std::make_shared<std::vector<config::container>>(std::move(containers))) {}
+
+        /// <summary>
+        /// Raw access to all containers, indexed by their id.
+        /// </summary>
+        const std::vector<config::container>& containers() const { return *m_containers; }
+
+        /// <summary>
+        /// Creates a new confighost sharing the config tree with this one.
+        /// The tree is copied lazily, once either of the two gets modified.
+        /// </summary>
+        confighost fork() const { return confighost(m_containers, m_ancestry); }
+
+        /// <summary>
+        /// Checks whether the provided container or any of the containers it inherits from has the provided name.
+        /// </summary>
+        /// <remarks>
+        /// Answered using an index over the inheritance of all containers, taking a binary search
+        /// over the containers sharing the name. The index gets built on first use after each modification,
+        /// thus a confighost must not be queried from multiple threads at once.
+        /// </remarks>
+        /// <param name="id">The id of the container to check.</param>
+        /// <param name="key">The symbol of the name to look for.</param>
+        bool inherits_from(size_t id, configsymbols::symbol key) const;
+
+        /// <summary>
+        /// Looks up the child with the provided name in the provided container or the containers it inherits from.
+        /// </summary>
+        /// <remarks>
+        /// Results are memoized for every container walked, until the containers get modified.
+        /// Thus, like inherits_from, a confighost must not be queried from multiple threads at once.
+        /// </remarks>
+        /// <param name="id">The id of the container to start at.</param>
+        /// <param name="key">The symbol of the name to look for.</param>
+        /// <returns>The id of the child found or config::invalid_id if there is none (or it got deleted).</returns>
+        size_t resolve_inherited(size_t id, configsymbols::symbol key) const;
+
+        /// <summary>
+        /// Lists the children of the provided container in definition order, skipping deleted ones.
+        /// If inherited is set, children of the containers inherited from follow, unless overridden or deleted before.
+        /// </summary>
+        /// <remarks>
+        /// Memoized like resolve_inherited. The list returned stays valid after the containers got modified,
+        /// it just is not updated anymore.
+        /// </remarks>
+        /// <param name="id">The id of the container to list the children of.</param>
+        /// <param name="inherited">Whether to include the children of the containers inherited from.</param>
+        std::shared_ptr<const std::vector<config>> members(size_t id, bool inherited) const;
+
+        /// <summary>
+        /// Writes all containers into a flat image, which can be loaded again using read_image.
+        /// Names, values and child tables are referred to by offsets relative to the start of the image,
+        /// allowing to read it from any address (eg. a memory mapped file).
+        /// Values other than nil, SCALAR, BOOL, STRING or ARRAY are written as nil.
+        /// </summary>
+        std::string write_image() const;
+
+        /// <summary>
+        /// Creates a confighost from an image created using write_image.
+        /// </summary>
+        /// <param name="image">The image. Not referred to once this returns.</param>
+        /// <returns>The confighost or an empty optional if the image is malformed.</returns>
+        static std::optional<confighost> read_image(std::string_view image);
     };
     class confignav
     {
@@ -150,7 +336,7 @@ namespace sqf::runtime
             {
                 while (m_id != config::invalid_id)
                 {
-                    auto& container = m_confighost.m_containers[m_id];
+                    auto& container = m_confighost.containers()[m_id];
                     if (container.size() != m_index)
                     {
                         m_index++;
@@ -176,9 +362,9 @@ namespace sqf::runtime
             bool operator!=(iterator_base<recursive> other) const { return !(*this == other); }
             value_type operator*()
             {
-                auto& container = m_confighost.m_containers[m_id];
+                auto& container = m_confighost.containers()[m_id];
                 auto actual_index = container[m_index];
-                return m_confighost.m_containers[actual_index];
+                return m_confighost.containers()[actual_index];
             }
         };
         using iterator = iterator_base<false>;
@@ -201,7 +387,7 @@ namespace sqf::runtime
         {
             if (!empty())
             {
-                return &*(m_confighost.m_containers.begin() + m_index);
+                return &*(m_confighost.containers().begin() + m_index);
             }
             return {};
         }
@@ -209,18 +395,18 @@ namespace sqf::runtime
         {
             if (!empty())
             {
-                return { m_confighost.m_containers.at(m_index) };
+                return { m_confighost.containers().at(m_index) };
             }
             return {};
         }
         operator config() const { return **this; }
-        confignav operator/(std::string target) const { return lookup_in_inherited(target); }
+        confignav operator/(std::string_view target) const { return lookup_in_inherited(target); }
         confignav operator/(size_t index) const { return at(index); }
         confignav at(size_t index) const
         {
             if (!empty())
             {
-                auto& container = m_confighost.m_containers.at(index);
+                auto& container = m_confighost.containers().at(index);
                 if (index < container.size())
                 {
                     return { m_confighost, container[index] };
@@ -228,36 +414,28 @@ namespace sqf::runtime
             }
             return { m_confighost, config::invalid_id };
         }
-        confignav lookup_in_inherited(std::string target) const
+        confignav lookup_in_inherited(std::string_view target) const
         {
-            size_t index = m_index;
-            while (index != config::invalid_id)
+            // Names unknown to the symbol table cannot be part of any config.
+            auto key = configsymbols::find(target);
+            if (empty() || key == configsymbols::invalid_symbol)
             {
-                auto& container = m_confighost.m_containers.at(index);
-
-                auto res = container.find(target);
-                if (res != container.end())
-                {
-                    return { m_confighost, res->second };
-                }
-                else
-                {
-                    index = container.id_parent_inherited;
-                }
+                return { m_confighost, config::invalid_id };
             }
-            return { m_confighost, config::invalid_id };
+            return { m_confighost, m_confighost.resolve_inherited(m_index, key) };
         }
-        confignav lookup_in_logical(std::string target) const
+        confignav lookup_in_logical(std::string_view target) const
         {
-            size_t index = m_index;
+            auto key = configsymbols::find(target);
+            size_t index = key == configsymbols::invalid_symbol ? config::invalid_id : m_index;
             while (index != config::invalid_id)
             {
-                auto& container = m_confighost.m_containers.at(index);
+                auto& container = m_confighost.containers().at(index);
 
-                auto res = container.find(target);
-                if (res != container.end())
+                auto res = container.find(key);
+                if (res)
                 {
-                    return { m_confighost, res->second };
+                    return { m_confighost, res->id };
                 }
                 else
                 {
@@ -266,16 +444,17 @@ namespace sqf::runtime
             }
             return { m_confighost, config::invalid_id };
         }
-        confignav append_or_replace(std::string target, std::string inherited = {}) const
+        confignav append_or_replace(std::string_view target, std::string_view inherited = {}) const
         {
             if (!empty())
             {
-                auto& container = m_confighost.m_containers.at(m_index);
-                auto find_res = container.find(target);
+                auto key = configsymbols::intern(target);
+                auto find_res = m_confighost.containers_mutable().at(m_index).find(key);
 
-                if (find_res == container.end())
+                // Children deleted before get recreated at the position they got deleted at.
+                if (!find_res || find_res->id == config::invalid_id)
                 {
-                    auto& created = m_confighost.m_containers.emplace_back(m_confighost.m_containers.size(), target);
+                    auto& created = m_confighost.containers_mutable().emplace_back(m_confighost.containers_mutable().size(), target);
                     // container might be invalidated here due to m_containers resizing.
                     created.id_parent_logical = m_index;
 
@@ -284,12 +463,14 @@ namespace sqf::runtime
                         auto nav = lookup_in_logical(inherited);
                         created.id_parent_inherited = nav.m_index;
                     }
-                    m_confighost.m_containers.at(m_index).push_back(target, created.id);
-                    return { m_confighost, created.id };
+                    auto created_id = created.id;
+                    m_confighost.containers_mutable().at(m_index).push_back(key, created_id);
+                    return { m_confighost, created_id };
                 }
                 else
                 {
-                    auto& replaced = m_confighost.m_containers[find_res->second];
+                    auto replaced_id = find_res->id;
+                    auto& replaced = m_confighost.containers_mutable()[replaced_id];
                     replaced.id_parent_logical = m_index;
 
                     if (!inherited.empty())
@@ -297,46 +478,33 @@ namespace sqf::runtime
                         auto nav = lookup_in_logical(inherited);
                         replaced.id_parent_inherited = nav.m_index;
                     }
-                    container.push_back(target, replaced.id);
-                    return { m_confighost, replaced.id };
+                    return { m_confighost, replaced_id };
                 }
             }
             return { m_confighost, config::invalid_id };
         }
-        void delete_inherited_or_replace(std::string target) const
+        void delete_inherited_or_replace(std::string_view target) const
         {
             if (!empty())
             {
-                auto& container = m_confighost.m_containers.at(m_index);
+                auto& container = m_confighost.containers_mutable().at(m_index);
                 container.push_back(target, config::invalid_id);
             }
         }
-        bool has_inherited_with_name(std::string target) const
+        bool has_inherited_with_name(std::string_view target) const
         {
-            size_t index = m_index;
-            while (index != config::invalid_id)
-            {
-                auto& container = m_confighost.m_containers.at(index);
-
-                if (container.name == target)
-                {
-                    return true;
-                }
-                else
-                {
-                    index = container.id_parent_inherited;
-                }
-            }
-            return false;
+            auto key = configsymbols::find(target);
+            return !empty() && key != configsymbols::invalid_symbol && m_confighost.inherits_from(m_index, key);
         }
-        bool has_logical_with_name(std::string target) const
+        bool has_logical_with_name(std::string_view target) const
         {
-            size_t index = m_index;
+            auto key = configsymbols::find(target);
+            size_t index = key == configsymbols::invalid_symbol ? config::invalid_id : m_index;
             while (index != config::invalid_id)
             {
-                auto& container = m_confighost.m_containers.at(index);
+                auto& container = m_confighost.containers().at(index);
 
-                if (container.name == target)
+                if (container.symbol == key)
                 {
                     return true;
                 }
@@ -353,7 +521,7 @@ namespace sqf::runtime
             if (!empty())
             {
                 size_t index = m_index;
-                auto& container = m_confighost.m_containers.at(index);
+                auto& container = m_confighost.containers().at(index);
                 return { m_confighost, container.id_parent_inherited };
             }
             return { m_confighost, config::invalid_id };
@@ -363,7 +531,7 @@ namespace sqf::runtime
             if (!empty())
             {
                 size_t index = m_index;
-                auto& container = m_confighost.m_containers.at(index);
+                auto& container = m_confighost.containers().at(index);
                 return { m_confighost, container.id_parent_logical };
             }
             return { m_confighost, config::invalid_id };
@@ -373,11 +541,23 @@ namespace sqf::runtime
             if (!empty())
             {
                 size_t index = m_index;
-                auto& container = m_confighost.m_containers.at(index);
+                auto& container = m_confighost.containers_mutable().at(index);
                 container.value = val;
             }
         }
 
+        /// <summary>
+        /// See confighost::members. Empty if this is empty.
+        /// </summary>
+        std::shared_ptr<const std::vector<config>> members(bool inherited) const
+        {
+            if (empty())
+            {
+                return std::make_shared<const std::vector<config>>();
+            }
+            return m_confighost.members(m_index, inherited);
+        }
+
         iterator begin() const { return { m_confighost, m_index }; }
         iterator end() const { return { m_confighost, config::invalid_id }; }
 
@@ -0,0 +1,113 @@
+#pragma once
+#include "diag_info.h"
+#include "../fileio.h"
+
+#include <string>
+#include <string_view>
+#include <memory>
+#include <cstdint>
+#include <algorithm>
+
+namespace sqf::runtime::diagnostics
+{
+    /// <summary>
+    /// Creates a two-line excerpt of the provided contents, marking the range starting at off
+    /// with length characters using '^' on the second line.
+    /// </summary>
+    inline std::string create_code_segment(std::string_view view, size_t off, size_t length)
+    {
+        size_t i = off < 15 ? 0 : off - 15;
+        size_t len = 30 + length;
+        for (size_t j = i; j < i + len && j < view.length(); j++)
+        {
+            char wc = view[j];
+            if (wc == '\n')
+            {
+                if (j < off)
+                {
+                    i = j + 1;
+                }
+                else
+                {
+                    len = j - i;
+                    break;
+                }
+            }
+        }
+
+        std::string spacing(off - i, ' ');
+        std::string postfix(std::max<size_t>(1, length), '^');
+        std::string txt;
+        txt.reserve(len + 1 + spacing.length() + postfix.length() + 1);
+        txt.append(view.substr(std::min(i, view.length()), len));
+        txt.append("\n");
+        txt.append(spacing);
+        txt.append(postfix);
+        txt.append("\n");
+        return txt;
+    }
+
+    /// <summary>
+    /// A file instructions got created from.
+    /// Shared by all instructions of that file, so that each instruction only has to
+    /// keep its position while paths and code segments exist once per file.
+    /// </summary>
+    class source_file
+    {
+        sqf::runtime::fileio::pathinfo m_path;
+        // The (preprocessed) contents positions refer to. Shared, as a single parse may produce multiple
+        // source_files for the same contents (eg. due to #line directives).
+        std::shared_ptr<const std::string> m_contents;
+    public:
+        source_file(sqf::runtime::fileio::pathinfo path, std::shared_ptr<const std::string> contents) :
+            m_path(std::move(path)),
+            m_contents(std::move(contents))
+        {
+        }
+        const sqf::runtime::fileio::pathinfo& path() const { return m_path; }
+        std::string_view contents() const { return m_contents ? std::string_view(*m_contents) : std::string_view{}; }
+        const std::shared_ptr<const std::string>& contents_shared() const { return m_contents; }
+        std::string code_segment(size_t offset, size_t length) const { return create_code_segment(contents(), offset, length); }
+    };
+
+    /// <summary>
+    /// Compact position of an instruction inside of a source_file.
+    /// Expanded into a full diag_info only when needed (eg. for log messages).
+    /// </summary>
+    struct source_location
+    {
+        std::shared_ptr<const source_file> source;
+        uint32_t line;
+        uint32_t column;
+        uint32_t offset;
+        uint32_t length;
+
+        source_location() : source(), line(0), column(0), offset(0), length(0) {}
+        source_location(std::shared_ptr<const source_file> source, size_t line, size_t column, size_t offset, size_t length) :
+            source(std::move(source)),
+            line(static_cast<uint32_t>(line)),
+            column(static_cast<uint32_t>(column)),
+            offset(static_cast<uint32_t>(offset)),
+            length(static_cast<uint32_t>(length))
+        {
+        }
+
+        bool operator==(const source_location& b) const
+        {
+            return line == b.line && column == b.column && offset == b.offset &&
+                (source == b.source || physical() == b.physical());
+        }
+        bool operator!=(const source_location& b) const { return !(*this == b); }
+
+        std::string_view physical() const { return source ? std::string_view(source->path().physical) : std::string_view{}; }
+
+        diag_info expand() const
+        {
+            if (!source)
+            {
+                return { line, column, offset, {}, {} };
+            }
+            return { line, column, offset, source->path(), source->code_segment(offset, length) };
+        }
+    };
+}
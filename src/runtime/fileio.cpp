@@ -1,19 +1,37 @@
 #include "fileio.h"
+#include "util.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <vector>
 #include <filesystem>
+#include <thread>
+#include <unordered_map>
+
+#if defined(_WIN32) || defined(_WIN64)
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 #ifdef DF__SQF_FILEIO__TRACE_REESOLVE
 #include <iostream>
 #endif // DF__SQF_FILEIO__TRACE_REESOLVE
 
-static int get_bom_skip(const std::vector<char>& buff)
+static int get_bom_skip(const char* data, size_t size)
 {
-    if (buff.empty())
+    if (size == 0)
         return 0;
-    // We are comparing against unsigned
-    auto ubuff = reinterpret_cast<const unsigned char*>(buff.data());
+    // We are comparing against unsigned, padding short files with zeros
+    unsigned char ubuff[4] = { 0, 0, 0, 0 };
+    std::memcpy(ubuff, data, std::min<size_t>(size, 4));
     if (ubuff[0] == 0xEF && ubuff[1] == 0xBB && ubuff[2] == 0xBF)
     {
         //UTF-8
@@ -85,12 +103,96 @@ static bool file_exists(std::string_view filename)
 #endif // DF__SQF_FILEIO__TRACE_REESOLVE
     return infile.good();
 }
-std::optional<std::string> sqf::runtime::fileio::read_file_from_disk(std::string_view physical_path)
+sqf::runtime::fileio::file_handle::~file_handle()
+{
+    if (m_mapping)
+    {
+#if defined(_WIN32) || defined(_WIN64)
+        UnmapViewOfFile(m_mapping);
+        CloseHandle(m_mapping_handle);
+#else
+        munmap(const_cast<void*>(m_mapping), m_mapping_size);
+#endif
+    }
+}
+sqf::runtime::fileio::file_handle::file_handle(std::shared_ptr<const void> owner, std::string_view contents) : file_handle()
+{
+    m_owner = std::move(owner);
+    m_contents = contents.substr(get_bom_skip(contents.data(), contents.length()));
+}
+std::shared_ptr<const sqf::runtime::fileio::file_handle> sqf::runtime::fileio::file_handle::map(std::string_view physical_path, bool skip_bom)
+{
+    std::string path(physical_path);
+    std::shared_ptr<file_handle> handle(new file_handle());
+#if defined(_WIN32) || defined(_WIN64)
+    auto file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return {};
+    }
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+    {
+        CloseHandle(file);
+        return {};
+    }
+    // The mapping keeps the file open on its own.
+    auto mapping_handle = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (!mapping_handle)
+    {
+        return {};
+    }
+    auto mapping = MapViewOfFile(mapping_handle, FILE_MAP_READ, 0, 0, 0);
+    if (!mapping)
+    {
+        CloseHandle(mapping_handle);
+        return {};
+    }
+    handle->m_mapping_handle = mapping_handle;
+    handle->m_mapping_size = static_cast<size_t>(size.QuadPart);
+#else
+    auto fd = open(path.c_str(), O_RDONLY);
+    if (fd == -1)
+    {
+        return {};
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0 || !S_ISREG(info.st_mode) || info.st_size == 0)
+    {
+        close(fd);
+        return {};
+    }
+    // The mapping keeps the file open on its own.
+    auto mapping = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED)
+    {
+        return {};
+    }
+    handle->m_mapping_size = static_cast<size_t>(info.st_size);
+#endif
+    handle->m_mapping = mapping;
+    auto data = static_cast<const char*>(mapping);
+    handle->m_contents = std::string_view(data, handle->m_mapping_size).substr(skip_bom ? get_bom_skip(data, handle->m_mapping_size) : 0);
+    return handle;
+}
+std::shared_ptr<const sqf::runtime::fileio::file_handle> sqf::runtime::fileio::open_file_from_disk(std::string_view physical_path)
 {
     if (!file_exists(physical_path))
     {
         return {};
     }
+    std::error_code ec;
+    auto size = std::filesystem::file_size(physical_path, ec);
+    if (!ec && size >= file_handle::mapping_threshold)
+    {
+        if (auto handle = file_handle::map(physical_path))
+        {
+            return handle;
+        }
+    }
+
     std::ifstream file(physical_path.data(), std::ios::ate | std::ios::binary);
 
     if (!file.is_open())
@@ -99,47 +201,301 @@ std::optional<std::string> sqf::runtime::fileio::read_file_from_disk(std::string
     }
 
     auto fileSize = static_cast<size_t>(file.tellg());
-    std::vector<char> buffer(fileSize);
+    std::string buffer(fileSize, '\0');
 
     file.seekg(0);
     file.read(buffer.data(), fileSize);
 
     file.close();
 
-    return std::string(buffer.begin() + get_bom_skip(buffer), buffer.end());
+    auto skip = get_bom_skip(buffer.data(), buffer.size());
+    return std::make_shared<const file_handle>(std::move(buffer), skip);
+}
+std::optional<std::string> sqf::runtime::fileio::read_file_from_disk(std::string_view physical_path)
+{
+    auto handle = open_file_from_disk(physical_path);
+    if (!handle)
+    {
+        return {};
+    }
+    return std::string(handle->contents());
+}
+
+namespace
+{
+    // A directory as seen by a scan. Subdirectories are listed by name.
+    struct scanned_directory
+    {
+        std::filesystem::file_time_type mtime;
+        std::vector<std::string> subdirectories;
+        bool has_prefix = false;
+        std::filesystem::file_time_type prefix_mtime;
+        std::string prefix;
+    };
+    using scan_manifest = std::unordered_map<std::string, scanned_directory>;
+
+    // Manifest layout (native endianness):
+    //   char[8] magic, uint32 version, uint32 directory count, directories
+    //   directory: string path, int64 mtime, uint32 subdirectory count, string[] subdirectories,
+    //              uint8 has prefix, int64 prefix mtime, string prefix
+    //   string: uint32 length, char[length]
+    const char manifest_magic[8] = { 'S', 'Q', 'F', 'V', 'M', 'P', 'F', 'X' };
+    const uint32_t manifest_version = 1;
+
+    template<typename T>
+    void write_raw(std::ostream& out, T t) { out.write(reinterpret_cast<const char*>(&t), sizeof(T)); }
+    template<typename T>
+    bool read_raw(std::istream& in, T& t) { in.read(reinterpret_cast<char*>(&t), sizeof(T)); return in.good(); }
+    void write_string(std::ostream& out, std::string_view str)
+    {
+        write_raw<uint32_t>(out, static_cast<uint32_t>(str.length()));
+        out.write(str.data(), str.length());
+    }
+    bool read_string(std::istream& in, std::string& str)
+    {
+        uint32_t length;
+        if (!read_raw(in, length)) { return false; }
+        str.resize(length);
+        in.read(str.data(), length);
+        return in.good();
+    }
+    void write_time(std::ostream& out, std::filesystem::file_time_type time) { write_raw<int64_t>(out, static_cast<int64_t>(time.time_since_epoch().count())); }
+    bool read_time(std::istream& in, std::filesystem::file_time_type& time)
+    {
+        int64_t count;
+        if (!read_raw(in, count)) { return false; }
+        time = std::filesystem::file_time_type(std::filesystem::file_time_type::duration(count));
+        return true;
+    }
+
+    // Missing or malformed manifests yield an empty one, causing a full scan.
+    scan_manifest read_manifest(const std::filesystem::path& path)
+    {
+        std::ifstream in(path, std::ios_base::binary);
+        char magic[sizeof(manifest_magic)];
+        uint32_t version, count;
+        in.read(magic, sizeof(magic));
+        if (!in.good() || std::memcmp(magic, manifest_magic, sizeof(magic)) != 0 ||
+            !read_raw(in, version) || version != manifest_version || !read_raw(in, count))
+        {
+            return {};
+        }
+        scan_manifest manifest;
+        for (uint32_t i = 0; i < count; i++)
+        {
+            std::string dir_path;
+            scanned_directory dir;
+            uint32_t subdirectories;
+            uint8_t has_prefix;
+            if (!read_string(in, dir_path) || !read_time(in, dir.mtime) || !read_raw(in, subdirectories))
+            {
+                return {};
+            }
+            dir.subdirectories.resize(subdirectories);
+            for (auto& subdirectory : dir.subdirectories)
+            {
+                if (!read_string(in, subdirectory)) { return {}; }
+            }
+            if (!read_raw(in, has_prefix) || !read_time(in, dir.prefix_mtime) || !read_string(in, dir.prefix))
+            {
+                return {};
+            }
+            dir.has_prefix = has_prefix != 0;
+            manifest.emplace(std::move(dir_path), std::move(dir));
+        }
+        return manifest;
+    }
+    // Written to a temporary file first, so that concurrent runs never observe partial manifests.
+    void write_manifest(const std::filesystem::path& path, const scan_manifest& manifest)
+    {
+        std::error_code err;
+        auto tmp = path;
+        tmp += ".tmp";
+        {
+            std::ofstream out(tmp, std::ios_base::binary | std::ios_base::trunc);
+            if (!out.good())
+            {
+                return;
+            }
+            out.write(manifest_magic, sizeof(manifest_magic));
+            write_raw<uint32_t>(out, manifest_version);
+            write_raw<uint32_t>(out, static_cast<uint32_t>(manifest.size()));
+            for (auto& [dir_path, dir] : manifest)
+            {
+                write_string(out, dir_path);
+                write_time(out, dir.mtime);
+                write_raw<uint32_t>(out, static_cast<uint32_t>(dir.subdirectories.size()));
+                for (auto& subdirectory : dir.subdirectories)
+                {
+                    write_string(out, subdirectory);
+                }
+                write_raw<uint8_t>(out, dir.has_prefix ? 1 : 0);
+                write_time(out, dir.prefix_mtime);
+                write_string(out, dir.prefix);
+            }
+            if (!out.good())
+            {
+                out.close();
+                std::filesystem::remove(tmp, err);
+                return;
+            }
+        }
+        std::filesystem::rename(tmp, path, err);
+        if (err)
+        {
+            std::filesystem::remove(tmp, err);
+        }
+    }
+
+    bool read_prefix(const std::filesystem::path& path, scanned_directory& dir)
+    {
+        std::error_code err;
+        dir.prefix_mtime = std::filesystem::last_write_time(path, err);
+        std::ifstream prefixFile(path);
+        if (err || !prefixFile.good())
+        {
+            return false;
+        }
+        std::string prefix;
+        std::getline(prefixFile, prefix);
+        dir.prefix = std::string(sqf::runtime::util::trim(prefix, " \t\r"));
+        return true;
+    }
+
+    // Lists the directory unless its modification time matches the one of the previous scan,
+    // as it only changes when entries get added, removed or renamed. $PBOPREFIX$ is checked
+    // separately, as editing it does not touch the directory.
+    std::optional<scanned_directory> scan_directory(const std::filesystem::path& path, const scanned_directory* previous)
+    {
+        const std::filesystem::path ignoreGit(".git");
+        const std::filesystem::path ignoreSvn(".svn");
+        const std::filesystem::path ignoreVisualStudioCode(".vscode");
+        const std::filesystem::path prefixFileName("$PBOPREFIX$");
+
+        std::error_code err;
+        scanned_directory dir;
+        dir.mtime = std::filesystem::last_write_time(path, err);
+        if (err)
+        {
+            return {};
+        }
+        if (previous && previous->mtime == dir.mtime)
+        {
+            dir.subdirectories = previous->subdirectories;
+            if (previous->has_prefix)
+            {
+                auto prefix_mtime = std::filesystem::last_write_time(path / prefixFileName, err);
+                if (!err && prefix_mtime == previous->prefix_mtime)
+                {
+                    dir.has_prefix = true;
+                    dir.prefix_mtime = previous->prefix_mtime;
+                    dir.prefix = previous->prefix;
+                }
+                else
+                {
+                    dir.has_prefix = read_prefix(path / prefixFileName, dir);
+                }
+            }
+            return dir;
+        }
+
+        auto options = std::filesystem::directory_options::follow_directory_symlink | std::filesystem::directory_options::skip_permission_denied;
+        for (std::filesystem::directory_iterator it(path, options, err), end; !err && it != end; it.increment(err))
+        {
+            auto filename = it->path().filename();
+            std::error_code type_err;
+            if (it->is_directory(type_err))
+            {
+                if (filename != ignoreGit && filename != ignoreSvn && filename != ignoreVisualStudioCode)
+                {
+                    dir.subdirectories.push_back(filename.string());
+                }
+            }
+            else if (filename == prefixFileName && it->is_regular_file(type_err))
+            {
+                dir.has_prefix = read_prefix(it->path(), dir);
+            }
+        }
+        std::sort(dir.subdirectories.begin(), dir.subdirectories.end());
+        return dir;
+    }
 }
 
-void sqf::runtime::fileio::add_mapping_auto(std::string_view phys)
+std::vector<sqf::runtime::fileio::prefix_mapping> sqf::runtime::fileio::find_prefixes(std::string_view phys, size_t jobs, const std::filesystem::path& manifest_path)
 {
-    const std::filesystem::path ignoreGit(".git");
-    const std::filesystem::path ignoreSvn(".svn");
-    const std::filesystem::path ignoreVisualStudioCode(".vscode");
-
-    // Recursively search for pboprefix
-    for (
-        auto i = std::filesystem::recursive_directory_iterator(
-                    phys, std::filesystem::directory_options::follow_directory_symlink);
-        i != std::filesystem::recursive_directory_iterator();
-        ++i
-        )
-    {
-        if (i->is_directory() && (i->path().filename() == ignoreGit || i->path().filename() == ignoreSvn || i->path().filename() == ignoreVisualStudioCode))
+    auto previous = manifest_path.empty() ? scan_manifest{} : read_manifest(manifest_path);
+    scan_manifest current;
+    std::vector<prefix_mapping> mappings;
+
+    // Walked level by level, with the directories of a level being scanned in parallel.
+    std::vector<std::filesystem::path> level{ std::filesystem::path(phys) };
+    while (!level.empty())
+    {
+        std::vector<std::optional<scanned_directory>> scanned(level.size());
+        auto scan = [&](size_t i) {
+            auto res = previous.find(level[i].string());
+            scanned[i] = scan_directory(level[i], res == previous.end() ? nullptr : &res->second);
+        };
+        auto threads_count = std::min(jobs, level.size());
+        if (threads_count <= 1)
         {
-            i.disable_recursion_pending(); // Don't recurse into that directory
-            continue;
+            for (size_t i = 0; i < level.size(); i++)
+            {
+                scan(i);
+            }
         }
-        if (!i->is_regular_file())
+        else
         {
-            continue;
+            std::atomic<size_t> next = 0;
+            std::vector<std::thread> threads;
+            threads.reserve(threads_count);
+            for (size_t j = 0; j < threads_count; j++)
+            {
+                threads.emplace_back([&]() {
+                    for (auto i = next++; i < level.size(); i = next++)
+                    {
+                        scan(i);
+                    }
+                });
+            }
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
         }
 
-        if (i->path().filename() == "$PBOPREFIX$")
+        std::vector<std::filesystem::path> next_level;
+        for (size_t i = 0; i < level.size(); i++)
         {
-            std::ifstream prefixFile(i->path());
-            std::string prefix;
-            std::getline(prefixFile, prefix);
-            prefixFile.close();
-            add_mapping(prefix, i->path().parent_path().string());
+            if (!scanned[i].has_value())
+            {
+                continue;
+            }
+            for (auto& subdirectory : scanned[i]->subdirectories)
+            {
+                next_level.push_back(level[i] / subdirectory);
+            }
+            if (scanned[i]->has_prefix)
+            {
+                mappings.push_back({ level[i].string(), scanned[i]->prefix });
+            }
+            current.emplace(level[i].string(), std::move(*scanned[i]));
         }
+        level = std::move(next_level);
+    }
+
+    if (!manifest_path.empty())
+    {
+        write_manifest(manifest_path, current);
     }
-}
\ No newline at end of file
+    std::sort(mappings.begin(), mappings.end(), [](const prefix_mapping& l, const prefix_mapping& r) { return l.physical < r.physical; });
+    return mappings;
+}
+
+void sqf::runtime::fileio::add_mapping_auto(std::string_view phys, size_t jobs, const std::filesystem::path& manifest)
+{
+    for (auto& mapping : find_prefixes(phys, jobs, manifest))
+    {
+        add_mapping(mapping.physical, mapping.prefix);
+    }
+}
@@ -1,10 +1,14 @@
 #pragma once
+#include <algorithm>
 #include <string>
 #include <string_view>
 #include <optional>
 #include <filesystem>
+#include <memory>
 #include <vector>
 
+class Logger;
+
 namespace sqf
 {
     namespace runtime
@@ -41,9 +45,81 @@ namespace sqf
                 bool operator==(const pathinfo& b) const { return physical == physical; }
                 bool operator!=(const pathinfo& b) const { return physical != physical; }
             };
+            /// <summary>
+            /// Read-only contents of a file, either mapped into memory or held in a string.
+            /// The contents stay valid for as long as the handle exists.
+            /// </summary>
+            /// <remarks>
+            /// Mapped files are not copied when read. Modifying a mapped file on disk
+            /// while a handle to it exists thus changes its contents (or makes them unreadable when truncated).
+            /// </remarks>
+            class file_handle
+            {
+                std::string m_buffer;
+                std::shared_ptr<const void> m_owner;
+                const void* m_mapping;
+                size_t m_mapping_size;
+#if defined(_WIN32) || defined(_WIN64)
+                void* m_mapping_handle;
+#endif
+                std::string_view m_contents;
+
+                file_handle() : m_mapping(nullptr), m_mapping_size(0)
+#if defined(_WIN32) || defined(_WIN64)
+                    , m_mapping_handle(nullptr)
+#endif
+                {}
+            public:
+                /// <summary>
+                /// Files smaller than this are read into a string, as mapping them costs more than copying.
+                /// </summary>
+                static constexpr size_t mapping_threshold = 64 * 1024;
+
+                /// <summary>
+                /// Creates a handle holding the provided contents, starting at offset.
+                /// </summary>
+                file_handle(std::string contents, size_t offset = 0) : file_handle()
+                {
+                    m_buffer = std::move(contents);
+                    m_contents = std::string_view(m_buffer).substr(std::min(offset, m_buffer.length()));
+                }
+                /// <summary>
+                /// Creates a handle referring to contents kept alive by owner (eg. a slice of another handle),
+                /// excluding any byte order mark.
+                /// </summary>
+                file_handle(std::shared_ptr<const void> owner, std::string_view contents);
+                file_handle(const file_handle&) = delete;
+                file_handle& operator=(const file_handle&) = delete;
+                ~file_handle();
+
+                /// <summary>
+                /// Maps the provided file into memory.
+                /// </summary>
+                /// <param name="physical_path">The physical path of the file</param>
+                /// <param name="skip_bom">Whether a byte order mark is excluded from the contents. Disable for binary files.</param>
+                /// <returns>The handle or nullptr if the file could not be mapped.</returns>
+                static std::shared_ptr<const file_handle> map(std::string_view physical_path, bool skip_bom = true);
+
+                /// <summary>
+                /// The contents of the file, excluding any byte order mark.
+                /// </summary>
+                std::string_view contents() const { return m_contents; }
+                /// <summary>
+                /// Whether the contents are mapped into memory rather than copied.
+                /// </summary>
+                bool mapped() const { return m_mapping != nullptr; }
+            };
         public:
             virtual ~fileio() {}
             /// <summary>
+            /// Convenience method to open a file from disk without copying its contents where possible.
+            /// Will not use the filesystem to resolve the path but rather
+            /// directly load the file from disk, mapping it into memory if it is large enough.
+            /// </summary>
+            /// <param name="physical_path">The physical path of the file</param>
+            /// <returns>The file handle or nullptr if file does not exist or could not be opened for any other reason.</returns>
+            static std::shared_ptr<const file_handle> open_file_from_disk(std::string_view physical_path);
+            /// <summary>
             /// Convenience method to read a file from disk.
             /// Will not use the filesystem to resolve the path but rather
             /// directly load the file from disk using std::fstream.
@@ -68,6 +144,18 @@ namespace sqf
             /// <returns>Optional that is filled when the path resolution was successful</returns>
             virtual std::optional<sqf::runtime::fileio::pathinfo> get_info(std::string_view view, sqf::runtime::fileio::pathinfo current) const = 0;
 
+            /// <summary>
+            /// Method to receive path informations of a new path, reporting all diagnostics
+            /// to the provided logger instead of the one of the implementation.
+            /// The default implementation ignores the logger.
+            /// </summary>
+            /// <param name="view">The new path requested.</param>
+            /// <param name="current">Current pathinfo or empty '{}'.</param>
+            /// <param name="logger">The logger to report diagnostics to.</param>
+            /// <returns>Optional that is filled when the path resolution was successful</returns>
+            virtual std::optional<sqf::runtime::fileio::pathinfo> get_info(std::string_view view, sqf::runtime::fileio::pathinfo current, Logger& logger) const
+            { return get_info(view, std::move(current)); }
+
             /// <summary>
             /// Maps a physical path onto a virtual one.
             /// </summary>
@@ -82,17 +170,50 @@ namespace sqf
             /// <returns>The contents of the file.</returns>
             virtual std::string read_file(sqf::runtime::fileio::pathinfo info) const = 0;
 
+            /// <summary>
+            /// Opens the file for reading, allowing its contents to be used without copying them.
+            /// The default implementation holds the result of `read_file`.
+            /// </summary>
+            /// <param name="info">The pathinfo leading to the file. Can be aquired using `get`.</param>
+            /// <returns>The file handle. Never nullptr.</returns>
+            virtual std::shared_ptr<const file_handle> open_file(sqf::runtime::fileio::pathinfo info) const
+            { return std::make_shared<const file_handle>(read_file(std::move(info))); }
+
             /// <summary>
             /// Returns all directories currently mapped onto some path.
             /// </summary>
             /// <returns></returns>
             virtual std::vector<std::string> get_directories() const = 0;
 
+            /// <summary>
+            /// A directory containing a $PBOPREFIX$ file and the prefix read from it.
+            /// </summary>
+            struct prefix_mapping
+            {
+                std::string physical;
+                std::string prefix;
+            };
+
+            /// <summary>
+            /// Recursively scans directory for $PBOPREFIX$ files, listing the directories of each level using up to jobs threads.
+            /// Directories named .git, .svn or .vscode are skipped.
+            /// </summary>
+            /// <param name="physical">Physical path to search inside.</param>
+            /// <param name="jobs">Amount of threads to use.</param>
+            /// <param name="manifest">
+            /// Optional file to persist the scan to, including the modification time of every directory visited.
+            /// Directories whose modification time did not change since are not listed again on later scans.
+            /// </param>
+            /// <returns>The directories found, ordered by their physical path.</returns>
+            static std::vector<prefix_mapping> find_prefixes(std::string_view physical, size_t jobs = 1, const std::filesystem::path& manifest = {});
+
             /// <summary>
             /// Recursively scans directory for $PBOPREFIX$ files and adds mappings for them.
             /// </summary>
             /// <param name="physical">Physical path to search inside.</param>
-            void add_mapping_auto(std::string_view physical);
+            /// <param name="jobs">Amount of threads to use.</param>
+            /// <param name="manifest">Optional file to persist the scan to. See find_prefixes.</param>
+            void add_mapping_auto(std::string_view physical, size_t jobs = 1, const std::filesystem::path& manifest = {});
         };
     }
     namespace fileio
@@ -114,6 +235,7 @@ namespace sqf
             virtual std::optional<sqf::runtime::fileio::pathinfo> get_info(std::string_view view, sqf::runtime::fileio::pathinfo current) const override { return { { view, ""} }; }
             virtual void add_mapping(std::string_view physical, std::string_view virtual_) override { }
             virtual std::string read_file(sqf::runtime::fileio::pathinfo info) const override { auto opt = fileio::read_file_from_disk(info.physical); return opt.has_value() ? opt.value() : std::string{}; }
+            virtual std::shared_ptr<const file_handle> open_file(sqf::runtime::fileio::pathinfo info) const override { auto handle = fileio::open_file_from_disk(info.physical); return handle ? handle : std::make_shared<const file_handle>(std::string{}); }
             virtual std::vector<std::string> get_directories() const override { return {}; }
         };
     }
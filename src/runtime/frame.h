@@ -176,6 +176,29 @@ namespace sqf::runtime
             return result::ok;
         }
 
+        sqf::runtime::diagnostics::source_location location_from_position() const
+        {
+            if (m_position == position_invalid)
+            {
+                return (*m_instruction_set.begin())->location();
+            }
+            else if (m_position == m_instruction_set.size())
+            {
+                return m_instruction_set.size() == 0 ? sqf::runtime::diagnostics::source_location{} : (*m_instruction_set.rbegin())->location();
+            }
+            else
+            {
+                return (*current())->location();
+            }
+        }
+        /// <summary>
+        /// Returns the path of the current instruction, without creating the full diag_info.
+        /// </summary>
+        sqf::runtime::fileio::pathinfo path_from_position() const
+        {
+            auto location = location_from_position();
+            return location.source ? location.source->path() : sqf::runtime::fileio::pathinfo{};
+        }
         sqf::runtime::diagnostics::diag_info diag_info_from_position() const
         {
             if (m_position == position_invalid)
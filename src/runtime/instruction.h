@@ -1,5 +1,6 @@
 #pragma once
 #include "diagnostics/diag_info.h"
+#include "diagnostics/source_file.h"
 
 #include <string>
 #include <memory>
@@ -14,7 +15,7 @@ namespace sqf::runtime
     public:
         using sptr = std::shared_ptr<sqf::runtime::instruction>;
     private:
-        sqf::runtime::diagnostics::diag_info m_diag_info;
+        sqf::runtime::diagnostics::source_location m_location;
     public:
         virtual ~instruction() {};
         virtual void execute(runtime& runtime) const = 0;
@@ -25,7 +26,12 @@ namespace sqf::runtime
             short parent_precedence, bool left_from_binary) const = 0;
         virtual bool equals(const instruction* p_other) const = 0;
 
-        sqf::runtime::diagnostics::diag_info diag_info() const { return m_diag_info; }
-        void diag_info(sqf::runtime::diagnostics::diag_info dinf) { m_diag_info = dinf; }
+        /// <summary>
+        /// Creates the full diagnostic info of this instruction, including the code segment.
+        /// Prefer location() where only the position is required.
+        /// </summary>
+        sqf::runtime::diagnostics::diag_info diag_info() const { return m_location.expand(); }
+        const sqf::runtime::diagnostics::source_location& location() const { return m_location; }
+        void location(sqf::runtime::diagnostics::source_location location) { m_location = std::move(location); }
     };
 }
\ No newline at end of file
@@ -2,12 +2,14 @@
 #include "instruction.h"
 
 #include <vector>
+#include <memory>
 #include <initializer_list>
 
 namespace sqf::runtime
 {
     /// <summary>
     /// A way to represent a "immutable" instruction set.
+    /// Copies share the underlying instructions, making them cheap to pass around.
     /// </summary>
     class instruction_set final
     {
@@ -15,17 +17,25 @@ namespace sqf::runtime
         using iterator = std::vector<sqf::runtime::instruction::sptr>::const_iterator;
         using reverse_iterator = std::vector<sqf::runtime::instruction::sptr>::const_reverse_iterator;
     private:
-        std::vector<sqf::runtime::instruction::sptr> m_instructions;
+        std::shared_ptr<const std::vector<sqf::runtime::instruction::sptr>> m_instructions;
+
+        const std::vector<sqf::runtime::instruction::sptr>& instructions() const
+        {
+            static const std::vector<sqf::runtime::instruction::sptr> empty_instructions;
+            return m_instructions ? *m_instructions : empty_instructions;
+        }
     public:
         instruction_set() {}
-        instruction_set(std::initializer_list<sqf::runtime::instruction::sptr> initializer) : m_instructions(initializer.begin(), initializer.end()) {}
-        instruction_set(std::vector<sqf::runtime::instruction::sptr> instructions) : m_instructions(std::move(instructions)) {}
+        instruction_set(std::initializer_list<sqf::runtime::instruction::sptr> initializer) :
+            m_instructions(std::make_shared<const std::vector<sqf::runtime::instruction::sptr>>(initializer.begin(), initializer.end())) {}
+        instruction_set(std::vector<sqf::runtime::instruction::sptr> instructions) :
+            m_instructions(std::make_shared<const std::vector<sqf::runtime::instruction::sptr>>(std::move(instructions))) {}
 
-        iterator begin() const { return m_instructions.begin(); }
-        iterator end() const { return m_instructions.end(); }
-        reverse_iterator rbegin() const { return m_instructions.rbegin(); }
-        reverse_iterator rend() const { return m_instructions.rend(); }
-        bool empty() const { return m_instructions.empty(); }
-        size_t size() const { return m_instructions.size(); }
+        iterator begin() const { return instructions().begin(); }
+        iterator end() const { return instructions().end(); }
+        reverse_iterator rbegin() const { return instructions().rbegin(); }
+        reverse_iterator rend() const { return instructions().rend(); }
+        bool empty() const { return instructions().empty(); }
+        size_t size() const { return instructions().size(); }
     };
 }
\ No newline at end of file
@@ -11,6 +11,20 @@ void StdOutLogger::log(const LogMessageBase& message) {
 }
 #pragma endregion StdOutLogger
 
+#pragma region BufferedLogger
+void BufferedLogger::log(const LogMessageBase& message) {
+    m_messages.emplace_back(message.getLevel(), message.getErrorCode(), message.formatMessage());
+}
+void BufferedLogger::flush(Logger& target) {
+    for (auto& message : m_messages) {
+        if (target.isEnabled(message.getLevel())) {
+            target.log(message);
+        }
+    }
+    m_messages.clear();
+}
+#pragma endregion BufferedLogger
+
 #pragma region LogLocationInfo
 LogLocationInfo::LogLocationInfo(const sqf::runtime::diagnostics::diag_info& info)
 {
@@ -915,6 +929,23 @@ namespace logmessage::config
         output.append(message);
         return output;
     }
+    std::string MalformedRapifiedConfig::formatMessage() const
+    {
+        auto output = m_location.format();
+        auto offset = std::to_string(m_offset);
+
+        output.reserve(
+            output.length()
+            + "Rapified config is malformed at offset "sv.length()
+            + offset.length()
+            + "."sv.length()
+        );
+
+        output.append("Rapified config is malformed at offset "sv);
+        output.append(offset);
+        output.append("."sv);
+        return output;
+    }
 }
 namespace logmessage::linting
 {
@@ -3094,3 +3125,90 @@ std::string logmessage::fileio::ResolvePhysicalFailedToLookup::formatMessage() c
     output.append(messageD);
     return output;
 }
+
+std::string logmessage::fileio::BytecodeCacheEntryStale::formatMessage() const
+{
+    const auto messageA = "Bytecode cache entry for `"sv;
+    const auto messageB = "` is stale ("sv;
+    const auto messageC = "), recompiling."sv;
+
+    std::string output;
+    output.reserve(
+        messageA.length() +
+        m_source.length() +
+        messageB.length() +
+        m_reason.length() +
+        messageC.length()
+    );
+
+    output.append(messageA);
+    output.append(m_source);
+    output.append(messageB);
+    output.append(m_reason);
+    output.append(messageC);
+    return output;
+}
+
+std::string logmessage::fileio::BytecodeCacheWriteFailed::formatMessage() const
+{
+    const auto messageA = "Failed to write bytecode cache entry `"sv;
+    const auto messageB = "` for `"sv;
+    const auto messageC = "`."sv;
+
+    std::string output;
+    output.reserve(
+        messageA.length() +
+        m_entry.length() +
+        messageB.length() +
+        m_source.length() +
+        messageC.length()
+    );
+
+    output.append(messageA);
+    output.append(m_entry);
+    output.append(messageB);
+    output.append(m_source);
+    output.append(messageC);
+    return output;
+}
+
+std::string logmessage::fileio::ConfigCacheEntryStale::formatMessage() const
+{
+    const auto messageA = "Config cache entry `"sv;
+    const auto messageB = "` is stale ("sv;
+    const auto messageC = "), reparsing."sv;
+
+    std::string output;
+    output.reserve(
+        messageA.length() +
+        m_entry.length() +
+        messageB.length() +
+        m_reason.length() +
+        messageC.length()
+    );
+
+    output.append(messageA);
+    output.append(m_entry);
+    output.append(messageB);
+    output.append(m_reason);
+    output.append(messageC);
+    return output;
+}
+
+std::string logmessage::fileio::ConfigCacheWriteFailed::formatMessage() const
+{
+    const auto messageA = "Failed to write config cache entry `"sv;
+    const auto messageB = "`."sv;
+
+    std::string output;
+    output.reserve(
+        messageA.length() +
+        m_entry.length() +
+        messageB.length()
+    );
+
+    output.append(messageA);
+    output.append(m_entry);
+    output.append(messageB);
+    return output;
+}
@@ -88,12 +88,40 @@ public:
 
     virtual void log(const LogMessageBase& message) override;
 };
+/// <summary>
+/// Logger keeping all messages until they get passed on to another logger using flush.
+/// Allows work done on other threads to report its messages in a deterministic order.
+/// </summary>
+class BufferedLogger : public Logger {
+public:
+    class BufferedMessage : public LogMessageBase {
+        std::string m_message;
+    public:
+        BufferedMessage(loglevel level, size_t code, std::string message) : LogMessageBase(level, code), m_message(std::move(message)) {}
+        [[nodiscard]] std::string formatMessage() const override { return m_message; }
+    };
+private:
+    std::vector<BufferedMessage> m_messages;
+public:
+    /// <summary>
+    /// Creates a new BufferedLogger, enabling the same levels as the provided logger.
+    /// </summary>
+    BufferedLogger(const Logger& levels_of) : Logger(levels_of) {}
+
+    virtual void log(const LogMessageBase& message) override;
+    /// <summary>
+    /// Passes all messages enabled in the provided logger to it and clears the buffer.
+    /// </summary>
+    void flush(Logger& target);
+    bool empty() const { return m_messages.empty(); }
+    const std::vector<BufferedMessage>& messages() const { return m_messages; }
+};
 
 //Classes that can log, inherit from this
 class CanLog {
     Logger& m_logger;
 protected:
-    Logger& get_logger() { return m_logger; }
+    Logger& get_logger() const { return m_logger; }
     void log(LogMessageBase& message) const;
     void log(LogMessageBase&& message) const;
 public:
@@ -639,6 +667,16 @@ namespace logmessage {
                 ConfigBase(level, errorCode, std::move(loc)) { }
             [[nodiscard]] std::string formatMessage() const override;
         };
+        class MalformedRapifiedConfig : public ConfigBase {
+            static const loglevel level = loglevel::error;
+            static const size_t errorCode = 40013;
+            size_t m_offset;
+        public:
+            MalformedRapifiedConfig(LogLocationInfo loc, size_t offset) :
+                ConfigBase(level, errorCode, std::move(loc)),
+                m_offset(offset) { }
+            [[nodiscard]] std::string formatMessage() const override;
+        };
     }
     namespace linting
     {
@@ -1952,6 +1990,52 @@ namespace logmessage {
                 m_matched(matched) {}
             [[nodiscard]] std::string formatMessage() const override;
         };
+        class BytecodeCacheEntryStale : public FileIoBase {
+            static const loglevel level = loglevel::info;
+            static const size_t errorCode = 60014;
+            std::string m_source;
+            std::string m_reason;
+        public:
+            BytecodeCacheEntryStale(std::string source, std::string reason) :
+                FileIoBase(level, errorCode, {}),
+                m_source(source),
+                m_reason(reason) {}
+            [[nodiscard]] std::string formatMessage() const override;
+        };
+        class BytecodeCacheWriteFailed : public FileIoBase {
+            static const loglevel level = loglevel::warning;
+            static const size_t errorCode = 60015;
+            std::string m_source;
+            std::string m_entry;
+        public:
+            BytecodeCacheWriteFailed(std::string source, std::string entry) :
+                FileIoBase(level, errorCode, {}),
+                m_source(source),
+                m_entry(entry) {}
+            [[nodiscard]] std::string formatMessage() const override;
+        };
+        class ConfigCacheEntryStale : public FileIoBase {
+            static const loglevel level = loglevel::info;
+            static const size_t errorCode = 60016;
+            std::string m_entry;
+            std::string m_reason;
+        public:
+            ConfigCacheEntryStale(std::string entry, std::string reason) :
+                FileIoBase(level, errorCode, {}),
+                m_entry(entry),
+                m_reason(reason) {}
+            [[nodiscard]] std::string formatMessage() const override;
+        };
+        class ConfigCacheWriteFailed : public FileIoBase {
+            static const loglevel level = loglevel::warning;
+            static const size_t errorCode = 60017;
+            std::string m_entry;
+        public:
+            ConfigCacheWriteFailed(std::string entry) :
+                FileIoBase(level, errorCode, {}),
+                m_entry(entry) {}
+            [[nodiscard]] std::string formatMessage() const override;
+        };
     }
 }
 
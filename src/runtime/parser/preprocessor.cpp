@@ -8,6 +8,6 @@ std::optional<std::string> sqf::parser::preprocessor::passthrough::preprocess(::
 
 std::optional<std::string> sqf::runtime::parser::preprocessor::preprocess(::sqf::runtime::runtime& runtime, ::sqf::runtime::fileio::pathinfo pathinfo)
 {
-    auto contents = runtime.fileio().read_file(pathinfo);
-    return preprocess(runtime, contents, pathinfo);
+    auto file = runtime.fileio().open_file(pathinfo);
+    return preprocess(runtime, file->contents(), pathinfo);
 }
@@ -1,6 +1,7 @@
 #pragma once
 #include "../fileio.h"
 #include "../diagnostics/diag_info.h"
+#include "../logging.h"
 
 #include <string>
 #include <string_view>
@@ -63,7 +64,7 @@ namespace sqf
                 std::string_view name() const { return m_name; }
                 std::string_view content() const { return m_content; }
                 const std::vector<std::string>& args() const { return m_args; }
-                const ::sqf::runtime::diagnostics::diag_info diag_info() const { return m_diag_info; }
+                const ::sqf::runtime::diagnostics::diag_info& diag_info() const { return m_diag_info; }
                 bool has_callback() const { return m_callback; }
                 bool is_callable() const { return m_is_callable; }
                 
@@ -77,9 +78,30 @@ namespace sqf
             {
             public:
                 virtual void push_back(::sqf::runtime::parser::macro m) = 0;
+                /// <summary>
+                /// Returns a value identifying the current set of macros.
+                /// Preprocessing the same input is expected to yield the same output
+                /// as long as the fingerprint does not change.
+                /// </summary>
+                virtual size_t fingerprint() const = 0;
                 virtual ~preprocessor() {}
                 virtual std::optional<std::string> preprocess(::sqf::runtime::runtime& runtime, ::std::string_view view, ::sqf::runtime::fileio::pathinfo pathinfo) = 0;
                 std::optional<std::string> preprocess(::sqf::runtime::runtime& runtime, ::sqf::runtime::fileio::pathinfo pathinfo);
+                /// <summary>
+                /// Preprocesses the provided contents without changing any shared state, allowing multiple threads
+                /// to preprocess at once while the runtime is not executing and no macros are added.
+                /// Messages are reported to the provided logger.
+                /// </summary>
+                /// <remarks>
+                /// Macros depending on or changing shared state (eg. __COUNTER__ or __EVAL) are not expanded.
+                /// Instead, deferred is set and the contents have to be preprocessed again using preprocess.
+                /// The default implementation always defers.
+                /// </remarks>
+                virtual std::optional<std::string> preprocess_isolated(::sqf::runtime::runtime& runtime, Logger& logger, ::std::string_view view, ::sqf::runtime::fileio::pathinfo pathinfo, bool& deferred)
+                {
+                    deferred = true;
+                    return {};
+                }
             };
         }
     }
@@ -89,8 +111,14 @@ namespace sqf
         {
             public:
                 virtual void push_back(::sqf::runtime::parser::macro m) override {};
+                virtual size_t fingerprint() const override { return 0; }
                 virtual ~passthrough() override { return; };
                 virtual std::optional<std::string> preprocess(::sqf::runtime::runtime& runtime, ::std::string_view view, ::sqf::runtime::fileio::pathinfo pathinfo) override;
+                virtual std::optional<std::string> preprocess_isolated(::sqf::runtime::runtime& runtime, Logger& logger, ::std::string_view view, ::sqf::runtime::fileio::pathinfo pathinfo, bool& deferred) override
+                {
+                    deferred = false;
+                    return std::string(view);
+                }
         };
     }
 }
@@ -0,0 +1,12 @@
+#include "sqf.h"
+#include "../runtime.h"
+
+bool sqf::runtime::parser::sqf::check_syntax(::sqf::runtime::runtime& runtime, std::string contents, ::sqf::runtime::fileio::pathinfo file)
+{
+    return check_syntax(context{ runtime.sqfop_names_table(), nullptr }, std::move(contents), std::move(file));
+}
+
+std::optional<sqf::runtime::instruction_set> sqf::runtime::parser::sqf::parse(::sqf::runtime::runtime& runtime, std::string contents, ::sqf::runtime::fileio::pathinfo file)
+{
+    return parse(context{ runtime.sqfop_names_table(), nullptr }, std::move(contents), std::move(file));
+}
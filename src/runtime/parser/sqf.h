@@ -1,10 +1,14 @@
 #pragma once
 #include "../fileio.h"
 #include "../instruction_set.h"
+#include "../diagnostics/source_file.h"
+#include "../sqfop_names.h"
+#include "../logging.h"
 
 #include <optional>
 #include <algorithm>
 #include <string_view>
+#include <memory>
 
 namespace sqf
 {
@@ -16,46 +20,36 @@ namespace sqf
             class sqf
             {
             public:
+                /// <summary>
+                /// Read-only state a parser requires from the runtime.
+                /// Other than the runtime, a context may be used by multiple threads at once,
+                /// allowing to parse multiple files concurrently.
+                /// </summary>
+                struct context
+                {
+                    /// <summary>
+                    /// The operators available, used to classify identifiers.
+                    /// </summary>
+                    std::shared_ptr<const ::sqf::runtime::sqfop_names> operators;
+                    /// <summary>
+                    /// The logger to report to. If nullptr, the logger of the parser is used.
+                    /// Has to be distinct per thread if used concurrently.
+                    /// </summary>
+                    Logger* logger;
+                };
+
                 virtual ~sqf() {};
-                virtual bool check_syntax(::sqf::runtime::runtime& runtime, std::string contents, ::sqf::runtime::fileio::pathinfo file) = 0;
-                virtual std::optional<::sqf::runtime::instruction_set> parse(::sqf::runtime::runtime& runtime, std::string contents, ::sqf::runtime::fileio::pathinfo file) = 0;
+                /// <summary>
+                /// Validates the syntax of the provided contents, reporting all errors found.
+                /// Other than parse, implementations are not required to create any instructions.
+                /// </summary>
+                virtual bool check_syntax(const context& context, std::string contents, ::sqf::runtime::fileio::pathinfo file) = 0;
+                virtual std::optional<::sqf::runtime::instruction_set> parse(const context& context, std::string contents, ::sqf::runtime::fileio::pathinfo file) = 0;
+                bool check_syntax(::sqf::runtime::runtime& runtime, std::string contents, ::sqf::runtime::fileio::pathinfo file);
+                std::optional<::sqf::runtime::instruction_set> parse(::sqf::runtime::runtime& runtime, std::string contents, ::sqf::runtime::fileio::pathinfo file);
                 static std::string create_code_segment(std::string_view view, size_t off, size_t length)
                 {
-                    size_t i = off < 15 ? 0 : off - 15;
-                    size_t len = 30 + length;
-                    if (i < 0)
-                    {
-                        len += i;
-                        i = 0;
-                    }
-                    for (size_t j = i; j < i + len && j < view.length(); j++)
-                    {
-                        char wc = view[j];
-                        if (wc == '\n')
-                        {
-                            if (j < off)
-                            {
-                                i = j + 1;
-                            }
-                            else
-                            {
-                                len = j - i;
-                                break;
-                            }
-                        }
-                    }
-
-                    std::string spacing(off - i, ' ');
-                    std::string postfix(std::max<size_t>(1, length), '^');
-
-                    std::string txt;
-                    txt.reserve(len + 1 + spacing.length() + postfix.length() + 1);
-                    txt.append(view.substr(i, len));
-                    txt.append("\n");
-                    txt.append(spacing);
-                    txt.append(postfix);
-                    txt.append("\n");
-                    return txt;
+                    return ::sqf::runtime::diagnostics::create_code_segment(view, off, length);
                 }
             };
         }
@@ -65,9 +59,11 @@ namespace sqf
         class disabled : public ::sqf::runtime::parser::sqf
         {
         public:
+            using ::sqf::runtime::parser::sqf::check_syntax;
+            using ::sqf::runtime::parser::sqf::parse;
             virtual ~disabled() override { return; };
-            virtual bool check_syntax(::sqf::runtime::runtime& runtime, std::string contents, ::sqf::runtime::fileio::pathinfo file) override { return false; }
-            virtual std::optional<::sqf::runtime::instruction_set> parse(::sqf::runtime::runtime& runtime, std::string contents, ::sqf::runtime::fileio::pathinfo file) override { return {}; }
+            virtual bool check_syntax(const context& context, std::string contents, ::sqf::runtime::fileio::pathinfo file) override { return false; }
+            virtual std::optional<::sqf::runtime::instruction_set> parse(const context& context, std::string contents, ::sqf::runtime::fileio::pathinfo file) override { return {}; }
         };
     }
 }
\ No newline at end of file
@@ -110,11 +110,12 @@ static sqf::runtime::runtime::result execute_do(sqf::runtime::runtime& runtime,
         }
 
         // Check if breakpoint was hit
+        if (!runtime.breakpoints().empty())
         {
-            auto dinf = (*instruction)->diag_info();
+            auto& location = (*instruction)->location();
             for (const auto& breakpoint : runtime.breakpoints())
             {
-                if (breakpoint.is_enabled() && breakpoint.line() == dinf.line && breakpoint.file() == dinf.path.physical)
+                if (breakpoint.is_enabled() && breakpoint.line() == location.line && breakpoint.file() == location.physical())
                 {
                     runtime.breakpoint_hit(breakpoint);
                     context_active.current_frame().previous(); // Unput instruction
@@ -323,9 +324,11 @@ sqf::runtime::runtime::result sqf::runtime::runtime::execute(sqf::runtime::runti
             m_state = state::running;
             while (!m_contexts.empty())
             {
-                for (auto iterator = m_contexts.begin(); iterator != m_contexts.end(); iterator++)
+                // Indexed, as executing may spawn new contexts, invalidating iterators.
+                size_t index = 0;
+                while (index < m_contexts.size())
                 {
-                    m_context_active = *iterator;
+                    m_context_active = m_contexts[index];
                     if (m_context_active->suspended())
                     {
                         if (m_context_active->wakeup_timestamp() <= std::chrono::system_clock::now())
@@ -357,27 +360,27 @@ sqf::runtime::runtime::result sqf::runtime::runtime::execute(sqf::runtime::runti
                         std::cout << "\x1B[33m[ASSEMBLY ASSERT]\033[0m" <<
                             "        " <<
                             "        " <<
-                            "    " << "\x1B[36mERASE CONTEXT\033[0m \x1B[90" << ((*iterator)->name().empty() ? "<unnamed>" : (*iterator)->name()) << "\033[0m" << std::endl;
+                            "    " << "\x1B[36mERASE CONTEXT\033[0m \x1B[90" << (m_context_active->name().empty() ? "<unnamed>" : m_context_active->name()) << "\033[0m" << std::endl;
 #endif // DF__SQF_RUNTIME__ASSEMBLY_DEBUG_ON_EXECUTE
-                        auto opt_val = (*iterator)->pop_value(true);
+                        auto opt_val = m_context_active->pop_value(true);
                         if (opt_val.has_value() && configuration().print_context_work_to_log_on_exit)
                         {
                             __logmsg(logmessage::runtime::ContextValuePrint(opt_val.value()));
                         }
-                        m_contexts.erase(iterator);
+                        m_contexts.erase(m_contexts.begin() + index);
                         if (m_contexts.empty())
                         {
                             m_context_active = {};
                             goto start_loop_exit;
                         }
-                        iterator = m_contexts.begin();
-                    } break;
+                    } continue;
                     case sqf::runtime::runtime::result::invalid:
                     case sqf::runtime::runtime::result::action_error:
                     case sqf::runtime::runtime::result::runtime_error:
                         goto start_loop_exit;
                     case sqf::runtime::runtime::result::ok: /* empty */ break;
                     }
+                    index++;
                 }
             }
         start_loop_exit:
@@ -461,15 +464,15 @@ sqf::runtime::runtime::result sqf::runtime::runtime::execute(sqf::runtime::runti
             m_is_halt_requested = false;
             bool success;
             m_state = state::running;
-            std::optional<diagnostics::diag_info> dinf;
+            std::optional<diagnostics::source_location> location;
             while (!m_is_exit_requested && !m_is_halt_requested && !m_contexts.empty())
             {
-                if (!dinf.has_value())
+                if (!location.has_value())
                 {
                     auto next_inst = m_context_active->current_frame().peek(success);
                     if (success)
                     {
-                        dinf = { (*next_inst)->diag_info() };
+                        location = { (*next_inst)->location() };
                     }
                 }
 
@@ -479,10 +482,10 @@ sqf::runtime::runtime::result sqf::runtime::runtime::execute(sqf::runtime::runti
                 {
                     break;
                 }
-                if (dinf.has_value())
+                if (location.has_value())
                 {
                     auto next_inst = m_context_active->current_frame().peek(success);
-                    if (success && dinf.value() != (*next_inst)->diag_info())
+                    if (success && location.value() != (*next_inst)->location())
                     {
                         break;
                     }
@@ -3,15 +3,19 @@
 #include "diagnostics/breakpoint.h"
 #include "context.h"
 #include "confighost.h"
+#include "compile_cache.h"
 #include "fileio.h"
 #include "parser/config.h"
 #include "parser/sqf.h"
 #include "parser/preprocessor.h"
 #include "value_scope.h"
 #include "sqfop.h"
+#include "sqfop_names.h"
 
 #include <chrono>
 #include <atomic>
+#include <memory>
+#include <iosfwd>
 #include <vector>
 #include <typeinfo>
 #include <typeindex>
@@ -85,13 +89,21 @@ namespace sqf::runtime
             /// </summary>
             bool print_context_work_to_log_on_exit;
 
+            /// <summary>
+            /// Maximum number of preprocessed and of compiled
+            /// contents kept in the compile cache.
+            /// Cache is disabled if 0.
+            /// </summary>
+            size_t compile_cache_capacity;
+
 
             runtime_conf() :
                 max_runtime(std::chrono::milliseconds::zero()),
                 disable_sleep(false),
                 enable_classname_check(true),
                 disable_networking(false),
-                print_context_work_to_log_on_exit(false)
+                print_context_work_to_log_on_exit(false),
+                compile_cache_capacity(4096)
             {}
         };
 
@@ -165,51 +177,181 @@ namespace sqf::runtime
 #pragma region Operators
 
     private:
-        std::unordered_map<sqf::runtime::sqfop_binary::key, sqf::runtime::sqfop_binary> m_operators_binary;
-        std::unordered_map<std::string, std::vector<sqf::runtime::sqfop_binary::cwref>> m_operators_by_name_binary;
+        struct operator_tables
+        {
+            std::unordered_map<sqf::runtime::sqfop_binary::key, sqf::runtime::sqfop_binary> binary;
+            std::unordered_map<std::string, std::vector<sqf::runtime::sqfop_binary::cwref>> by_name_binary;
 
-        std::unordered_map<sqf::runtime::sqfop_unary::key, sqf::runtime::sqfop_unary> m_operators_unary;
-        std::unordered_map<std::string, std::vector<sqf::runtime::sqfop_unary::cwref>> m_operators_by_name_unary;
+            std::unordered_map<sqf::runtime::sqfop_unary::key, sqf::runtime::sqfop_unary> unary;
+            std::unordered_map<std::string, std::vector<sqf::runtime::sqfop_unary::cwref>> by_name_unary;
 
-        std::unordered_map<sqf::runtime::sqfop_nular::key, sqf::runtime::sqfop_nular> m_operators_nular;
+            std::unordered_map<sqf::runtime::sqfop_nular::key, sqf::runtime::sqfop_nular> nular;
+
+            // Built on first use after the set of operators changed. Accessed atomically,
+            // as the tables may be shared between runtimes created from the same snapshot.
+            std::shared_ptr<const sqf::runtime::sqfop_names> names;
+
+            operator_tables() = default;
+            // The by-name tables reference into the keyed tables and thus have to be rebuilt on copy.
+            operator_tables(const operator_tables& copy) : binary(copy.binary), unary(copy.unary), nular(copy.nular), names(std::atomic_load(&copy.names))
+            {
+                for (auto& it : binary) { by_name_binary[std::string(it.second.name())].push_back(it.second); }
+                for (auto& it : unary) { by_name_unary[std::string(it.second.name())].push_back(it.second); }
+            }
+        };
+        std::shared_ptr<operator_tables> m_operators;
+
+        /// <summary>
+        /// Returns the operator tables for modification.
+        /// If the tables are shared with a snapshot or a runtime created from one,
+        /// they get copied first (copy-on-write).
+        /// </summary>
+        operator_tables& operators_mutable()
+        {
+            if (m_operators.use_count() > 1)
+            {
+                m_operators = std::make_shared<operator_tables>(*m_operators);
+            }
+            return *m_operators;
+        }
     public:
         using sqfop_binary_iterator = std::unordered_map<sqf::runtime::sqfop_binary::key, sqf::runtime::sqfop_binary>::const_iterator;
         using sqfop_unary_iterator = std::unordered_map<sqf::runtime::sqfop_unary::key, sqf::runtime::sqfop_unary>::const_iterator;
         using sqfop_nular_iterator = std::unordered_map<sqf::runtime::sqfop_nular::key, sqf::runtime::sqfop_nular>::const_iterator;
 
-        sqfop_binary_iterator sqfop_binary_begin() const { return m_operators_binary.begin(); }
-        sqfop_binary_iterator sqfop_binary_end() const { return m_operators_binary.end(); }
-        bool sqfop_exists(const sqf::runtime::sqfop_binary::key key) const { return m_operators_binary.find(key) != m_operators_binary.end(); }
-        sqf::runtime::sqfop_binary::cref sqfop_at(const sqf::runtime::sqfop_binary::key key) const { return m_operators_binary.at(key); }
-        const std::vector<sqf::runtime::sqfop_binary::cwref>& sqfop_binary_by_name(const std::string key) const { return m_operators_by_name_binary.at(key); }
-        bool sqfop_exists_binary(const std::string key) const { return m_operators_by_name_binary.find(key) != m_operators_by_name_binary.end(); }
+        sqfop_binary_iterator sqfop_binary_begin() const { return m_operators->binary.begin(); }
+        sqfop_binary_iterator sqfop_binary_end() const { return m_operators->binary.end(); }
+        bool sqfop_exists(const sqf::runtime::sqfop_binary::key key) const { return m_operators->binary.find(key) != m_operators->binary.end(); }
+        sqf::runtime::sqfop_binary::cref sqfop_at(const sqf::runtime::sqfop_binary::key key) const { return m_operators->binary.at(key); }
+        const std::vector<sqf::runtime::sqfop_binary::cwref>& sqfop_binary_by_name(const std::string key) const { return m_operators->by_name_binary.at(key); }
+        bool sqfop_exists_binary(const std::string key) const { return m_operators->by_name_binary.find(key) != m_operators->by_name_binary.end(); }
         void register_sqfop(sqf::runtime::sqfop_binary op)
         {
-            m_operators_binary.insert({ op.get_key(), op });
-            m_operators_by_name_binary[std::string(op.name())].push_back(m_operators_binary[op.get_key()]);
+            auto& tables = operators_mutable();
+            tables.binary.insert({ op.get_key(), op });
+            tables.by_name_binary[std::string(op.name())].push_back(tables.binary[op.get_key()]);
+            std::atomic_store(&tables.names, {});
         }
 
-        sqfop_unary_iterator sqfop_unary_begin() const { return m_operators_unary.begin(); }
-        sqfop_unary_iterator sqfop_unary_end() const { return m_operators_unary.end(); }
-        bool sqfop_exists(const sqf::runtime::sqfop_unary::key key) const { return m_operators_unary.find(key) != m_operators_unary.end(); }
-        sqf::runtime::sqfop_unary::cref sqfop_at(const sqf::runtime::sqfop_unary::key key) const { return m_operators_unary.at(key); }
-        const std::vector<sqf::runtime::sqfop_unary::cwref>& sqfop_unary_by_name(const std::string key) const { return m_operators_by_name_unary.at(key); }
-        bool sqfop_exists_unary(const std::string key) const { return m_operators_by_name_unary.find(key) != m_operators_by_name_unary.end(); }
+        sqfop_unary_iterator sqfop_unary_begin() const { return m_operators->unary.begin(); }
+        sqfop_unary_iterator sqfop_unary_end() const { return m_operators->unary.end(); }
+        bool sqfop_exists(const sqf::runtime::sqfop_unary::key key) const { return m_operators->unary.find(key) != m_operators->unary.end(); }
+        sqf::runtime::sqfop_unary::cref sqfop_at(const sqf::runtime::sqfop_unary::key key) const { return m_operators->unary.at(key); }
+        const std::vector<sqf::runtime::sqfop_unary::cwref>& sqfop_unary_by_name(const std::string key) const { return m_operators->by_name_unary.at(key); }
+        bool sqfop_exists_unary(const std::string key) const { return m_operators->by_name_unary.find(key) != m_operators->by_name_unary.end(); }
         void register_sqfop(sqf::runtime::sqfop_unary op)
         {
-            m_operators_unary.insert({ op.get_key(), op });
-            m_operators_by_name_unary[std::string(op.name())].push_back(m_operators_unary[op.get_key()]);
+            auto& tables = operators_mutable();
+            tables.unary.insert({ op.get_key(), op });
+            tables.by_name_unary[std::string(op.name())].push_back(tables.unary[op.get_key()]);
+            std::atomic_store(&tables.names, {});
         }
 
-        sqfop_nular_iterator sqfop_nular_begin() const { return m_operators_nular.begin(); }
-        sqfop_nular_iterator sqfop_nular_end() const { return m_operators_nular.end(); }
-        bool sqfop_exists(const sqf::runtime::sqfop_nular::key key) const { return m_operators_nular.find(key) != m_operators_nular.end(); }
-        sqf::runtime::sqfop_nular::cref sqfop_at(const sqf::runtime::sqfop_nular::key key) const { return m_operators_nular.at(key); }
+        sqfop_nular_iterator sqfop_nular_begin() const { return m_operators->nular.begin(); }
+        sqfop_nular_iterator sqfop_nular_end() const { return m_operators->nular.end(); }
+        bool sqfop_exists(const sqf::runtime::sqfop_nular::key key) const { return m_operators->nular.find(key) != m_operators->nular.end(); }
+        sqf::runtime::sqfop_nular::cref sqfop_at(const sqf::runtime::sqfop_nular::key key) const { return m_operators->nular.at(key); }
         void register_sqfop(sqf::runtime::sqfop_nular op)
         {
-            m_operators_nular.insert({ op.get_key(), op });
+            auto& tables = operators_mutable();
+            tables.nular.insert({ op.get_key(), op });
+            std::atomic_store(&tables.names, {});
         }
 
+        /// <summary>
+        /// Returns the classification of all operator names currently registered,
+        /// allowing parsers to tell binary, unary and nular operators apart using a single lookup.
+        /// The table is immutable and rebuilt only after the operators changed.
+        /// </summary>
+        std::shared_ptr<const sqf::runtime::sqfop_names> sqfop_names_table() const
+        {
+            auto names = std::atomic_load(&m_operators->names);
+            if (!names)
+            {
+                auto table = std::make_shared<sqf::runtime::sqfop_names>();
+                for (auto& it : m_operators->by_name_binary)
+                {
+                    table->add(it.first, sqf::runtime::sqfop_names::binary, it.second.front().get().precedence());
+                }
+                for (auto& it : m_operators->by_name_unary)
+                {
+                    table->add(it.first, sqf::runtime::sqfop_names::unary);
+                }
+                for (auto& it : m_operators->nular)
+                {
+                    table->add(it.first.name, sqf::runtime::sqfop_names::nular);
+                }
+                names = table;
+                std::atomic_store(&m_operators->names, names);
+            }
+            return names;
+        }
+
+#pragma endregion
+#pragma region Snapshots
+
+    public:
+        /// <summary>
+        /// Immutable copy of the initialized state of a runtime (operators, config,
+        /// namespaces, fileio and parsers), allowing to create further runtimes
+        /// without having to repeat the initialization.
+        /// </summary>
+        /// <remarks>
+        /// Operator tables and config are shared with the runtimes created from a snapshot
+        /// and only get copied once modified. Namespaces are copied on first access.
+        /// FileIO and parsers are shared as-is and thus should be fully configured before creating the snapshot.
+        /// Runtime storage (eg. objects or groups), contexts and breakpoints are not part of a snapshot.
+        /// </remarks>
+        class snapshot
+        {
+            friend class runtime;
+        private:
+            runtime_conf m_configuration;
+            std::shared_ptr<operator_tables> m_operators;
+            sqf::runtime::confighost m_confighost;
+            std::unordered_map<std::string, std::shared_ptr<sqf::runtime::value_scope>> m_namespaces;
+            std::string m_default_scope_key;
+            std::shared_ptr<sqf::runtime::fileio> m_fileio;
+            std::shared_ptr<sqf::runtime::parser::sqf> m_parser_sqf;
+            std::shared_ptr<sqf::runtime::parser::config> m_parser_config;
+            std::shared_ptr<sqf::runtime::parser::preprocessor> m_parser_preprocessor;
+
+            snapshot() = default;
+        public:
+            runtime_conf configuration() const { return m_configuration; }
+
+            /// <summary>
+            /// Writes the config and the namespaces of this snapshot into the provided stream.
+            /// Namespace variables holding values other than nil, SCALAR, BOOL, STRING or ARRAY are skipped.
+            /// </summary>
+            /// <param name="out">The stream to write to. Expected to be opened in binary mode.</param>
+            /// <returns>True if all data was written successfully, false otherwise.</returns>
+            bool serialize(std::ostream& out) const;
+
+            /// <summary>
+            /// Replaces the config and the namespaces of this snapshot with the ones read from the provided stream.
+            /// </summary>
+            /// <param name="in">The stream to read from. Expected to be opened in binary mode.</param>
+            /// <returns>True if the stream contained a valid snapshot, false otherwise. On failure, the snapshot is left unchanged.</returns>
+            bool deserialize(std::istream& in);
+        };
+
+    private:
+        std::shared_ptr<const snapshot> m_snapshot;
+        static std::shared_ptr<sqf::runtime::value_scope> value_scope_copy(const sqf::runtime::value_scope& source);
+
+    public:
+        /// <summary>
+        /// Creates a snapshot of the current runtime state.
+        /// </summary>
+        std::shared_ptr<snapshot> snapshot_create();
+
+        /// <summary>
+        /// Replaces operators, config, namespaces, fileio and parsers of this runtime
+        /// with the ones of the provided snapshot.
+        /// </summary>
+        void snapshot_apply(std::shared_ptr<const snapshot> snap);
+
 #pragma endregion
 #pragma region Namespaces
 
@@ -224,6 +366,11 @@ namespace sqf::runtime
             {
                 return needle->second;
             }
+            else if (m_snapshot && m_snapshot->m_namespaces.find(key) != m_snapshot->m_namespaces.end())
+            {
+                // Namespaces of the snapshot this runtime got created from are copied on first access.
+                return m_namespaces[key] = value_scope_copy(*m_snapshot->m_namespaces.at(key));
+            }
             else
             {
                 auto& value_scope = m_namespaces[key] = std::make_shared<sqf::runtime::value_scope>();
@@ -301,11 +448,12 @@ namespace sqf::runtime
         std::chrono::system_clock::time_point m_created_timestamp;
         std::chrono::system_clock::time_point m_current_time;
         sqf::runtime::confighost m_confighost;
+        sqf::runtime::compile_cache m_compile_cache;
 
-        std::unique_ptr<sqf::runtime::fileio> m_fileio;
-        std::unique_ptr<sqf::runtime::parser::sqf> m_parser_sqf;
-        std::unique_ptr<sqf::runtime::parser::config> m_parser_config;
-        std::unique_ptr<sqf::runtime::parser::preprocessor> m_parser_preprocessor;
+        std::shared_ptr<sqf::runtime::fileio> m_fileio;
+        std::shared_ptr<sqf::runtime::parser::sqf> m_parser_sqf;
+        std::shared_ptr<sqf::runtime::parser::config> m_parser_config;
+        std::shared_ptr<sqf::runtime::parser::preprocessor> m_parser_preprocessor;
 
     public:
         runtime(Logger& logger, runtime_conf config) :
@@ -317,6 +465,7 @@ namespace sqf::runtime
             m_run_atomic(false),
             m_breakpoints(),
             m_last_breakpoint_hit(~((size_t)0), {}),
+            m_operators(std::make_shared<operator_tables>()),
             m_default_scope_key("default"),
             m_evaluate_halt(false),
             m_configuration(config),
@@ -324,12 +473,17 @@ namespace sqf::runtime
             m_runtime_error(false),
             m_created_timestamp(m_runtime_timestamp),
             m_confighost(),
+            m_compile_cache(config.compile_cache_capacity),
             m_fileio(std::make_unique<sqf::fileio::disabled>()),
             m_parser_sqf(std::make_unique<sqf::parser::sqf::disabled>()),
             m_parser_config(std::make_unique<sqf::parser::config::disabled>()),
             m_parser_preprocessor(std::make_unique<sqf::parser::preprocessor::passthrough>())
         {
         }
+        runtime(Logger& logger, std::shared_ptr<const snapshot> snap) : runtime(logger, snap->configuration())
+        {
+            snapshot_apply(snap);
+        }
 
 
         sqf::runtime::runtime::result execute(sqf::runtime::runtime::action action);
@@ -338,11 +492,12 @@ namespace sqf::runtime
         void runtime_timestamp_reset() { m_runtime_timestamp = std::chrono::system_clock::now(); }
 
         sqf::runtime::confighost& confighost() { return m_confighost; }
+        sqf::runtime::compile_cache& compile_cache() { return m_compile_cache; }
 
         void fileio(std::unique_ptr<sqf::runtime::fileio> ptr) { m_fileio = std::move(ptr); }
-        void parser_sqf(std::unique_ptr<sqf::runtime::parser::sqf> ptr) { m_parser_sqf = std::move(ptr); }
+        void parser_sqf(std::unique_ptr<sqf::runtime::parser::sqf> ptr) { m_parser_sqf = std::move(ptr); m_compile_cache.clear(); }
         void parser_config(std::unique_ptr<sqf::runtime::parser::config> ptr) { m_parser_config = std::move(ptr); }
-        void parser_preprocessor(std::unique_ptr<sqf::runtime::parser::preprocessor> ptr) { m_parser_preprocessor = std::move(ptr); }
+        void parser_preprocessor(std::unique_ptr<sqf::runtime::parser::preprocessor> ptr) { m_parser_preprocessor = std::move(ptr); m_compile_cache.clear(); }
         sqf::runtime::fileio& fileio() { return *m_fileio; }
         sqf::runtime::parser::sqf& parser_sqf() { return *m_parser_sqf; }
         sqf::runtime::parser::config& parser_config() { return *m_parser_config; }
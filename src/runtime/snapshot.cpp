@@ -0,0 +1,274 @@
+#include "runtime.h"
+#include "d_array.h"
+#include "d_string.h"
+#include "d_scalar.h"
+#include "d_boolean.h"
+
+#include <algorithm>
+#include <istream>
+#include <ostream>
+#include <cstdint>
+#include <cstring>
+
+namespace
+{
+    // Binary layout (native endianness):
+    //   header:     char[8] magic, uint32 version
+    //   config:     string image (see sqf::runtime::confighost::write_image)
+    //   namespaces: uint64 count, count * { string name, uint64 variables, variables * { string name, value } }
+    //   string:     uint64 length, char[length]
+    //   value:      uint8 tag, payload depending on tag (see value_tag)
+    const char snapshot_magic[8] = { 'S', 'Q', 'F', 'V', 'M', 'S', 'N', 'P' };
+    const uint32_t snapshot_version = 2;
+
+    enum class value_tag : uint8_t
+    {
+        nil,
+        scalar,
+        boolean,
+        string,
+        array
+    };
+
+    bool is_serializable(const sqf::runtime::value& val)
+    {
+        if (val.empty() || val.is<sqf::runtime::t_scalar>() || val.is<sqf::runtime::t_boolean>() || val.is<sqf::runtime::t_string>())
+        {
+            return true;
+        }
+        if (val.is<sqf::runtime::t_array>())
+        {
+            auto arr = val.data<sqf::types::d_array>();
+            return std::all_of(arr->begin(), arr->end(), [](const sqf::runtime::value& it) { return is_serializable(it); });
+        }
+        return false;
+    }
+
+    template<typename T>
+    void write_raw(std::ostream& out, T t) { out.write(reinterpret_cast<const char*>(&t), sizeof(T)); }
+    template<typename T>
+    bool read_raw(std::istream& in, T& t) { in.read(reinterpret_cast<char*>(&t), sizeof(T)); return in.good(); }
+
+    void write_string(std::ostream& out, std::string_view str)
+    {
+        write_raw<uint64_t>(out, str.length());
+        out.write(str.data(), str.length());
+    }
+    bool read_string(std::istream& in, std::string& str)
+    {
+        uint64_t length;
+        if (!read_raw(in, length)) { return false; }
+        // Read in chunks, so that corrupted lengths fail once the stream ends instead of getting allocated up front.
+        char buffer[4096];
+        str.clear();
+        while (length > 0)
+        {
+            auto chunk = static_cast<size_t>(std::min<uint64_t>(length, sizeof(buffer)));
+            in.read(buffer, chunk);
+            if (!in.good()) { return false; }
+            str.append(buffer, chunk);
+            length -= chunk;
+        }
+        return true;
+    }
+
+    void write_value(std::ostream& out, const sqf::runtime::value& val)
+    {
+        if (val.is<sqf::runtime::t_scalar>())
+        {
+            write_raw(out, value_tag::scalar);
+            write_raw<float>(out, val.data<sqf::types::d_scalar, float>());
+        }
+        else if (val.is<sqf::runtime::t_boolean>())
+        {
+            write_raw(out, value_tag::boolean);
+            write_raw<uint8_t>(out, val.data<sqf::types::d_boolean, bool>() ? 1 : 0);
+        }
+        else if (val.is<sqf::runtime::t_string>())
+        {
+            write_raw(out, value_tag::string);
+            write_string(out, val.data<sqf::types::d_string, std::string>());
+        }
+        else if (val.is<sqf::runtime::t_array>())
+        {
+            auto arr = val.data<sqf::types::d_array>();
+            write_raw(out, value_tag::array);
+            write_raw<uint64_t>(out, arr->size());
+            for (auto& it : *arr)
+            {
+                write_value(out, it);
+            }
+        }
+        else
+        {
+            write_raw(out, value_tag::nil);
+        }
+    }
+    bool read_value(std::istream& in, sqf::runtime::value& val)
+    {
+        value_tag tag;
+        if (!read_raw(in, tag)) { return false; }
+        switch (tag)
+        {
+        case value_tag::nil:
+            val = {};
+            return true;
+        case value_tag::scalar:
+        {
+            float f;
+            if (!read_raw(in, f)) { return false; }
+            val = f;
+            return true;
+        }
+        case value_tag::boolean:
+        {
+            uint8_t flag;
+            if (!read_raw(in, flag)) { return false; }
+            val = flag != 0;
+            return true;
+        }
+        case value_tag::string:
+        {
+            std::string str;
+            if (!read_string(in, str)) { return false; }
+            val = str;
+            return true;
+        }
+        case value_tag::array:
+        {
+            uint64_t size;
+            if (!read_raw(in, size)) { return false; }
+            std::vector<sqf::runtime::value> arr;
+            for (uint64_t i = 0; i < size; i++)
+            {
+                if (!read_value(in, arr.emplace_back())) { return false; }
+            }
+            val = arr;
+            return true;
+        }
+        default:
+            return false;
+        }
+    }
+}
+
+std::shared_ptr<sqf::runtime::value_scope> sqf::runtime::runtime::value_scope_copy(const sqf::runtime::value_scope& source)
+{
+    auto copy = std::make_shared<sqf::runtime::value_scope>();
+    copy->scope_name(std::string(source.scope_name()));
+    for (auto& it : source)
+    {
+        // Arrays are mutable and thus must not be shared between runtimes.
+        (*copy)[it.first] = it.second.is<t_array>() ? value(it.second.data<sqf::types::d_array>()->copy_deep()) : it.second;
+    }
+    return copy;
+}
+
+std::shared_ptr<sqf::runtime::runtime::snapshot> sqf::runtime::runtime::snapshot_create()
+{
+    auto snap = std::shared_ptr<snapshot>(new snapshot());
+    snap->m_configuration = m_configuration;
+    snap->m_operators = m_operators;
+    snap->m_confighost = m_confighost.fork();
+    if (m_snapshot)
+    {
+        // Namespaces never accessed since creation still live in the previous snapshot only.
+        for (auto& it : m_snapshot->m_namespaces)
+        {
+            snap->m_namespaces[it.first] = it.second;
+        }
+    }
+    for (auto& it : m_namespaces)
+    {
+        snap->m_namespaces[it.first] = value_scope_copy(*it.second);
+    }
+    snap->m_default_scope_key = m_default_scope_key;
+    snap->m_fileio = m_fileio;
+    snap->m_parser_sqf = m_parser_sqf;
+    snap->m_parser_config = m_parser_config;
+    snap->m_parser_preprocessor = m_parser_preprocessor;
+    return snap;
+}
+
+void sqf::runtime::runtime::snapshot_apply(std::shared_ptr<const snapshot> snap)
+{
+    m_snapshot = snap;
+    m_operators = snap->m_operators;
+    m_confighost = snap->m_confighost.fork();
+    m_namespaces.clear();
+    m_default_scope_key = snap->m_default_scope_key;
+    m_fileio = snap->m_fileio;
+    m_parser_sqf = snap->m_parser_sqf;
+    m_parser_config = snap->m_parser_config;
+    m_parser_preprocessor = snap->m_parser_preprocessor;
+    m_compile_cache.clear();
+}
+
+bool sqf::runtime::runtime::snapshot::serialize(std::ostream& out) const
+{
+    out.write(snapshot_magic, sizeof(snapshot_magic));
+    write_raw(out, snapshot_version);
+
+    write_string(out, m_confighost.write_image());
+
+    write_raw<uint64_t>(out, m_namespaces.size());
+    for (auto& ns : m_namespaces)
+    {
+        write_string(out, ns.first);
+        auto count = std::count_if(ns.second->begin(), ns.second->end(), [](auto& it) { return is_serializable(it.second); });
+        write_raw<uint64_t>(out, count);
+        for (auto& it : static_cast<const value_scope&>(*ns.second))
+        {
+            if (is_serializable(it.second))
+            {
+                write_string(out, it.first);
+                write_value(out, it.second);
+            }
+        }
+    }
+    return out.good();
+}
+
+bool sqf::runtime::runtime::snapshot::deserialize(std::istream& in)
+{
+    try
+    {
+        char magic[sizeof(snapshot_magic)];
+        uint32_t version;
+        in.read(magic, sizeof(magic));
+        if (!in.good() || std::memcmp(magic, snapshot_magic, sizeof(magic)) != 0) { return false; }
+        if (!read_raw(in, version) || version != snapshot_version) { return false; }
+
+        std::string image;
+        if (!read_string(in, image)) { return false; }
+        auto host = sqf::runtime::confighost::read_image(image);
+        if (!host.has_value()) { return false; }
+
+        uint64_t namespace_count;
+        if (!read_raw(in, namespace_count)) { return false; }
+        std::unordered_map<std::string, std::shared_ptr<value_scope>> namespaces;
+        for (uint64_t i = 0; i < namespace_count; i++)
+        {
+            std::string name;
+            uint64_t variables;
+            if (!read_string(in, name) || !read_raw(in, variables)) { return false; }
+            auto scope = std::make_shared<value_scope>();
+            scope->scope_name(name);
+            for (uint64_t j = 0; j < variables; j++)
+            {
+                std::string variable_name;
+                if (!read_string(in, variable_name) || !read_value(in, (*scope)[variable_name])) { return false; }
+            }
+            namespaces[name] = scope;
+        }
+
+        m_confighost = std::move(*host);
+        m_namespaces = std::move(namespaces);
+        return true;
+    }
+    catch (const std::exception&)
+    {
+        // Corrupted length fields may cause allocation failures.
+        return false;
+    }
+}
@@ -0,0 +1,127 @@
+#pragma once
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstdint>
+#include <cctype>
+
+namespace sqf::runtime
+{
+    /// <summary>
+    /// Immutable, case-insensitive table classifying operator names by the kinds of
+    /// operators (binary, unary, nular) registered under that name.
+    /// Allows parsers to classify identifiers with a single lookup, without allocating.
+    /// </summary>
+    /// <remarks>
+    /// Open addressing with linear probing. The capacity is kept at least twice the
+    /// amount of names, so that most lookups are resolved with the first probe.
+    /// </remarks>
+    class sqfop_names
+    {
+    public:
+        enum kind : uint8_t
+        {
+            none = 0,
+            binary = 1 << 0,
+            unary = 1 << 1,
+            nular = 1 << 2
+        };
+        struct entry
+        {
+            std::string name;
+            uint8_t kinds;
+            /// <summary>
+            /// Precedence of the binary operator, 0 if there is none.
+            /// </summary>
+            short precedence;
+
+            bool is_binary() const { return (kinds & binary) != 0; }
+            bool is_unary() const { return (kinds & unary) != 0; }
+            bool is_nular() const { return (kinds & nular) != 0; }
+        };
+    private:
+        std::vector<entry> m_entries;
+        std::vector<uint32_t> m_slots; // 0 = empty, otherwise index into m_entries + 1
+
+        static char lower(char c) { return (char)std::tolower((unsigned char)c); }
+        static size_t hash(std::string_view name)
+        {
+            // FNV-1a over the lowercase characters. Computed in 64 bits and folded,
+            // so 32 bit builds still get a well mixed slot index.
+            uint64_t h = 14695981039346656037ULL;
+            for (auto c : name)
+            {
+                h ^= static_cast<uint8_t>(lower(c));
+                h *= 1099511628211ULL;
+            }
+            return static_cast<size_t>(h ^ (h >> 32));
+        }
+        static bool equals(std::string_view name, std::string_view stored)
+        {
+            if (name.length() != stored.length())
+            {
+                return false;
+            }
+            for (size_t i = 0; i < name.length(); i++)
+            {
+                if (lower(name[i]) != stored[i])
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+        size_t slot_of(std::string_view name) const
+        {
+            auto mask = m_slots.size() - 1;
+            auto index = hash(name) & mask;
+            while (m_slots[index] != 0 && !equals(name, m_entries[m_slots[index] - 1].name))
+            {
+                index = (index + 1) & mask;
+            }
+            return index;
+        }
+    public:
+        sqfop_names() : m_slots(1, 0) {}
+
+        /// <summary>
+        /// Adds the kind to the provided name. Only to be used while building the table.
+        /// Names are expected to be lowercase, as that is how operators get looked up.
+        /// </summary>
+        void add(std::string_view name, kind k, short precedence = 0)
+        {
+            if ((m_entries.size() + 1) * 2 > m_slots.size())
+            {
+                m_slots.assign(m_slots.size() * 4, 0);
+                for (uint32_t i = 0; i < m_entries.size(); i++)
+                {
+                    m_slots[slot_of(m_entries[i].name)] = i + 1;
+                }
+            }
+            auto index = slot_of(name);
+            if (m_slots[index] == 0)
+            {
+                m_entries.push_back({ std::string(name), none, 0 });
+                m_slots[index] = static_cast<uint32_t>(m_entries.size());
+            }
+            auto& e = m_entries[m_slots[index] - 1];
+            e.kinds |= k;
+            if (k == binary)
+            {
+                e.precedence = precedence;
+            }
+        }
+
+        /// <summary>
+        /// Looks up the provided name, ignoring its casing.
+        /// </summary>
+        /// <returns>The entry or nullptr if no operator with that name exists.</returns>
+        const entry* find(std::string_view name) const
+        {
+            auto slot = m_slots[slot_of(name)];
+            return slot == 0 ? nullptr : &m_entries[slot - 1];
+        }
+
+        size_t size() const { return m_entries.size(); }
+    };
+}
@@ -68,5 +68,7 @@ namespace sqf::runtime
 
         std::unordered_map<std::string, sqf::runtime::value>::iterator begin() { return m_map.begin(); }
         std::unordered_map<std::string, sqf::runtime::value>::iterator end() { return m_map.end(); }
+        std::unordered_map<std::string, sqf::runtime::value>::const_iterator begin() const { return m_map.begin(); }
+        std::unordered_map<std::string, sqf::runtime::value>::const_iterator end() const { return m_map.end(); }
     };
 }
\ No newline at end of file
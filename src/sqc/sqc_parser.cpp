@@ -96,17 +96,29 @@ namespace sqf::sqc::util
     private:
         std::vector<::sqf::runtime::instruction::sptr> inner;
         std::vector<region_impl> regions;
-        std::string_view m_contents;
+        std::shared_ptr<const std::string> m_contents;
+        std::shared_ptr<const ::sqf::runtime::diagnostics::source_file> m_source;
+
+        ::sqf::runtime::diagnostics::source_location location(const ::sqf::sqc::tokenizer::token& t, size_t length)
+        {
+            if (!m_source || m_source->path().physical != t.path)
+            {
+                m_source = std::make_shared<::sqf::runtime::diagnostics::source_file>(::sqf::runtime::fileio::pathinfo{ t.path, {} }, m_contents);
+            }
+            return { m_source, t.line, t.column, t.offset, length };
+        }
     public:
-        setbuilder(std::string_view contents) : m_contents(contents) {}
+        setbuilder(std::shared_ptr<const std::string> contents) : m_contents(std::move(contents)) {}
 
         setbuilder create_from() const
         {
-            return { m_contents };
+            setbuilder builder(m_contents);
+            builder.m_source = m_source;
+            return builder;
         }
         void push_back(const ::sqf::sqc::tokenizer::token& t, ::sqf::runtime::instruction::sptr ptr, position pos = current)
         {
-            ptr->diag_info({ t.line, t.column, t.offset, { t.path, {} }, ::sqf::runtime::parser::sqf::create_code_segment(m_contents, t.offset, t.contents.length()) });
+            ptr->location(location(t, t.contents.length()));
             if (regions.empty())
             {
                 inner.push_back(ptr);
@@ -118,7 +130,7 @@ namespace sqf::sqc::util
         }
         void push_back(const ::sqf::sqc::tokenizer::token& t, size_t custom_length, ::sqf::runtime::instruction::sptr ptr, position pos = current)
         {
-            ptr->diag_info({ t.line, t.column, t.offset, { t.path, {} }, ::sqf::runtime::parser::sqf::create_code_segment(m_contents, t.offset, custom_length) });
+            ptr->location(location(t, custom_length));
             if (regions.empty())
             {
                 inner.push_back(ptr);
@@ -135,7 +147,7 @@ namespace sqf::sqc::util
     };
 }
 
-void sqf::sqc::parser::to_assembly(::sqf::runtime::runtime& runtime, util::setbuilder& set, std::vector<emplace>& locals, const ::sqf::sqc::bison::astnode& node)
+void sqf::sqc::parser::to_assembly(const context& context, util::setbuilder& set, std::vector<emplace>& locals, const ::sqf::sqc::bison::astnode& node)
 {
     util::setbuilder::position icpp_pos;
     float icpp_value;
@@ -150,20 +162,20 @@ void sqf::sqc::parser::to_assembly(::sqf::runtime::runtime& runtime, util::setbu
         else
         {
             util::setbuilder::region __region(set);
-            to_assembly(runtime, set, locals, node.children[0]);
+            to_assembly(context, set, locals, node.children[0]);
             set.push_back(node.token, std::make_shared<opcodes::push>(__scopename_function));
             set.push_back(node.token, std::make_shared<opcodes::call_binary>("breakout"s, (short)4));
         }
     } break;
     case ::sqf::sqc::bison::astkind::THROW: {
         util::setbuilder::region __region(set);
-        to_assembly(runtime, set, locals, node.children[0]);
+        to_assembly(context, set, locals, node.children[0]);
         set.push_back(node.token, std::make_shared<opcodes::call_unary>("throw"s));
     } break;
     case ::sqf::sqc::bison::astkind::ASSIGNMENT: {
         util::setbuilder::region __region(set);
         // Push Value
-        to_assembly(runtime, set, locals, node.children[1]);
+        to_assembly(context, set, locals, node.children[1]);
 
         // Assign Value
         std::string var(node.children[0].token.contents);
@@ -200,7 +212,7 @@ void sqf::sqc::parser::to_assembly(::sqf::runtime::runtime& runtime, util::setbu
         }
 
         // Push Right-Value
-        to_assembly(runtime, set, locals, node.children[1]);
+        to_assembly(context, set, locals, node.children[1]);
 
         switch (node.kind)
         {
@@ -238,13 +250,13 @@ void sqf::sqc::parser::to_assembly(::sqf::runtime::runtime& runtime, util::setbu
         // Handle OP_ARRAY_GET
         {
             // Push actual array onto value stack
-            to_assembly(runtime, set, locals, node.children[0].children[0]);
+            to_assembly(context, set, locals, node.children[0].children[0]);
 
             // Push Index-Expression to stack
-            to_assembly(runtime, set, locals, node.children[0].children[1]);
+            to_assembly(context, set, locals, node.children[0].children[1]);
         }
         // Push Value-Expression to stack
-        to_assembly(runtime, set, locals, node.children[1]);
+        to_assembly(context, set, locals, node.children[1]);
 
         // Emit "makeArray" instruction to craft the right-handed argument
         set.push_back(node.token, std::make_shared<opcodes::make_array>(2));
@@ -258,17 +270,17 @@ void sqf::sqc::parser::to_assembly(::sqf::runtime::runtime& runtime, util::setbu
     case ::sqf::sqc::bison::astkind::OP_ARRAY_SET_SLASH: {
         util::setbuilder::region __region(set);
         // Push actual array onto value stack (LEFT from set)
-        to_assembly(runtime, set, locals, node.children[0].children[0]);
+        to_assembly(context, set, locals, node.children[0].children[0]);
 
         { // RIGHT from set
             // Push Index-Expression to stack
-            to_assembly(runtime, set, locals, node.children[0].children[1]);
+            to_assembly(context, set, locals, node.children[0].children[1]);
 
             // Push actual value onto value stack (LEFT from op)
-            to_assembly(runtime, set, locals, node.children[0]);
+            to_assembly(context, set, locals, node.children[0]);
 
             // Push Value-Expression to stack (RIGHT from op)
-            to_assembly(runtime, set, locals, node.children[1]);
+            to_assembly(context, set, locals, node.children[1]);
             switch (node.kind)
             {
             case ::sqf::sqc::bison::astkind::ASSIGNMENT_PLUS:
@@ -297,17 +309,17 @@ void sqf::sqc::parser::to_assembly(::sqf::runtime::runtime& runtime, util::setbu
     } break;
     case ::sqf::sqc::bison::astkind::OP_ARRAY_GET: {
         // Push actual array onto value stack
-        to_assembly(runtime, set, locals, node.children[0]);
+        to_assembly(context, set, locals, node.children[0]);
 
         // Push Index-Expression to stack
-        to_assembly(runtime, set, locals, node.children[1]);
+        to_assembly(context, set, locals, node.children[1]);
 
         // Emit "select" to perform the array index access
         set.push_back(node.token, std::make_shared<opcodes::call_binary>("select"s, (short)4));
     } break;
     case ::sqf::sqc::bison::astkind::DECLARATION: {
         // Push assigned value
-        to_assembly(runtime, set, locals, node.children[1]);
+        to_assembly(context, set, locals, node.children[1]);
 
         // Assign variable
         std::string var(node.children[0].token.contents);
@@ -320,7 +332,7 @@ void sqf::sqc::parser::to_assembly(::sqf::runtime::runtime& runtime, util::setbu
     } break;
     case ::sqf::sqc::bison::astkind::FORWARD_DECLARATION: {
         // Push assigned value
-        to_assembly(runtime, set, locals, node.children[1]);
+        to_assembly(context, set, locals, node.children[1]);
 
         // Declare variable
         std::string var(node.children[0].token.contents);
@@ -338,7 +350,7 @@ void sqf::sqc::parser::to_assembly(::sqf::runtime::runtime& runtime, util::setbu
         local_set.push_back(node.token, std::make_shared<opcodes::push>(__scopename_function));
         local_set.push_back(node.token, std::make_shared<opcodes::call_unary>("scopename"));
 
-        to_assembly(runtime, local_set, new_locals, node.children[1]);
+        to_assembly(context, local_set, new_locals, node.children[1]);
         if (!node.children[2].children.empty())
         {
             auto& codeset = node.children[2];
@@ -350,12 +362,12 @@ void sqf::sqc::parser::to_assembly(::sqf::runtime::runtime& runtime, util::setbu
                 {
                     if (!it->children.empty())
                     {
-                        to_assembly(runtime, local_set, new_locals, it->children[0]);
+                        to_assembly(context, local_set, new_locals, it->children[0]);
                     }
                 }
                 else
                 {
-                    to_assembly(runtime, local_set, new_locals, *it);
+                    to_assembly(context, local_set, new_locals, *it);
                 }
             }
         }
@@ -368,7 +380,7 @@ void sqf::sqc::parser::to_assembly(::sqf::runtime::runtime& runtime, util::setbu
         local_set.push_back(node.token, std::make_shared<opcodes::push>(__scopename_function));
         local_set.push_back(node.token, std::make_shared<opcodes::call_unary>("scopename"));
 
-        to_assembly(runtime, local_set, new_locals, node.children[1]);
+        to_assembly(context, local_set, new_locals, node.children[1]);
         if (!node.children[2].children.empty())
         {
             auto& codeset = node.children[2];
@@ -380,12 +392,12 @@ void sqf::sqc::parser::to_assembly(::sqf::runtime::runtime& runtime, util::setbu
                 {
                     if (!it->children.empty())
                     {
-                        to_assembly(runtime, local_set, new_locals, it->children[0]);
+                        to_assembly(context, local_set, new_locals, it->children[0]);
                     }
                 }
                 else
                 {
-                    to_assembly(runtime, local_set, new_locals, *it);
+                    to_assembly(context, local_set, new_locals, *it);
                 }
             }
         }
@@ -406,7 +418,7 @@ void sqf::sqc::parser::to_assembly(::sqf::runtime::runtime& runtime, util::setbu
         local_set.push_back(node.token, std::make_shared<opcodes::push>(__scopename_function));
         local_set.push_back(node.token, std::make_shared<opcodes::call_unary>("scopename"));
 
-        to_assembly(runtime, local_set, new_locals, node.children[0]);
+        to_assembly(context, local_set, new_locals, node.children[0]);
         if (!node.children[1].children.empty())
         {
             auto& codeset = node.children[1];
@@ -418,12 +430,12 @@ void sqf::sqc::parser::to_assembly(::sqf::runtime::runtime& runtime, util::setbu
                 {
                     if (!it->children.empty())
                     {
-                        to_assembly(runtime, local_set, new_locals, it->children[0]);
+                        to_assembly(context, local_set, new_locals, it->children[0]);
                     }
                 }
                 else
                 {
-                    to_assembly(runtime, local_set, new_locals, *it);
+                    to_assembly(context, local_set, new_locals, *it);
                 }
             }
         }
@@ -454,7 +466,7 @@ void sqf::sqc::parser::to_assembly(::sqf::runtime::runtime& runtime, util::setbu
                 case ::sqf::sqc::bison::astkind::ARGITEM: { /* do nothing as we are already done */ } break;
                 case ::sqf::sqc::bison::astkind::ARGITEM_DEFAULT: {
                     // push default value
-                    to_assembly(runtime, set, locals, child.children[0]);
+                    to_assembly(context, set, locals, child.children[0]);
 
                     // Make array 
                     set.push_back(node.token, std::make_shared<opcodes::make_array>(2));
@@ -497,7 +509,7 @@ void sqf::sqc::parser::to_assembly(::sqf::runtime::runtime& runtime, util::setbu
                 } break;
                 case ::sqf::sqc::bison::astkind::ARGITEM_TYPE_DEFAULT: {
                     // push default value
-                    to_assembly(runtime, set, locals, child.children[1]);
+                    to_assembly(context, set, locals, child.children[1]);
 
                     // Check most common data-types & push default type of it
                     auto dataType = std::string(child.children[0].token.contents);
@@ -547,17 +559,17 @@ void sqf::sqc::parser::to_assembly(::sqf::runtime::runtime& runtime, util::setbu
         for (auto child : node.children)
         {
             util::setbuilder::region __region(set);
-            to_assembly(runtime, set, locals_copy, child);
+            to_assembly(context, set, locals_copy, child);
         }
     } break;
     case ::sqf::sqc::bison::astkind::IF: {
         util::setbuilder::region __region(set);
         // Emit condition
-        to_assembly(runtime, set, locals, node.children[0]);
+        to_assembly(context, set, locals, node.children[0]);
         set.push_back(node.children[0].token, std::make_shared<opcodes::call_unary>("if"s));
 
         auto local_set = set.create_from();
-        to_assembly(runtime, local_set, locals, node.children[1]);
+        to_assembly(context, local_set, locals, node.children[1]);
         set.push_back(node.children[1].token, std::make_shared<opcodes::push>(runtime::instruction_set{ local_set }));
 
         set.push_back(node.token, std::make_shared<opcodes::call_binary>("then"s, (short)4));
@@ -566,17 +578,17 @@ void sqf::sqc::parser::to_assembly(::sqf::runtime::runtime& runtime, util::setbu
     case ::sqf::sqc::bison::astkind::IFELSE: {
         util::setbuilder::region __region(set);
         // Emit condition
-        to_assembly(runtime, set, locals, node.children[0]);
+        to_assembly(context, set, locals, node.children[0]);
         set.push_back(node.children[0].token, std::make_shared<opcodes::call_unary>("if"s));
 
         // Emit on-true
         auto local_set1 = set.create_from();
-        to_assembly(runtime, local_set1, locals, node.children[1]);
+        to_assembly(context, local_set1, locals, node.children[1]);
         set.push_back(node.children[1].token, std::make_shared<opcodes::push>(runtime::instruction_set{ local_set1 }));
 
         // Emit on-false
         auto local_set2 = set.create_from();
-        to_assembly(runtime, local_set2, locals, node.children[2]);
+        to_assembly(context, local_set2, locals, node.children[2]);
         set.push_back(node.children[2].token, std::make_shared<opcodes::push>(runtime::instruction_set{ local_set2 }));
         set.push_back(node.children[2].token, std::make_shared<opcodes::call_binary>("else"s, (short)5));
 
@@ -592,11 +604,11 @@ void sqf::sqc::parser::to_assembly(::sqf::runtime::runtime& runtime, util::setbu
         set.push_back(node.children[0].token, std::make_shared<opcodes::call_unary>("for"s));
 
         // Emit "from"
-        to_assembly(runtime, set, locals, node.children[1]);
+        to_assembly(context, set, locals, node.children[1]);
         set.push_back(node.children[1].token, std::make_shared<opcodes::call_binary>("from"s, (short)4));
 
         // Emit "to"
-        to_assembly(runtime, set, locals, node.children[2]);
+        to_assembly(context, set, locals, node.children[2]);
         set.push_back(node.children[2].token, std::make_shared<opcodes::call_binary>("to"s, (short)4));
 
         // Emit Codeblock
@@ -609,7 +621,7 @@ void sqf::sqc::parser::to_assembly(::sqf::runtime::runtime& runtime, util::setbu
             locals_copy.push_back({ var ,lvar });
 
             // Fill actual instruction_set
-            to_assembly(runtime, local_set1, locals_copy, node.children[3]);
+            to_assembly(context, local_set1, locals_copy, node.children[3]);
             set.push_back(node.children[3].token, std::make_shared<opcodes::push>(runtime::instruction_set{ local_set1 }));
         }
 
@@ -625,15 +637,15 @@ void sqf::sqc::parser::to_assembly(::sqf::runtime::runtime& runtime, util::setbu
         set.push_back(node.children[0].token, std::make_shared<opcodes::call_unary>("for"s));
 
         // Emit "from"
-        to_assembly(runtime, set, locals, node.children[1]);
+        to_assembly(context, set, locals, node.children[1]);
         set.push_back(node.children[1].token, std::make_shared<opcodes::call_binary>("from"s, (short)4));
 
         // Emit "to"
-        to_assembly(runtime, set, locals, node.children[2]);
+        to_assembly(context, set, locals, node.children[2]);
         set.push_back(node.children[2].token, std::make_shared<opcodes::call_binary>("to"s, (short)4));
 
         // Emit "step"
-        to_assembly(runtime, set, locals, node.children[3]);
+        to_assembly(context, set, locals, node.children[3]);
         set.push_back(node.children[3].token, std::make_shared<opcodes::call_binary>("step"s, (short)4));
 
         // Emit Codeblock
@@ -646,7 +658,7 @@ void sqf::sqc::parser::to_assembly(::sqf::runtime::runtime& runtime, util::setbu
             locals_copy.push_back({ var ,lvar });
 
             // Fill actual instruction_set
-            to_assembly(runtime, local_set1, locals_copy, node.children[4]);
+            to_assembly(context, local_set1, locals_copy, node.children[4]);
             set.push_back(node.children[4].token, std::make_shared<opcodes::push>(runtime::instruction_set{ local_set1 }));
         }
 
@@ -669,11 +681,11 @@ void sqf::sqc::parser::to_assembly(::sqf::runtime::runtime& runtime, util::setbu
             locals_copy.push_back({ var ,lvar });
 
             // Fill actual instruction_set
-            to_assembly(runtime, local_set1, locals_copy, node.children[2]);
+            to_assembly(context, local_set1, locals_copy, node.children[2]);
             set.push_back(node.children[2].token, std::make_shared<opcodes::push>(runtime::instruction_set{ local_set1 }));
         }
         // Emit value
-        to_assembly(runtime, set, locals, node.children[1]);
+        to_assembly(context, set, locals, node.children[1]);
 
         // Emit "forEach"
         set.push_back(node.token, std::make_shared<opcodes::call_binary>("foreach"s, (short)4));
@@ -686,7 +698,7 @@ void sqf::sqc::parser::to_assembly(::sqf::runtime::runtime& runtime, util::setbu
             auto local_set1 = set.create_from();
 
             // Fill actual instruction_set for code
-            to_assembly(runtime, local_set1, locals, node.children[0]);
+            to_assembly(context, local_set1, locals, node.children[0]);
             set.push_back(node.children[0].token, std::make_shared<opcodes::push>(runtime::instruction_set{ local_set1 }));
         }
         set.push_back(node.token, std::make_shared<opcodes::call_binary>("while"s, (short)4));
@@ -697,7 +709,7 @@ void sqf::sqc::parser::to_assembly(::sqf::runtime::runtime& runtime, util::setbu
             auto local_set1 = set.create_from();
 
             // Fill actual instruction_set for code
-            to_assembly(runtime, local_set1, locals, node.children[1]);
+            to_assembly(context, local_set1, locals, node.children[1]);
             set.push_back(node.children[1].token, std::make_shared<opcodes::push>(runtime::instruction_set{ local_set1 }));
         }
 
@@ -712,7 +724,7 @@ void sqf::sqc::parser::to_assembly(::sqf::runtime::runtime& runtime, util::setbu
             auto local_set1 = set.create_from();
 
             // Fill actual instruction_set for code
-            to_assembly(runtime, local_set1, locals, node.children[0]);
+            to_assembly(context, local_set1, locals, node.children[0]);
             set.push_back(node.children[0].token, std::make_shared<opcodes::push>(runtime::instruction_set{ local_set1 }));
 
             // Use unary call to call created scope
@@ -725,7 +737,7 @@ void sqf::sqc::parser::to_assembly(::sqf::runtime::runtime& runtime, util::setbu
             auto local_set1 = set.create_from();
 
             // Fill actual instruction_set for code
-            to_assembly(runtime, local_set1, locals, node.children[1]);
+            to_assembly(context, local_set1, locals, node.children[1]);
             set.push_back(node.children[1].token, std::make_shared<opcodes::push>(runtime::instruction_set{ local_set1 }));
         }
         set.push_back(node.children[1].token, std::make_shared<opcodes::call_binary>("while"s, (short)4));
@@ -736,7 +748,7 @@ void sqf::sqc::parser::to_assembly(::sqf::runtime::runtime& runtime, util::setbu
             auto local_set1 = set.create_from();
 
             // Fill actual instruction_set for code
-            to_assembly(runtime, local_set1, locals, node.children[0]);
+            to_assembly(context, local_set1, locals, node.children[0]);
             set.push_back(node.children[0].token, std::make_shared<opcodes::push>(runtime::instruction_set{ local_set1 }));
         }
 
@@ -750,7 +762,7 @@ void sqf::sqc::parser::to_assembly(::sqf::runtime::runtime& runtime, util::setbu
             auto local_set1 = set.create_from();
 
             // Fill actual instruction_set for code
-            to_assembly(runtime, local_set1, locals, node.children[0]);
+            to_assembly(context, local_set1, locals, node.children[0]);
             set.push_back(node.children[0].token, std::make_shared<opcodes::push>(runtime::instruction_set{ local_set1 }));
 
             // Use unary call to call created scope
@@ -774,7 +786,7 @@ void sqf::sqc::parser::to_assembly(::sqf::runtime::runtime& runtime, util::setbu
             locals_copy.push_back({ var ,lvar });
 
             // Fill actual instruction_set for code
-            to_assembly(runtime, local_set1, locals, node.children[1]);
+            to_assembly(context, local_set1, locals, node.children[1]);
             set.push_back(node.children[1].token, std::make_shared<opcodes::push>(runtime::instruction_set{ local_set1 }));
         }
         set.push_back(node.children[1].token, std::make_shared<opcodes::call_binary>("catch"s, (short)4));
@@ -782,7 +794,7 @@ void sqf::sqc::parser::to_assembly(::sqf::runtime::runtime& runtime, util::setbu
     case ::sqf::sqc::bison::astkind::SWITCH: {
         util::setbuilder::region __region(set);
         // Emit switch
-        to_assembly(runtime, set, locals, node.children[0]);
+        to_assembly(context, set, locals, node.children[0]);
         set.push_back(node.children[0].token, std::make_shared<opcodes::call_unary>("switch"s));
 
         // Emit "do switch"
@@ -793,7 +805,7 @@ void sqf::sqc::parser::to_assembly(::sqf::runtime::runtime& runtime, util::setbu
             // Fill actual instruction_set with cases
             for (auto it = node.children.begin() + 1; it != node.children.end(); it++)
             {
-                to_assembly(runtime, local_set1, locals, *it);
+                to_assembly(context, local_set1, locals, *it);
             }
             set.push_back(node.token, std::make_shared<opcodes::push>(runtime::instruction_set{ local_set1 }));
 
@@ -804,7 +816,7 @@ void sqf::sqc::parser::to_assembly(::sqf::runtime::runtime& runtime, util::setbu
     case ::sqf::sqc::bison::astkind::CASE: {
         util::setbuilder::region __region(set);
         // Emit "case"
-        to_assembly(runtime, set, locals, node.children[0]);
+        to_assembly(context, set, locals, node.children[0]);
         set.push_back(node.children[0].token, std::make_shared<opcodes::call_unary>("case"s));
 
         // If has codeblock, emit ":"
@@ -813,7 +825,7 @@ void sqf::sqc::parser::to_assembly(::sqf::runtime::runtime& runtime, util::setbu
             auto local_set1 = set.create_from();
 
             // Fill actual instruction_set for code
-            to_assembly(runtime, local_set1, locals, node.children[1]);
+            to_assembly(context, local_set1, locals, node.children[1]);
             set.push_back(node.children[1].token, std::make_shared<opcodes::push>(runtime::instruction_set{ local_set1 }));
 
             // Emit "colon"
@@ -825,7 +837,7 @@ void sqf::sqc::parser::to_assembly(::sqf::runtime::runtime& runtime, util::setbu
         auto local_set1 = set.create_from();
 
         // Fill actual instruction_set for code
-        to_assembly(runtime, local_set1, locals, node.children[0]);
+        to_assembly(context, local_set1, locals, node.children[0]);
         set.push_back(node.children[0].token, std::make_shared<opcodes::push>(runtime::instruction_set{ local_set1 }));
 
         // Emit "default"
@@ -833,45 +845,45 @@ void sqf::sqc::parser::to_assembly(::sqf::runtime::runtime& runtime, util::setbu
     } break;
     case ::sqf::sqc::bison::astkind::OP_OR: {
         // Emit Left-Argument
-        to_assembly(runtime, set, locals, node.children[0]);
+        to_assembly(context, set, locals, node.children[0]);
         // Emit Right-Argument
-        to_assembly(runtime, set, locals, node.children[1]);
+        to_assembly(context, set, locals, node.children[1]);
 
         // Emit "or"
         set.push_back(node.token, std::make_shared<opcodes::call_binary>("||"s, (short)1));
     } break;
     case ::sqf::sqc::bison::astkind::OP_AND: {
         // Emit Left-Argument
-        to_assembly(runtime, set, locals, node.children[0]);
+        to_assembly(context, set, locals, node.children[0]);
         // Emit Right-Argument
-        to_assembly(runtime, set, locals, node.children[1]);
+        to_assembly(context, set, locals, node.children[1]);
 
         // Emit "and"
         set.push_back(node.token, std::make_shared<opcodes::call_binary>("&&"s, (short)2));
     } break;
     case ::sqf::sqc::bison::astkind::OP_EQUALEXACT: {
         // Emit Left-Argument
-        to_assembly(runtime, set, locals, node.children[0]);
+        to_assembly(context, set, locals, node.children[0]);
         // Emit Right-Argument
-        to_assembly(runtime, set, locals, node.children[1]);
+        to_assembly(context, set, locals, node.children[1]);
 
         // Emit "==="
         set.push_back(node.token, std::make_shared<opcodes::call_binary>("isequalto"s, (short)4));
     } break;
     case ::sqf::sqc::bison::astkind::OP_EQUAL: {
         // Emit Left-Argument
-        to_assembly(runtime, set, locals, node.children[0]);
+        to_assembly(context, set, locals, node.children[0]);
         // Emit Right-Argument
-        to_assembly(runtime, set, locals, node.children[1]);
+        to_assembly(context, set, locals, node.children[1]);
 
         // Emit "=="
         set.push_back(node.token, std::make_shared<opcodes::call_binary>("=="s, (short)3));
     } break;
     case ::sqf::sqc::bison::astkind::OP_NOTEQUALEXACT: {
         // Emit Left-Argument
-        to_assembly(runtime, set, locals, node.children[0]);
+        to_assembly(context, set, locals, node.children[0]);
         // Emit Right-Argument
-        to_assembly(runtime, set, locals, node.children[1]);
+        to_assembly(context, set, locals, node.children[1]);
 
         // Emit "!=="
         set.push_back(node.token, std::make_shared<opcodes::call_binary>("isequalto"s, (short)4));
@@ -879,139 +891,135 @@ void sqf::sqc::parser::to_assembly(::sqf::runtime::runtime& runtime, util::setbu
     } break;
     case ::sqf::sqc::bison::astkind::OP_NOTEQUAL: {
         // Emit Left-Argument
-        to_assembly(runtime, set, locals, node.children[0]);
+        to_assembly(context, set, locals, node.children[0]);
         // Emit Right-Argument
-        to_assembly(runtime, set, locals, node.children[1]);
+        to_assembly(context, set, locals, node.children[1]);
 
         // Emit "!="
         set.push_back(node.token, std::make_shared<opcodes::call_binary>("!="s, (short)3));
     } break;
     case ::sqf::sqc::bison::astkind::OP_LESSTHAN: {
         // Emit Left-Argument
-        to_assembly(runtime, set, locals, node.children[0]);
+        to_assembly(context, set, locals, node.children[0]);
         // Emit Right-Argument
-        to_assembly(runtime, set, locals, node.children[1]);
+        to_assembly(context, set, locals, node.children[1]);
 
         // Emit "<"
         set.push_back(node.token, std::make_shared<opcodes::call_binary>("<"s, (short)3));
     } break;
     case ::sqf::sqc::bison::astkind::OP_GREATERTHAN: {
         // Emit Left-Argument
-        to_assembly(runtime, set, locals, node.children[0]);
+        to_assembly(context, set, locals, node.children[0]);
         // Emit Right-Argument
-        to_assembly(runtime, set, locals, node.children[1]);
+        to_assembly(context, set, locals, node.children[1]);
 
         // Emit ">"
         set.push_back(node.token, std::make_shared<opcodes::call_binary>(">"s, (short)3));
     } break;
     case ::sqf::sqc::bison::astkind::OP_LESSTHANEQUAL: {
         // Emit Left-Argument
-        to_assembly(runtime, set, locals, node.children[0]);
+        to_assembly(context, set, locals, node.children[0]);
         // Emit Right-Argument
-        to_assembly(runtime, set, locals, node.children[1]);
+        to_assembly(context, set, locals, node.children[1]);
 
         // Emit "<="
         set.push_back(node.token, std::make_shared<opcodes::call_binary>("<="s, (short)3));
     } break;
     case ::sqf::sqc::bison::astkind::OP_GREATERTHANEQUAL: {
         // Emit Left-Argument
-        to_assembly(runtime, set, locals, node.children[0]);
+        to_assembly(context, set, locals, node.children[0]);
         // Emit Right-Argument
-        to_assembly(runtime, set, locals, node.children[1]);
+        to_assembly(context, set, locals, node.children[1]);
 
         // Emit ">="
         set.push_back(node.token, std::make_shared<opcodes::call_binary>(">="s, (short)3));
     } break;
     case ::sqf::sqc::bison::astkind::OP_PLUS: {
         // Emit Left-Argument
-        to_assembly(runtime, set, locals, node.children[0]);
+        to_assembly(context, set, locals, node.children[0]);
         // Emit Right-Argument
-        to_assembly(runtime, set, locals, node.children[1]);
+        to_assembly(context, set, locals, node.children[1]);
 
         // Emit "+"
         set.push_back(node.token, std::make_shared<opcodes::call_binary>("+"s, (short)6));
     } break;
     case ::sqf::sqc::bison::astkind::OP_MINUS: {
         // Emit Left-Argument
-        to_assembly(runtime, set, locals, node.children[0]);
+        to_assembly(context, set, locals, node.children[0]);
         // Emit Right-Argument
-        to_assembly(runtime, set, locals, node.children[1]);
+        to_assembly(context, set, locals, node.children[1]);
 
         // Emit "-"
         set.push_back(node.token, std::make_shared<opcodes::call_binary>("-"s, (short)6));
     } break;
     case ::sqf::sqc::bison::astkind::OP_MULTIPLY: {
         // Emit Left-Argument
-        to_assembly(runtime, set, locals, node.children[0]);
+        to_assembly(context, set, locals, node.children[0]);
         // Emit Right-Argument
-        to_assembly(runtime, set, locals, node.children[1]);
+        to_assembly(context, set, locals, node.children[1]);
 
         // Emit "*"
         set.push_back(node.token, std::make_shared<opcodes::call_binary>("*"s, (short)7));
     } break;
     case ::sqf::sqc::bison::astkind::OP_DIVIDE: {
         // Emit Left-Argument
-        to_assembly(runtime, set, locals, node.children[0]);
+        to_assembly(context, set, locals, node.children[0]);
         // Emit Right-Argument
-        to_assembly(runtime, set, locals, node.children[1]);
+        to_assembly(context, set, locals, node.children[1]);
 
         // Emit "/"
         set.push_back(node.token, std::make_shared<opcodes::call_binary>("/"s, (short)7));
     } break;
     case ::sqf::sqc::bison::astkind::OP_REMAINDER: {
         // Emit Left-Argument
-        to_assembly(runtime, set, locals, node.children[0]);
+        to_assembly(context, set, locals, node.children[0]);
         // Emit Right-Argument
-        to_assembly(runtime, set, locals, node.children[1]);
+        to_assembly(context, set, locals, node.children[1]);
 
         // Emit "%"
         set.push_back(node.token, std::make_shared<opcodes::call_binary>("%"s, (short)7));
     } break;
     case ::sqf::sqc::bison::astkind::OP_NOT: {
         // Emit Left-Argument
-        to_assembly(runtime, set, locals, node.children[0]);
+        to_assembly(context, set, locals, node.children[0]);
 
         // Emit "!"
         set.push_back(node.token, std::make_shared<opcodes::call_unary>("!"s));
     } break;
     case ::sqf::sqc::bison::astkind::OP_BINARY: {
-        auto opname = std::string(node.children[1].token.contents);
-        std::transform(opname.begin(), opname.end(), opname.begin(), [](char c) { return (char)std::tolower(c); });
-        if (runtime.sqfop_exists_binary(opname))
+        // The operator table ignores casing and is fetched once per parse, thus lookups do not allocate.
+        auto opname = node.children[1].token.contents;
+        auto entry = context.operators->find(opname);
+        if (entry && entry->is_binary())
         {
             // Emit Left-Argument
-            to_assembly(runtime, set, locals, node.children[0]);
-
-            auto matchingOps = runtime.sqfop_binary_by_name(opname);
+            to_assembly(context, set, locals, node.children[0]);
 
             if (node.children[2].children.size() > 1)
             {
                 // Emit Right-Argument
-                to_assembly(runtime, set, locals, node.children[2]);
+                to_assembly(context, set, locals, node.children[2]);
                 set.push_back(node.children[2].token, std::make_shared<opcodes::make_array>(std::max(node.children[2].children.size(), (size_t)1)));
             }
             else
             {
                 // Emit Right-Argument
-                to_assembly(runtime, set, locals, node.children[2]);
+                to_assembly(context, set, locals, node.children[2]);
             }
 
             // Emit binary operator
-            set.push_back(node.token, std::make_shared<opcodes::call_binary>(std::string(matchingOps.front().get().name()), matchingOps.front().get().precedence()));
+            set.push_back(node.token, std::make_shared<opcodes::call_binary>(entry->name, entry->precedence));
         }
         else
         {
-            log(logmessage::runtime::ErrorMessage({}, "SQC", "unknown operator: " + opname));
+            log(logmessage::runtime::ErrorMessage({}, "SQC", "unknown operator: " + std::string(opname)));
             set.push_back(node.token, std::make_shared<opcodes::call_nular>("nil"s));
         }
     } break;
     case ::sqf::sqc::bison::astkind::OP_UNARY: {
-        auto opname = std::string(node.children[0].token.contents);
-        std::transform(opname.begin(), opname.end(), opname.begin(), [](char c) { return std::tolower(c); });
-        if (runtime.sqfop_exists_unary(opname))
+        auto entry = context.operators->find(node.children[0].token.contents);
+        if (entry && entry->is_unary())
         {
-            auto matchingOps = runtime.sqfop_unary_by_name(opname);
-
             if (node.children.size() == 1)
             {
                 log(logmessage::assembly::ExpectedPush({}));
@@ -1022,18 +1030,18 @@ void sqf::sqc::parser::to_assembly(::sqf::runtime::runtime& runtime, util::setbu
                 if (node.children[1].children.size() > 1)
                 { // No arg provided
                     // Emit Right-Argument
-                    to_assembly(runtime, set, locals, node.children[1]);
+                    to_assembly(context, set, locals, node.children[1]);
                     set.push_back(node.children[1].token, std::make_shared<opcodes::make_array>(std::max(node.children[1].children.size(), (size_t)1)));
                 }
                 else
                 {
                     // Emit Right-Argument
-                    to_assembly(runtime, set, locals, node.children[1]);
+                    to_assembly(context, set, locals, node.children[1]);
                 }
             }
 
             // Emit binary operator
-            set.push_back(node.token, std::make_shared<opcodes::call_unary>(std::string(matchingOps.front().get().name())));
+            set.push_back(node.token, std::make_shared<opcodes::call_unary>(entry->name));
         }
         else
         {
@@ -1044,7 +1052,7 @@ void sqf::sqc::parser::to_assembly(::sqf::runtime::runtime& runtime, util::setbu
             }
             else
             {
-                to_assembly(runtime, set, locals, node.children[1]);
+                to_assembly(context, set, locals, node.children[1]);
                 set.push_back(node.token, std::make_shared<opcodes::make_array>(std::max(node.children[1].children.size(), (size_t)1)));
             }
 
@@ -1070,7 +1078,7 @@ void sqf::sqc::parser::to_assembly(::sqf::runtime::runtime& runtime, util::setbu
     case ::sqf::sqc::bison::astkind::VAL_ARRAY: {
         for (auto child : node.children)
         {
-            to_assembly(runtime, set, locals, child);
+            to_assembly(context, set, locals, child);
         }
         set.push_back(node.token, std::make_shared<opcodes::make_array>(node.children.size()));
     } break;
@@ -1114,7 +1122,7 @@ void sqf::sqc::parser::to_assembly(::sqf::runtime::runtime& runtime, util::setbu
         {
             set.push_back(node.token, std::make_shared<opcodes::get_variable>(fres->replace));
         }
-        else if (runtime.sqfop_exists(::sqf::runtime::sqfop_nular::key{ var }))
+        else if (auto entry = context.operators->find(var); entry && entry->is_nular())
         {
             set.push_back(node.token, std::make_shared<opcodes::call_nular>(var));
         }
@@ -1167,7 +1175,7 @@ void sqf::sqc::parser::to_assembly(::sqf::runtime::runtime& runtime, util::setbu
                 case tokenizer::etoken::t_formatted_string_final:
                     break;
                 default:
-                    to_assembly(runtime, set, locals, child);
+                    to_assembly(context, set, locals, child);
                 }
             }
             // Emit "makearray"
@@ -1238,36 +1246,48 @@ void sqf::sqc::parser::to_assembly(::sqf::runtime::runtime& runtime, util::setbu
             }
         }
         // Emit the Get-Variable
-        to_assembly(runtime, set, locals, node.children[0]);
+        to_assembly(context, set, locals, node.children[0]);
     } break;
     case ::sqf::sqc::bison::astkind::STATEMENTS: {
         for (const auto& child : node.children)
         {
             util::setbuilder::region __region(set);
-            to_assembly(runtime, set, locals, child);
+            to_assembly(context, set, locals, child);
         }
     } break;
     default: {
         for (const auto& child : node.children)
         {
-            to_assembly(runtime, set, locals, child);
+            to_assembly(context, set, locals, child);
         }
     } break;
     }
 }
 
-bool sqf::sqc::parser::check_syntax(::sqf::runtime::runtime& runtime, std::string contents, ::sqf::runtime::fileio::pathinfo file)
+bool sqf::sqc::parser::check_syntax(const context& context, std::string contents, ::sqf::runtime::fileio::pathinfo file)
 {
+    if (context.logger && context.logger != &get_logger())
+    {
+        // The parser holds no state besides its logger, thus a temporary one reports to the requested logger.
+        parser local(*context.logger);
+        return local.check_syntax({ context.operators, nullptr }, std::move(contents), std::move(file));
+    }
     tokenizer t(contents.begin(), contents.end(), file.physical);
     ::sqf::sqc::bison::astnode res;
     ::sqf::sqc::bison::parser p(t, res, *this, file.physical);
     bool success = p.parse() == 0;
     return success;
 }
-std::optional<::sqf::runtime::instruction_set> sqf::sqc::parser::parse(::sqf::runtime::runtime& runtime, std::string contents, ::sqf::runtime::fileio::pathinfo file)
+std::optional<::sqf::runtime::instruction_set> sqf::sqc::parser::parse(const context& context, std::string contents, ::sqf::runtime::fileio::pathinfo file)
 {
+    if (context.logger && context.logger != &get_logger())
+    {
+        parser local(*context.logger);
+        return local.parse({ context.operators, nullptr }, std::move(contents), std::move(file));
+    }
     tokenizer t(contents.begin(), contents.end(), file.physical);
-    util::setbuilder set(contents);
+    // Copied, as the instructions keep the contents alive for creating code segments on demand.
+    util::setbuilder set(std::make_shared<const std::string>(contents));
     ::sqf::sqc::bison::astnode res;
     ::sqf::sqc::bison::parser p(t, res, *this, file.physical);
     // p.set_debug_level(1);
@@ -1280,6 +1300,6 @@ std::optional<::sqf::runtime::instruction_set> sqf::sqc::parser::parse(::sqf::ru
     set.push_back({}, std::make_shared<opcodes::push>(__scopename_function));
     set.push_back({}, std::make_shared<opcodes::call_unary>("scopename"));
     set.push_back({}, std::make_shared<opcodes::end_statement>());
-    to_assembly(runtime, set, locals, res);
+    to_assembly(context, set, locals, res);
     return set;
 }
\ No newline at end of file
@@ -30,7 +30,7 @@ namespace sqf::sqc
             std::string replace;
         };
         constexpr static const char* __scopename_function = "___sqc_func";
-        void to_assembly(::sqf::runtime::runtime& runtime, util::setbuilder& set, std::vector<emplace>& locals, const ::sqf::sqc::bison::astnode& current_node);
+        void to_assembly(const context& context, util::setbuilder& set, std::vector<emplace>& locals, const ::sqf::sqc::bison::astnode& current_node);
     public:
         parser(Logger& logger) : CanLog(logger)
         {
@@ -39,8 +39,10 @@ namespace sqf::sqc
         {
             log(msg);
         }
+        using ::sqf::runtime::parser::sqf::check_syntax;
+        using ::sqf::runtime::parser::sqf::parse;
         virtual ~parser() override { };
-        virtual bool check_syntax(::sqf::runtime::runtime& runtime, std::string contents, ::sqf::runtime::fileio::pathinfo file) override;
-        virtual std::optional<::sqf::runtime::instruction_set> parse(::sqf::runtime::runtime& runtime, std::string contents, ::sqf::runtime::fileio::pathinfo file) override;
+        virtual bool check_syntax(const context& context, std::string contents, ::sqf::runtime::fileio::pathinfo file) override;
+        virtual std::optional<::sqf::runtime::instruction_set> parse(const context& context, std::string contents, ::sqf::runtime::fileio::pathinfo file) override;
     };
 }
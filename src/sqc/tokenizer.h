@@ -1,5 +1,6 @@
 #pragma once
 #include "../runtime/util.h"
+#include "../parser/scan.h"
 #include <array>
 #include <string>
 #include <string_view>
@@ -105,12 +106,18 @@ namespace sqf::sqc
         iterator m_start;
         iterator m_current;
         iterator m_end;
+        // Raw pointers matching m_start and m_end, used for the scan kernels.
+        const char* m_data;
+        const char* m_data_end;
         std::string m_path;
         emode m_mode;
 
         size_t m_line;
         size_t m_column;
 
+        const char* ptr(iterator it) const { return m_data + (it - m_start); }
+        iterator iter(const char* p) const { return m_start + (p - m_data); }
+
         template<typename = void>
         inline bool is_match(char value) { return false; }
         template<char TArg, char ... TArgs>
@@ -143,7 +150,12 @@ namespace sqf::sqc
         {
             auto it = start;
             auto len = ::sqf::runtime::util::strlen(against);
-            for (size_t i = 0; i < len && it < m_end; i++, ++it)
+            if (static_cast<size_t>(m_end - start) < len)
+            {
+                // A prefix at the very end of the input is no match.
+                return 0;
+            }
+            for (size_t i = 0; i < len; i++, ++it)
             {
                 if ((char)std::tolower(*it) != against[i]) { return 0; }
             }
@@ -153,7 +165,12 @@ namespace sqf::sqc
         {
             auto it = start;
             auto len = ::sqf::runtime::util::strlen(against);
-            for (size_t i = 0; i < len && it < m_end; i++, ++it)
+            if (static_cast<size_t>(m_end - start) < len)
+            {
+                // A prefix at the very end of the input is no match.
+                return 0;
+            }
+            for (size_t i = 0; i < len; i++, ++it)
             {
                 if ((char)std::tolower(*it) != against[i]) { return 0; }
             }
@@ -164,6 +181,34 @@ namespace sqf::sqc
             return it - start;
         }
 
+        // Skips string contents up to the first of TSpecial that is not doubled, updating the position info.
+        // A doubled character counts as a single column. With TExactPair, a run of more than two
+        // special characters is not considered doubled.
+        // Returns the iterator pointing to the special character found or m_end.
+        template<bool TExactPair, char ... TSpecial>
+        iterator skip_string_contents(iterator iter)
+        {
+            auto it = ptr(iter);
+            while (true)
+            {
+                auto special = ::sqf::parser::scan::find_first_of<TSpecial...>(it, m_data_end);
+                ::sqf::parser::scan::advance(it, special, m_line, m_column);
+                if (special == m_data_end)
+                {
+                    m_column++;
+                    return m_end;
+                }
+                auto run = special + 1;
+                while (run < m_data_end && *run == *special && (TExactPair || run - special < 2)) { ++run; }
+                if (run - special != 2)
+                {
+                    return this->iter(special);
+                }
+                m_column++;
+                it = run;
+            }
+        }
+
         token try_match(std::initializer_list<etoken> tokens)
         {
             token t = create_token();
@@ -209,7 +254,7 @@ namespace sqf::sqc
                     if (is_match_repeated<2, '/'>(iter))
                     {
                         // find line comment end
-                        while (!is_match<'\n'>(++iter));
+                        iter = this->iter(::sqf::parser::scan::find_first_of<'\n'>(ptr(iter + 1), m_data_end));
 
                         // update position info
                         m_line++;
@@ -226,20 +271,15 @@ namespace sqf::sqc
                         ++iter;
                         ++iter;
                         // find block comment end
-                        while (!(is_match<'*'>(iter) && is_match<'/'>(iter + 1)))
+                        auto start = ptr(iter);
+                        auto it = start;
+                        while ((it = ::sqf::parser::scan::find_first_of<'*'>(it, m_data_end)) != m_data_end && !(it + 1 < m_data_end && it[1] == '/'))
                         {
-                            // update position info
-                            if (!is_match<'\n'>(iter))
-                            {
-                                m_column++;
-                            }
-                            else
-                            {
-                                m_line++;
-                                m_column = 0;
-                            }
-                            ++iter;
+                            ++it;
                         }
+                        // update position info
+                        ::sqf::parser::scan::advance(start, it, m_line, m_column);
+                        iter = this->iter(it);
 
                         // EOF check
                         if (is_match<'/'>(iter) && is_match<'/'>(iter + 1))
@@ -252,20 +292,11 @@ namespace sqf::sqc
                     }
                 } break;
                 case etoken::i_whitespace: {
-                    while (is_match<' ', '\n', '\r', '\t'>(iter))
-                    {
-                        // update position info
-                        if (!is_match<'\n'>(iter))
-                        {
-                            m_column++;
-                        }
-                        else
-                        {
-                            m_line++;
-                            m_column = 0;
-                        }
-                        ++iter;
-                    }
+                    auto start = ptr(iter);
+                    auto it = ::sqf::parser::scan::skip_whitespace(start, m_data_end);
+                    // update position info
+                    ::sqf::parser::scan::advance(start, it, m_line, m_column);
+                    iter = this->iter(it);
                     // set length
                     len = iter - m_current;
                 } break;
@@ -334,36 +365,10 @@ namespace sqf::sqc
                 case etoken::t_string: {
                     ++iter;
                     // find string end
-                    while (true)
+                    iter = skip_string_contents<false, '"'>(iter);
+                    if (iter != m_end)
                     {
-                        if (is_match<'"'>(iter) && is_match<'"'>(iter + 1))
-                        {
-                            ++iter;
-                        }
-                        else if (is_match<'"'>(iter))
-                        {
-                            ++iter;
-                            break;
-                        }
-                        // update position info
-                        if (!is_match<'\n'>(iter))
-                        {
-                            m_column++;
-                        }
-                        else
-                        {
-                            m_line++;
-                            m_column = 0;
-                        }
-                        if (iter == m_end)
-                        {
-                            len = 0;
-                            break;
-                        }
-                        else
-                        {
-                            ++iter;
-                        }
+                        ++iter;
                     }
                     // set length
                     len = iter - m_current;
@@ -373,13 +378,9 @@ namespace sqf::sqc
                     ++iter;
                     ++iter;
                     // find string end
-                    while (true)
+                    while ((iter = skip_string_contents<true, '"', '{', '}'>(iter)) != m_end)
                     {
-                        if (is_match_repeated<2, '"'>(iter) || is_match_repeated<2, '{'>(iter) || is_match_repeated<2, '}'>(iter))
-                        {
-                            ++iter;
-                        }
-                        else if (is_match<'"'>(iter))
+                        if (is_match<'"'>(iter))
                         {
                             ++iter;
                             break;
@@ -390,25 +391,9 @@ namespace sqf::sqc
                             m_mode = emode::formatable_string;
                             break;
                         }
-                        // update position info
-                        if (!is_match<'\n'>(iter))
-                        {
-                            m_column++;
-                        }
-                        else
-                        {
-                            m_line++;
-                            m_column = 0;
-                        }
-                        if (iter == m_end)
-                        {
-                            len = 0;
-                            break;
-                        }
-                        else
-                        {
-                            ++iter;
-                        }
+                        // a single '}' is regular string content
+                        m_column++;
+                        ++iter;
                     }
                     // set length
                     len = iter - m_current;
@@ -418,13 +403,9 @@ namespace sqf::sqc
 
                     ++iter;
                     // find string end
-                    while (true)
+                    while ((iter = skip_string_contents<true, '"', '{', '}'>(iter)) != m_end)
                     {
-                        if (is_match_repeated<2, '"'>(iter) || is_match_repeated<2, '{'>(iter) || is_match_repeated<2, '}'>(iter))
-                        {
-                            ++iter;
-                        }
-                        else if (is_match<'"'>(iter))
+                        if (is_match<'"'>(iter))
                         {
                             // Retype as formatted_string final due to this the end
                             token_type = etoken::t_formatted_string_final;
@@ -437,34 +418,15 @@ namespace sqf::sqc
                             ++iter;
                             break;
                         }
-                        // update position info
-                        if (!is_match<'\n'>(iter))
-                        {
-                            m_column++;
-                        }
-                        else
-                        {
-                            m_line++;
-                            m_column = 0;
-                        }
-                        if (iter == m_end)
-                        {
-                            len = 0;
-                            break;
-                        }
-                        else
-                        {
-                            ++iter;
-                        }
+                        // a single '}' is regular string content
+                        m_column++;
+                        ++iter;
                     }
                     // set length
                     len = iter - m_current;
                 } break;
                 case etoken::t_ident: {
-                    len = len_match<
-                        'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o', 'p', 'q', 'r', 's', 't', 'u', 'v', 'w', 'x', 'y', 'z',
-                        'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P', 'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z',
-                        '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '_'>(iter);
+                    len = ::sqf::parser::scan::skip_identifier(ptr(iter), m_data_end) - ptr(iter);
                 } break;
                 case etoken::t_number: {
                     size_t res = 0;
@@ -502,7 +464,7 @@ namespace sqf::sqc
         }
 
     public:
-        tokenizer(iterator start, iterator end, std::string path) : m_start(start), m_current(start), m_end(end), m_line(0), m_column(0), m_mode(emode::normal) {}
+        tokenizer(iterator start, iterator end, std::string path) : m_start(start), m_current(start), m_end(end), m_data(start == end ? nullptr : &*start), m_data_end(m_data + (end - start)), m_line(0), m_column(0), m_mode(emode::normal) {}
         token next()
         {
             if (m_current == m_end) { return { etoken::eof, m_line, m_column, (size_t)(m_current - m_start), {} }; };
@@ -0,0 +1,35 @@
+# Parses a file producing a warning using --bytecode-cache and checks that the warning is reported
+# for cache hits as well, and that stale entries are reported and replaced.
+include("${CMAKE_CURRENT_LIST_DIR}/common.cmake")
+
+# Entries are only created for contents of at least 512 characters.
+string(REPEAT "x" 600 padding)
+file(WRITE "${WORK_DIR}/main.sqf" "padding = \"${padding}\";\nnumber = 0xFFFFFFFFFFFFFFFFFFFF;\ndiag_log \"done\";\n")
+set(warning "Number out of range.")
+
+run_sqfvm(output -V --bytecode-cache cache -i main.sqf)
+expect_contains("${output}" "Bytecode cache: 0 hits, 1 misses, 0 stale entries.")
+expect_contains("${output}" "${warning}")
+expect_contains("${output}" "[DIAG_LOG] done")
+file(GLOB entries "${WORK_DIR}/cache/*.sqfbc")
+list(LENGTH entries entry_count)
+if (NOT entry_count EQUAL 1)
+    message(FATAL_ERROR "Expected a single cache entry, got '${entries}'.")
+endif ()
+
+run_sqfvm(output -V --bytecode-cache cache -i main.sqf)
+expect_contains("${output}" "Bytecode cache: 1 hits, 0 misses, 0 stale entries.")
+expect_contains("${output}" "${warning}")
+expect_contains("${output}" "[DIAG_LOG] done")
+
+# Stale entries get parsed again and replaced.
+file(WRITE "${entries}" "not an entry")
+run_sqfvm(output -V --bytecode-cache cache -i main.sqf)
+expect_contains("${output}" "Bytecode cache: 0 hits, 1 misses, 1 stale entries.")
+expect_contains("${output}" "is stale (unknown format)")
+expect_contains("${output}" "${warning}")
+expect_contains("${output}" "[DIAG_LOG] done")
+
+run_sqfvm(output -V --bytecode-cache cache -i main.sqf)
+expect_contains("${output}" "Bytecode cache: 1 hits, 0 misses, 0 stale entries.")
+expect_contains("${output}" "${warning}")
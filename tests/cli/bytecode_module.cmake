@@ -0,0 +1,29 @@
+# Writes a module using --compile-bytecode and checks that execVM prefers it over the SQF file next to it,
+# unless the SQF file got changed afterwards.
+include("${CMAKE_CURRENT_LIST_DIR}/common.cmake")
+file(MAKE_DIRECTORY "${WORK_DIR}/compiled" "${WORK_DIR}/run")
+
+# Module and SQF file differ in contents, the module being newer. Sleeping as timestamps may only have a resolution of seconds.
+file(WRITE "${WORK_DIR}/run/module.sqf" "diag_log \"from source\";\n")
+execute_process(COMMAND "${CMAKE_COMMAND}" -E sleep 2)
+file(WRITE "${WORK_DIR}/compiled/module.sqf" "diag_log \"from module\";\n")
+run_sqfvm(output --compile-bytecode "${WORK_DIR}/compiled/module.sqf")
+if (NOT EXISTS "${WORK_DIR}/compiled/module.sqfc")
+    message(FATAL_ERROR "No module got written:\n${output}")
+endif ()
+# Copying keeps the timestamp of the module.
+file(COPY "${WORK_DIR}/compiled/module.sqfc" DESTINATION "${WORK_DIR}/run")
+
+# The second execVM receives the decoded module from the compile cache ([hits, misses, ...]).
+file(WRITE "${WORK_DIR}/main.sqf" "execVM \"${WORK_DIR}/run/module.sqf\";\nexecVM \"${WORK_DIR}/run/module.sqf\";\ndiag_log compileCache__;\n")
+run_sqfvm(output -i "${WORK_DIR}/main.sqf")
+expect_contains("${output}" "from module")
+expect_not_contains("${output}" "from source")
+expect_contains("${output}" "[DIAG_LOG] [1,1,")
+
+# Changing the SQF file makes the module stale.
+execute_process(COMMAND "${CMAKE_COMMAND}" -E sleep 2)
+file(WRITE "${WORK_DIR}/run/module.sqf" "diag_log \"from changed source\";\n")
+run_sqfvm(output -i "${WORK_DIR}/main.sqf")
+expect_contains("${output}" "from changed source")
+expect_not_contains("${output}" "from module")
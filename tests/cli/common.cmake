@@ -0,0 +1,35 @@
+# Helpers shared by the command line tests. Expects SQFVM (the executable) and WORK_DIR (a scratch directory) to be set.
+if (NOT SQFVM OR NOT WORK_DIR)
+    message(FATAL_ERROR "SQFVM and WORK_DIR have to be provided.")
+endif ()
+file(REMOVE_RECURSE "${WORK_DIR}")
+file(MAKE_DIRECTORY "${WORK_DIR}")
+
+# Runs sqfvm with the provided arguments, storing stdout and stderr in output_var. Fails if sqfvm fails.
+function(run_sqfvm output_var)
+    execute_process(COMMAND "${SQFVM}" -a --no-execute-print ${ARGN}
+        WORKING_DIRECTORY "${WORK_DIR}"
+        OUTPUT_VARIABLE output
+        ERROR_VARIABLE output
+        RESULT_VARIABLE result)
+    if (NOT result EQUAL 0)
+        message(FATAL_ERROR "sqfvm ${ARGN} exited with ${result}:\n${output}")
+    endif ()
+    set(${output_var} "${output}" PARENT_SCOPE)
+endfunction()
+
+# Fails unless text contains expected.
+function(expect_contains text expected)
+    string(FIND "${text}" "${expected}" position)
+    if (position EQUAL -1)
+        message(FATAL_ERROR "Expected '${expected}' in:\n${text}")
+    endif ()
+endfunction()
+
+# Fails if text contains unexpected.
+function(expect_not_contains text unexpected)
+    string(FIND "${text}" "${unexpected}" position)
+    if (NOT position EQUAL -1)
+        message(FATAL_ERROR "Did not expect '${unexpected}' in:\n${text}")
+    endif ()
+endfunction()
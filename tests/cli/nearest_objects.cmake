@@ -0,0 +1,42 @@
+# Checks the type filter of nearestObjects, which only gets applied with --check-classnames
+# and thus cannot be covered by runTests.sqf.
+include("${CMAKE_CURRENT_LIST_DIR}/common.cmake")
+
+file(WRITE "${WORK_DIR}/config.cpp" [=[
+class CfgVehicles
+{
+    class All {};
+    class Man : All {};
+    class CAManBase : Man {};
+    class SoldierWB : CAManBase {};
+    class Car : All {};
+};
+]=])
+
+# Logs the indices of the objects found, objects are placed far away from the player.
+file(WRITE "${WORK_DIR}/main.sqf" [=[
+private _objs = [
+    ["CAManBase", [10000,10000,0]],
+    ["Car", [10010,10000,0]],
+    ["SoldierWB", [10020,10000,0]],
+    ["CAManBase", [10100,10000,0]]
+] apply { (_x select 0) createVehicle (_x select 1) };
+private _find = { params ["_position", "_types"]; nearestObjects [_position, _types, 50] apply { _objs find _x } };
+diag_log format ["all %1", [[10000,10000,0], []] call _find];
+diag_log format ["CAManBase %1", [[10000,10000,0], ["CAManBase"]] call _find];
+diag_log format ["Man %1", [[10000,10000,0], ["Man"]] call _find];
+diag_log format ["Car %1", [[10000,10000,0], ["Car"]] call _find];
+diag_log format ["Car,SoldierWB %1", [[10000,10000,0], ["Car", "SoldierWB"]] call _find];
+diag_log format ["Tank %1", [[10000,10000,0], ["Tank"]] call _find];
+(_objs select 3) setPos [10030,10000,0];
+diag_log format ["moved %1", [[10030,10000,0], ["CAManBase"]] call _find];
+]=])
+
+run_sqfvm(output -c --input-config config.cpp -i main.sqf)
+expect_contains("${output}" "[DIAG_LOG] all [0,1,2]")
+expect_contains("${output}" "[DIAG_LOG] CAManBase [0,2]")
+expect_contains("${output}" "[DIAG_LOG] Man [0,2]")
+expect_contains("${output}" "[DIAG_LOG] Car [1]")
+expect_contains("${output}" "[DIAG_LOG] Car,SoldierWB [1,2]")
+expect_contains("${output}" "[DIAG_LOG] Tank []")
+expect_contains("${output}" "[DIAG_LOG] moved [3,2,0]")
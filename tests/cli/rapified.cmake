@@ -0,0 +1,42 @@
+# Saves a config using --config-save-rapified, loads the rapified config again
+# and checks that both contain the same classes and values.
+include("${CMAKE_CURRENT_LIST_DIR}/common.cmake")
+
+# Logs every entry reachable from configFile, including the ones inherited.
+file(WRITE "${WORK_DIR}/dump.sqf" [=[
+dump_fnc = {
+    params ["_config", "_indent"];
+    {
+        if (isClass _x) then {
+            diag_log format ["%1class %2", _indent, configName _x];
+            [_x, _indent + "  "] call dump_fnc;
+        } else {
+            private _value = if (isNumber _x) then { getNumber _x } else { if (isText _x) then { getText _x } else { getArray _x } };
+            diag_log format ["%1%2 = %3", _indent, configName _x, str _value];
+        };
+    } forEach configProperties [_config, "true", true];
+};
+[configFile, ""] call dump_fnc;
+]=])
+
+# Extracts the lines logged by the dump.
+function(extract_dump output_var output)
+    string(REGEX MATCHALL "\\[DIAG_LOG\\][^\n]*" lines "${output}")
+    set(${output_var} "${lines}" PARENT_SCOPE)
+endfunction()
+
+run_sqfvm(output --input-config "${CMAKE_CURRENT_LIST_DIR}/rapified/config.cpp" --config-save-rapified config.bin -i dump.sqf)
+extract_dump(expected "${output}")
+if (NOT EXISTS "${WORK_DIR}/config.bin")
+    message(FATAL_ERROR "No rapified config got written:\n${output}")
+endif ()
+expect_contains("${expected}" "extra = \"derived\"")
+expect_contains("${expected}" "array = [1,2.5,\"three\",[4,[\"five\"]]]")
+
+run_sqfvm(output --input-config config.bin -i dump.sqf)
+extract_dump(actual "${output}")
+if (NOT actual STREQUAL expected)
+    string(REPLACE ";" "\n" expected "${expected}")
+    string(REPLACE ";" "\n" actual "${actual}")
+    message(FATAL_ERROR "Rapified config differs.\nExpected:\n${expected}\nActual:\n${actual}")
+endif ()
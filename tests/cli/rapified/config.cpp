@@ -0,0 +1,30 @@
+class CfgBase
+{
+    integer = 1;
+    float = 1.5;
+    negative = -2;
+    text = "base";
+    quoted = "say ""hello""";
+    empty[] = {};
+    array[] = { 1, 2.5, "three", { 4, { "five" } } };
+    class Nested
+    {
+        flag = 1;
+    };
+};
+class CfgDerived : CfgBase
+{
+    integer = 2;
+    class Nested : Nested
+    {
+        extra = "derived";
+    };
+};
+class CfgOther
+{
+    class Inner;
+    class Child : CfgBase
+    {
+        text = "child";
+    };
+};
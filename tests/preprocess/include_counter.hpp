@@ -0,0 +1 @@
+counter __COUNTER__
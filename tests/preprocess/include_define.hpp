@@ -0,0 +1 @@
+#define INCLUDED_VALUE included
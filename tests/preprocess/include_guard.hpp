@@ -0,0 +1,5 @@
+#ifndef INCLUDE_GUARD_HPP
+#define INCLUDE_GUARD_HPP
+#define GUARDED_VALUE guarded
+header
+#endif
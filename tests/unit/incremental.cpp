@@ -0,0 +1,102 @@
+#include "unit.h"
+
+#include <runtime/runtime.h>
+#include <parser/sqf/incremental.hpp>
+#include <operators/ops.h>
+
+#include <string>
+#include <string_view>
+
+using namespace std::string_literals;
+
+namespace
+{
+    // Text the location of the PUSH instruction pushing value refers to, empty if there is none.
+    std::string_view pushed_at(const sqf::runtime::instruction_set& set, const std::string& value)
+    {
+        for (auto& inst : set)
+        {
+            if (inst->to_string() == "PUSH " + value)
+            {
+                auto& location = inst->location();
+                UNIT_ASSERT(location.source);
+                return location.source->contents().substr(location.offset, value.length());
+            }
+        }
+        return {};
+    }
+
+    // Every instruction refers to a position inside of the contents of its source.
+    void assert_locations(const sqf::runtime::instruction_set& set)
+    {
+        for (auto& inst : set)
+        {
+            auto& location = inst->location();
+            UNIT_ASSERT(location.source);
+            UNIT_ASSERT(location.offset < location.source->contents().length());
+        }
+    }
+}
+
+UNIT_TEST(incremental_reuses_statements)
+{
+    StdOutLogger logger;
+    sqf::runtime::runtime runtime(logger, sqf::runtime::runtime::runtime_conf{});
+    sqf::operators::ops(runtime);
+    sqf::parser::sqf::parser parser(logger);
+    sqf::parser::sqf::incremental state(parser, { "incremental.sqf"s, {} });
+    sqf::runtime::parser::sqf::context context{ runtime.sqfop_names_table(), nullptr };
+
+    auto first = state.parse(context, "a = 1;\nb = 2;\nc = 3;\nd = 4;\ne = 5;");
+    UNIT_ASSERT(first.has_value());
+    UNIT_ASSERT(state.last().statements_parsed == 5);
+
+    auto second = state.update(context, "a = 1;\nb = 22;\nc = 3;\nd = 4;\ne = 5;");
+    UNIT_ASSERT(second.has_value());
+    UNIT_ASSERT(state.last().statements_reused > 0);
+    UNIT_ASSERT(pushed_at(*second, "22") == "22");
+    UNIT_ASSERT(pushed_at(*second, "5") == "5");
+
+    // The result equals parsing the new contents from scratch.
+    auto full = parser.parse(context, std::string(state.contents()), state.file());
+    UNIT_ASSERT(full.has_value());
+    UNIT_ASSERT(full->size() == second->size());
+    for (auto expected_it = full->begin(), actual_it = second->begin(); expected_it != full->end(); ++expected_it, ++actual_it)
+    {
+        auto& expected = (*expected_it)->location();
+        auto& actual = (*actual_it)->location();
+        UNIT_ASSERT((*expected_it)->to_string() == (*actual_it)->to_string());
+        UNIT_ASSERT(expected.offset == actual.offset && expected.line == actual.line && expected.column == actual.column);
+    }
+}
+
+UNIT_TEST(incremental_keeps_previous_contents)
+{
+    StdOutLogger logger;
+    sqf::runtime::runtime runtime(logger, sqf::runtime::runtime::runtime_conf{});
+    sqf::operators::ops(runtime);
+    sqf::parser::sqf::parser parser(logger);
+    sqf::parser::sqf::incremental state(parser, { "incremental.sqf"s, {} });
+    sqf::runtime::parser::sqf::context context{ runtime.sqfop_names_table(), nullptr };
+
+    auto first = state.parse(context, "a = 1;\nb = 2;\nc = 3;\nd = 4;\ne = 5;");
+    UNIT_ASSERT(first.has_value());
+
+    // Shortens the text in front of the instructions replaced, moving what follows.
+    auto second = state.update(context, "x=7;\nb = 2;\nc = 3;\nd = 4;\ne = 5;");
+    UNIT_ASSERT(second.has_value());
+    auto third = state.update(context, "x=7;\nb = 2;\nc = 3333;\nd = 4;\ne = 5;");
+    UNIT_ASSERT(third.has_value());
+
+    // Instructions only held by an earlier set still refer to the text they got parsed from,
+    // while the ones reused got moved to the latest contents.
+    assert_locations(*first);
+    assert_locations(*second);
+    assert_locations(*third);
+    UNIT_ASSERT(pushed_at(*first, "1") == "1");
+    UNIT_ASSERT(pushed_at(*second, "7") == "7");
+    UNIT_ASSERT(pushed_at(*second, "3") == "3");
+    UNIT_ASSERT(pushed_at(*third, "3333") == "3333");
+    UNIT_ASSERT(pushed_at(*third, "5") == "5");
+    UNIT_ASSERT(pushed_at(*first, "5") == "5");
+}
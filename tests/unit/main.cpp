@@ -0,0 +1,33 @@
+#include "unit.h"
+
+#include <iostream>
+#include <string_view>
+
+// Runs all unit tests, or only the ones whose name contains the first argument.
+// Returns the amount of tests failed.
+int main(int argc, char** argv)
+{
+    std::string_view filter = argc > 1 ? argv[1] : "";
+    int failed = 0;
+    int executed = 0;
+    for (auto& test : sqf::tests::unit_tests())
+    {
+        if (std::string_view(test.name).find(filter) == std::string_view::npos)
+        {
+            continue;
+        }
+        executed++;
+        try
+        {
+            test.function();
+            std::cout << "[PASSED] " << test.name << std::endl;
+        }
+        catch (const std::exception& ex)
+        {
+            failed++;
+            std::cout << "[FAILED] " << test.name << ": " << ex.what() << std::endl;
+        }
+    }
+    std::cout << (executed - failed) << " out of " << executed << " tests passed." << std::endl;
+    return failed;
+}
@@ -0,0 +1,92 @@
+#include "unit.h"
+
+#include <fileio/pbo.h>
+#include <fileio/default.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+using namespace std::string_literals;
+
+namespace
+{
+    // Archive with a prefix property, one stored and one LZSS compressed entry.
+    const unsigned char pbo_fixture[] = {
+        // Properties: empty name, 'Vers' (reversed), four zero fields, then key/value pairs terminated by an empty key.
+        0x00, 's', 'r', 'e', 'V', 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        'p', 'r', 'e', 'f', 'i', 'x', 0x00, 'x', '\\', 't', 'e', 's', 't', 0x00, 0x00,
+        // "stored.txt": no packing, original size 0, data size 16.
+        's', 't', 'o', 'r', 'e', 'd', '.', 't', 'x', 't', 0x00, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0,
+        // "sub\compressed.txt": 'Cprs' (reversed), original size 13, data size 11.
+        's', 'u', 'b', '\\', 'c', 'o', 'm', 'p', 'r', 'e', 's', 's', 'e', 'd', '.', 't', 'x', 't', 0x00,
+        's', 'r', 'p', 'C', 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11, 0, 0, 0,
+        // Terminating entry.
+        0x00, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        // Data of "stored.txt".
+        's', 't', 'o', 'r', 'e', 'd', ' ', 'c', 'o', 'n', 't', 'e', 'n', 't', 's', '\n',
+        // Data of "sub\compressed.txt": flags (literal, literal, literal, reference, literal),
+        // "abc", a reference of distance 3 and length 9, "!" and the checksum (sum of all bytes).
+        0x17, 'a', 'b', 'c', 0x03, 0x06, '!', 0xB9, 0x04, 0x00, 0x00,
+        // Checksum of the archive.
+        0x00, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    };
+
+    std::string write_fixture()
+    {
+        auto path = (std::filesystem::temp_directory_path() / "sqfvm_unit_fixture.pbo").string();
+        std::ofstream out(path, std::ios_base::binary | std::ios_base::trunc);
+        out.write(reinterpret_cast<const char*>(pbo_fixture), sizeof(pbo_fixture));
+        UNIT_ASSERT(out.good());
+        return path;
+    }
+}
+
+UNIT_TEST(pbo_reads_entries)
+{
+    auto path = write_fixture();
+    auto archive = sqf::fileio::pbo_archive::open(path);
+    UNIT_ASSERT(archive);
+    UNIT_ASSERT(archive->prefix() == "x/test");
+    UNIT_ASSERT(archive->entries().size() == 2);
+
+    auto stored = archive->find("stored.txt");
+    UNIT_ASSERT(stored && stored->method == sqf::fileio::pbo_archive::packing::none);
+    auto stored_contents = archive->read(*stored);
+    UNIT_ASSERT(stored_contents && stored_contents->contents() == "stored contents\n");
+
+    // Lookups ignore case and the kind of separator.
+    auto compressed = archive->find("/SUB/Compressed.txt");
+    UNIT_ASSERT(compressed && compressed->method == sqf::fileio::pbo_archive::packing::compressed);
+    auto compressed_contents = archive->read(*compressed);
+    UNIT_ASSERT(compressed_contents && compressed_contents->contents() == "abcabcabcabc!");
+    // Decompressed once, further reads share the result.
+    UNIT_ASSERT(archive->read(*compressed) == compressed_contents);
+
+    UNIT_ASSERT(!archive->find("missing.txt"));
+}
+
+UNIT_TEST(pbo_mounts_onto_prefix)
+{
+    StdOutLogger logger;
+    auto path = write_fixture();
+    sqf::fileio::impl_default fileio(logger);
+    UNIT_ASSERT(fileio.mount_pbo(path));
+
+    auto stored = fileio.get_info("/x/test/stored.txt", {});
+    UNIT_ASSERT(stored.has_value());
+    UNIT_ASSERT(fileio.read_file(*stored) == "stored contents\n");
+    auto compressed = fileio.get_info("/x/test/sub/compressed.txt", {});
+    UNIT_ASSERT(compressed.has_value());
+    UNIT_ASSERT(fileio.read_file(*compressed) == "abcabcabcabc!");
+}
+
+UNIT_TEST(pbo_lzss_decompress)
+{
+    // References reaching before the start of the output yield spaces.
+    UNIT_ASSERT(sqf::fileio::pbo_archive::lzss_decompress("\x01" "a" "\x05\x00"s, 4) == "a   "s);
+    // Zero distance, truncated reference and missing data.
+    UNIT_ASSERT(!sqf::fileio::pbo_archive::lzss_decompress("\x00" "\x00\x00"s, 3).has_value());
+    UNIT_ASSERT(!sqf::fileio::pbo_archive::lzss_decompress("\x00" "\x01"s, 3).has_value());
+    UNIT_ASSERT(!sqf::fileio::pbo_archive::lzss_decompress("\x01" "a"s, 2).has_value());
+}
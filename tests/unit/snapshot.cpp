@@ -0,0 +1,171 @@
+#include "unit.h"
+
+#include <runtime/runtime.h>
+#include <runtime/d_array.h>
+#include <runtime/d_scalar.h>
+#include <runtime/d_string.h>
+#include <parser/config/default.h>
+
+#include <sstream>
+#include <string>
+#include <unordered_set>
+
+using namespace std::string_literals;
+
+namespace
+{
+    const char* snapshot_config = R"(
+class CfgBase
+{
+    number = 1;
+    text = "base";
+    array[] = { 1, "two", { 3 } };
+};
+class CfgDerived : CfgBase
+{
+    number = 2;
+    class Nested
+    {
+        flag = 1;
+    };
+};
+)";
+
+    // Creates a runtime with snapshot_config and a few variables in missionNamespace.
+    void setup_runtime(sqf::runtime::runtime& runtime, Logger& logger)
+    {
+        runtime.parser_config(std::make_unique<sqf::parser::config::impl_default>(logger));
+        UNIT_ASSERT(runtime.parser_config().parse(runtime.confighost(), snapshot_config, sqf::runtime::fileio::pathinfo("snapshot.cpp"s, "snapshot.cpp"s)));
+        auto scope = runtime.get_value_scope("missionnamespace");
+        (*scope)["number"] = 5.0f;
+        (*scope)["text"] = std::string("text");
+        (*scope)["array"] = std::vector<sqf::runtime::value>{ 1.0f, std::vector<sqf::runtime::value>{ std::string("nested") } };
+    }
+
+    // Lists all containers reachable from the root, with their parents and values.
+    // Dereferences every parent id, thus throws if any of them is out of range.
+    std::string dump_config(sqf::runtime::confighost& host)
+    {
+        std::stringstream sstream;
+        std::unordered_set<size_t> visited;
+        std::vector<sqf::runtime::confignav> pending = { host.root() };
+        while (!pending.empty())
+        {
+            auto nav = pending.back();
+            pending.pop_back();
+            if (!visited.insert(nav->id).second)
+            {
+                continue;
+            }
+            sqf::runtime::config logical = nav.parent_logical();
+            sqf::runtime::config inherited = nav.parent_inherited();
+            sqf::runtime::config current = nav;
+            sstream << current.name() << " < " << logical.name() << " : " << inherited.name() << " = " << nav->value.to_string_sqf() << "\n";
+            for (auto& child : *nav.members(false))
+            {
+                pending.push_back(child.navigate(host));
+            }
+        }
+        return sstream.str();
+    }
+
+    std::string serialize(sqf::runtime::runtime& runtime)
+    {
+        std::stringstream sstream;
+        UNIT_ASSERT(runtime.snapshot_create()->serialize(sstream));
+        return sstream.str();
+    }
+}
+
+UNIT_TEST(snapshot_roundtrip)
+{
+    StdOutLogger logger;
+    sqf::runtime::runtime source(logger, sqf::runtime::runtime::runtime_conf{});
+    setup_runtime(source, logger);
+    auto data = serialize(source);
+
+    sqf::runtime::runtime target(logger, sqf::runtime::runtime::runtime_conf{});
+    auto snap = target.snapshot_create();
+    std::stringstream in(data);
+    UNIT_ASSERT(snap->deserialize(in));
+    target.snapshot_apply(snap);
+
+    UNIT_ASSERT(dump_config(target.confighost()) == dump_config(source.confighost()));
+    auto scope = target.get_value_scope("missionnamespace");
+    UNIT_ASSERT((*scope)["number"].to_string_sqf() == "5");
+    UNIT_ASSERT((*scope)["text"].to_string_sqf() == "\"text\"");
+    UNIT_ASSERT((*scope)["array"].to_string_sqf() == "[1,[\"nested\"]]");
+}
+
+UNIT_TEST(snapshot_rejects_truncated)
+{
+    StdOutLogger logger;
+    sqf::runtime::runtime source(logger, sqf::runtime::runtime::runtime_conf{});
+    setup_runtime(source, logger);
+    auto data = serialize(source);
+    for (size_t length = 0; length < data.length(); length++)
+    {
+        std::stringstream in(data.substr(0, length));
+        UNIT_ASSERT(!source.snapshot_create()->deserialize(in));
+    }
+}
+
+UNIT_TEST(snapshot_rejects_invalid_ids)
+{
+    StdOutLogger logger;
+    sqf::runtime::runtime source(logger, sqf::runtime::runtime::runtime_conf{});
+    setup_runtime(source, logger);
+    auto data = serialize(source);
+    // Corrupted data is either rejected when loading or navigates without failing.
+    for (size_t i = 0; i < data.length(); i++)
+    {
+        auto corrupted = data;
+        corrupted[i] = static_cast<char>(0x7F);
+        std::stringstream in(corrupted);
+        sqf::runtime::runtime target(logger, sqf::runtime::runtime::runtime_conf{});
+        auto snap = target.snapshot_create();
+        if (snap->deserialize(in))
+        {
+            target.snapshot_apply(snap);
+            dump_config(target.confighost());
+        }
+    }
+}
+
+UNIT_TEST(snapshot_clone_isolation)
+{
+    StdOutLogger logger;
+    sqf::runtime::runtime source(logger, sqf::runtime::runtime::runtime_conf{});
+    setup_runtime(source, logger);
+    auto snap = source.snapshot_create();
+    auto config_before = dump_config(source.confighost());
+
+    sqf::runtime::runtime clone(logger, snap);
+    auto clone_scope = clone.get_value_scope("missionnamespace");
+    (*clone_scope)["array"].data<sqf::types::d_array>()->push_back(2.0f);
+    (*clone_scope)["number"] = 6.0f;
+    (*clone_scope)["added"] = 1.0f;
+    clone.confighost().root().append_or_replace("CfgAdded");
+    (clone.confighost().root() / "CfgBase" / "number").value(3.0f);
+
+    // Neither the runtime the snapshot got created from nor further clones see the changes.
+    auto source_scope = source.get_value_scope("missionnamespace");
+    UNIT_ASSERT((*source_scope)["array"].to_string_sqf() == "[1,[\"nested\"]]");
+    UNIT_ASSERT((*source_scope)["number"].to_string_sqf() == "5");
+    UNIT_ASSERT(!source_scope->contains("added"));
+    UNIT_ASSERT(dump_config(source.confighost()) == config_before);
+
+    sqf::runtime::runtime other(logger, snap);
+    auto other_scope = other.get_value_scope("missionnamespace");
+    UNIT_ASSERT((*other_scope)["array"].to_string_sqf() == "[1,[\"nested\"]]");
+    UNIT_ASSERT((*other_scope)["number"].to_string_sqf() == "5");
+    UNIT_ASSERT(!other_scope->contains("added"));
+    UNIT_ASSERT(dump_config(other.confighost()) == config_before);
+
+    // Changes done to the source after creating the snapshot are not seen by clones either.
+    (*source_scope)["array"].data<sqf::types::d_array>()->push_back(3.0f);
+    (source.confighost().root() / "CfgDerived" / "number").value(4.0f);
+    sqf::runtime::runtime late(logger, snap);
+    UNIT_ASSERT((*late.get_value_scope("missionnamespace"))["array"].to_string_sqf() == "[1,[\"nested\"]]");
+    UNIT_ASSERT(dump_config(late.confighost()) == config_before);
+}
@@ -0,0 +1,43 @@
+#pragma once
+#include <functional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace sqf::tests
+{
+    /// <summary>
+    /// Minimal test registry, used for the parts of SQF-VM that cannot be reached from runTests.sqf.
+    /// Tests are registered using UNIT_TEST and fail by throwing (see UNIT_ASSERT).
+    /// </summary>
+    struct unit_test
+    {
+        const char* name;
+        std::function<void()> function;
+    };
+    inline std::vector<unit_test>& unit_tests()
+    {
+        static std::vector<unit_test> tests;
+        return tests;
+    }
+    struct unit_test_registration
+    {
+        unit_test_registration(const char* name, std::function<void()> function) { unit_tests().push_back({ name, std::move(function) }); }
+    };
+    class assertion_failure : public std::runtime_error
+    {
+    public:
+        assertion_failure(const char* expression, const char* file, int line) :
+            std::runtime_error(std::string(file) + ":" + std::to_string(line) + ": " + expression) {}
+    };
+}
+
+#define UNIT_TEST_CONCAT_(A, B) A##B
+#define UNIT_TEST_CONCAT(A, B) UNIT_TEST_CONCAT_(A, B)
+#define UNIT_TEST(NAME) \
+    static void NAME(); \
+    static ::sqf::tests::unit_test_registration UNIT_TEST_CONCAT(NAME, _registration)(#NAME, NAME); \
+    static void NAME()
+#define UNIT_ASSERT(EXPRESSION) \
+    do { if (!(EXPRESSION)) { throw ::sqf::tests::assertion_failure(#EXPRESSION, __FILE__, __LINE__); } } while (false)